@@ -0,0 +1,269 @@
+#include "asset_bundle.h"
+
+AssetBundle::AssetBundle() :
+    base(nullptr),
+    header(nullptr),
+    entries(nullptr),
+#ifdef ESP_PLATFORM
+    mmap_handle(0),
+    mapped(false),
+#endif
+    fonts(nullptr) {
+}
+
+AssetBundle::~AssetBundle() {
+    end();
+}
+
+bool AssetBundle::begin(const char* partition_label, uint32_t expected_checksum) {
+#ifdef ESP_PLATFORM
+    end();
+
+    const esp_partition_t* partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                                                (esp_partition_subtype_t)ASSET_PARTITION_SUBTYPE,
+                                                                partition_label);
+    if (!partition) {
+        Serial.printf("Asset partition '%s' not found\n", partition_label);
+        return false;
+    }
+
+    // Map only as much as the bundle uses
+    AssetBundleHeader probe;
+    if (esp_partition_read(partition, 0, &probe, sizeof(probe)) != ESP_OK ||
+        probe.magic != ASSET_BUNDLE_MAGIC || probe.size < sizeof(probe) || probe.size > partition->size) {
+        Serial.println("Asset partition is empty - run tools/build_assets.py and flash the bundle");
+        return false;
+    }
+
+    const void* ptr = nullptr;
+    if (esp_partition_mmap(partition, 0, probe.size, SPI_FLASH_MMAP_DATA, &ptr, &mmap_handle) != ESP_OK) {
+        Serial.println("Asset partition mmap failed");
+        return false;
+    }
+    mapped = true;
+    base = (const uint8_t*)ptr;
+
+    if (!validate(probe.size, expected_checksum)) {
+        end();
+        return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool AssetBundle::begin(const uint8_t* data, uint32_t size, uint32_t expected_checksum) {
+    end();
+    if (!data || size < sizeof(AssetBundleHeader)) return false;
+
+    base = data;
+    if (!validate(size, expected_checksum)) {
+        end();
+        return false;
+    }
+    return true;
+}
+
+void AssetBundle::end() {
+    if (fonts) {
+        free(fonts);
+        fonts = nullptr;
+    }
+#ifdef ESP_PLATFORM
+    if (mapped) {
+        spi_flash_munmap(mmap_handle);
+        mapped = false;
+    }
+#endif
+    base = nullptr;
+    header = nullptr;
+    entries = nullptr;
+}
+
+const AssetEntry* AssetBundle::find(uint16_t id) const {
+    if (!header || id >= header->count) return nullptr;
+    const AssetEntry* entry = &entries[id];
+    return entry->id == id ? entry : nullptr;
+}
+
+const uint8_t* AssetBundle::getData(uint16_t id, uint32_t* size) const {
+    const AssetEntry* entry = find(id);
+    if (size) *size = entry ? entry->size : 0;
+    return entry ? base + entry->offset : nullptr;
+}
+
+Image AssetBundle::getImage(uint16_t id) const {
+    const AssetEntry* entry = find(id);
+    if (!entry || entry->type != ASSET_IMAGE) {
+        return Image(0, 0, IMAGE_RGB565_RAW, nullptr);
+    }
+
+    const uint8_t* data = base + entry->offset;
+    ImageFormat format = (ImageFormat)entry->format;
+    if (entry->palette_offset) {
+        return Image(entry->width, entry->height, format, data,
+                     (const uint16_t*)(base + entry->palette_offset), entry->palette_size,
+                     entry->transparent_index);
+    }
+    if (entry->has_transparency) {
+        return Image(entry->width, entry->height, format, data, entry->transparent_color, entry->size);
+    }
+    return Image(entry->width, entry->height, format, data, entry->size);
+}
+
+const AAFont* AssetBundle::getAAFont(uint16_t id) const {
+    const AssetEntry* entry = find(id);
+    return (entry && entry->type == ASSET_AA_FONT && fonts && fonts[id].aa.glyph) ? &fonts[id].aa : nullptr;
+}
+
+const GFXfont* AssetBundle::getGFXFont(uint16_t id) const {
+    const AssetEntry* entry = find(id);
+    return (entry && entry->type == ASSET_GFX_FONT && fonts && fonts[id].gfx.glyph) ? &fonts[id].gfx : nullptr;
+}
+
+const uint16_t* AssetBundle::getPalette(uint16_t id, uint16_t* count) const {
+    const AssetEntry* entry = find(id);
+    bool ok = entry && entry->type == ASSET_PALETTE;
+    if (count) *count = ok ? entry->size / sizeof(uint16_t) : 0;
+    return ok ? (const uint16_t*)(base + entry->offset) : nullptr;
+}
+
+// Private implementation functions
+// Uncompressed formats are read by position, so the data must cover every row
+static bool imageFits(const AssetEntry& entry) {
+    ImageFormat format = (ImageFormat)entry.format;
+    if (format >= IMAGE_FORMAT_COUNT) return false;
+    if (format == IMAGE_RGB565_RAW) return entry.size >= (uint32_t)entry.width * entry.height * 2;
+    if (imageIndexBits(format)) return entry.size >= imageIndexRowBytes(format, entry.width) * entry.height;
+    return true;
+}
+
+// Same CRC32 as zlib.crc32() in tools/build_assets.py
+static uint32_t bundleCrc32(const uint8_t* data, uint32_t len) {
+#ifdef ESP_PLATFORM
+    return esp_rom_crc32_le(0, data, len);
+#else
+    uint32_t crc = 0xFFFFFFFF;
+    for (uint32_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (uint8_t b = 0; b < 8; b++) crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+    return ~crc;
+#endif
+}
+
+// count elements of elem_size starting at offset lie inside size (no overflow)
+static bool rangeFits(uint32_t offset, uint32_t count, uint32_t elem_size, uint32_t size) {
+    return offset <= size && count <= (size - offset) / elem_size;
+}
+
+bool AssetBundle::validate(uint32_t available, uint32_t expected_checksum) {
+    const AssetBundleHeader* h = (const AssetBundleHeader*)base;
+    if (h->magic != ASSET_BUNDLE_MAGIC || h->version != ASSET_BUNDLE_VERSION) {
+        Serial.println("Asset bundle: bad magic or version");
+        return false;
+    }
+    if (h->size > available || !rangeFits(sizeof(AssetBundleHeader), h->count, sizeof(AssetEntry), h->size)) {
+        Serial.println("Asset bundle: truncated");
+        return false;
+    }
+
+    // Catches a corrupt or partly flashed bundle (one pass over the mapping at boot)
+    uint32_t crc = bundleCrc32(base + sizeof(AssetBundleHeader), h->size - sizeof(AssetBundleHeader));
+    if (crc != h->checksum) {
+        Serial.printf("Asset bundle: CRC %08lX does not match header %08lX - reflash it\n",
+                      (unsigned long)crc, (unsigned long)h->checksum);
+        return false;
+    }
+    if (expected_checksum && h->checksum != expected_checksum) {
+        Serial.printf("Asset bundle %08lX does not match asset_ids.h (%08lX) - rebuild and flash it\n",
+                      (unsigned long)h->checksum, (unsigned long)expected_checksum);
+        return false;
+    }
+
+    // Every asset (and palette) must lie inside the bundle
+    const AssetEntry* e = (const AssetEntry*)(base + sizeof(AssetBundleHeader));
+    for (uint16_t i = 0; i < h->count; i++) {
+        if (!rangeFits(e[i].offset, e[i].size, 1, h->size) ||
+            !rangeFits(e[i].palette_offset, e[i].palette_size, sizeof(uint16_t), h->size)) {
+            Serial.printf("Asset bundle: entry %u out of range\n", i);
+            return false;
+        }
+        if (e[i].type == ASSET_IMAGE && !imageFits(e[i])) {
+            Serial.printf("Asset bundle: image %u is too small for its size\n", i);
+            return false;
+        }
+    }
+
+    header = h;
+    entries = e;
+    return buildFonts();
+}
+
+// The glyph table and every glyph's bitmap must lie inside the asset
+static bool fontFits(const AssetEntry& entry, const AssetFontHeader* font) {
+    if (font->last < font->first) return false;
+    uint32_t glyph_count = font->last - font->first + 1;
+    bool aa = entry.type == ASSET_AA_FONT;
+    uint32_t glyph_size = aa ? sizeof(AAGlyph) : sizeof(GFXglyph);
+    if (!rangeFits(font->glyph_offset, glyph_count, glyph_size, entry.size)) return false;
+    if (font->bitmap_offset > entry.size) return false;
+
+    const uint8_t* glyphs = (const uint8_t*)font + font->glyph_offset;
+    uint32_t bitmap_size = entry.size - font->bitmap_offset;
+    for (uint32_t g = 0; g < glyph_count; g++) {
+        uint32_t offset, bytes;
+        if (aa) {
+            const AAGlyph* glyph = (const AAGlyph*)(glyphs + g * glyph_size);
+            offset = glyph->bitmapOffset;
+            bytes = (uint32_t)(glyph->width + 1) / 2 * glyph->height;
+        } else {
+            const GFXglyph* glyph = (const GFXglyph*)(glyphs + g * glyph_size);
+            offset = glyph->bitmapOffset;
+            bytes = ((uint32_t)glyph->width * glyph->height + 7) / 8;
+        }
+        if (!rangeFits(offset, bytes, 1, bitmap_size)) return false;
+    }
+    return true;
+}
+
+bool AssetBundle::buildFonts() {
+    uint16_t font_count = 0;
+    for (uint16_t i = 0; i < header->count; i++) {
+        if (entries[i].type == ASSET_AA_FONT || entries[i].type == ASSET_GFX_FONT) font_count++;
+    }
+    if (!font_count) return true;
+
+    // Indexed by id so lookups stay O(1); a few bytes per entry
+    fonts = (AssetFont*)calloc(header->count, sizeof(AssetFont));
+    if (!fonts) return false;
+
+    for (uint16_t i = 0; i < header->count; i++) {
+        const AssetEntry& entry = entries[i];
+        if (entry.type != ASSET_AA_FONT && entry.type != ASSET_GFX_FONT) continue;
+        if (entry.size < sizeof(AssetFontHeader)) continue;
+
+        const uint8_t* data = base + entry.offset;
+        const AssetFontHeader* font = (const AssetFontHeader*)data;
+        if (!fontFits(entry, font)) {
+            Serial.printf("Asset bundle: font %u out of range\n", i);
+            continue;
+        }
+
+        if (entry.type == ASSET_AA_FONT) {
+            fonts[i].aa.bitmap = (uint8_t*)(data + font->bitmap_offset);
+            fonts[i].aa.glyph = (AAGlyph*)(data + font->glyph_offset);
+            fonts[i].aa.first = font->first;
+            fonts[i].aa.last = font->last;
+            fonts[i].aa.yAdvance = font->y_advance;
+        } else {
+            fonts[i].gfx.bitmap = (uint8_t*)(data + font->bitmap_offset);
+            fonts[i].gfx.glyph = (GFXglyph*)(data + font->glyph_offset);
+            fonts[i].gfx.first = font->first;
+            fonts[i].gfx.last = font->last;
+            fonts[i].gfx.yAdvance = font->y_advance;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,128 @@
+#pragma once
+#include <Arduino.h>
+#include "image_manager.h"
+#include "font_manager.h"
+
+#ifdef ESP_PLATFORM
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+#endif
+
+// Packed asset bundle in its own flash partition (built by tools/build_assets.py)
+// The partition is memory-mapped, so image pixels, palettes and glyph
+// bitmaps are read in place through the flash cache - nothing is copied to
+// RAM except a small font struct per font. Asset ids come from the
+// generated asset_ids.h and index the directory directly.
+//
+// Layout (little-endian, every asset 4-byte aligned):
+//   AssetBundleHeader
+//   AssetEntry[count]        entry i has id i
+//   asset data...
+
+#define ASSET_BUNDLE_MAGIC      0x41584647   // "GFXA"
+#define ASSET_BUNDLE_VERSION    1
+#define ASSET_PARTITION_LABEL   "assets"
+#define ASSET_PARTITION_SUBTYPE 0x40         // First custom data subtype
+
+enum AssetType : uint8_t {
+    ASSET_NONE = 0,
+    ASSET_IMAGE,              // Any ImageFormat; indexed images carry a palette
+    ASSET_AA_FONT,            // 4-bpp AAFont
+    ASSET_GFX_FONT,           // 1-bpp Adafruit GFXfont
+    ASSET_PALETTE,            // RGB565 colours
+    ASSET_BLOB                // Raw bytes
+};
+
+struct AssetBundleHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;           // Directory entries
+    uint32_t size;            // Whole bundle in bytes
+    uint32_t checksum;        // CRC32 of everything after the header
+};
+
+struct AssetEntry {
+    uint16_t id;
+    uint8_t type;             // AssetType
+    uint8_t format;           // ImageFormat (images)
+    uint16_t width;           // Images
+    uint16_t height;
+    uint32_t offset;          // From the start of the bundle
+    uint32_t size;
+    uint32_t palette_offset;  // Indexed images (0 = none)
+    uint16_t palette_size;    // Entries
+    int16_t transparent_index;
+    uint16_t transparent_color;
+    uint8_t has_transparency;
+    uint8_t reserved[5];
+};
+
+// Start of a font asset; glyphs are stored in the GFXglyph/AAGlyph layout
+struct AssetFontHeader {
+    uint8_t first;
+    uint8_t last;
+    uint8_t y_advance;
+    uint8_t reserved;
+    uint32_t glyph_offset;    // From the start of the asset
+    uint32_t bitmap_offset;
+};
+
+static_assert(sizeof(AssetBundleHeader) == 16, "bundle header layout");
+static_assert(sizeof(AssetEntry) == 32, "bundle entry layout");
+static_assert(sizeof(AssetFontHeader) == 12, "font header layout");
+static_assert(sizeof(GFXglyph) == 8 && sizeof(AAGlyph) == 12, "glyph layout must match tools/build_assets.py");
+
+union AssetFont {
+    GFXfont gfx;
+    AAFont aa;
+};
+
+class AssetBundle {
+private:
+    const uint8_t* base;
+    const AssetBundleHeader* header;
+    const AssetEntry* entries;
+#ifdef ESP_PLATFORM
+    spi_flash_mmap_handle_t mmap_handle;
+    bool mapped;
+#endif
+
+    // Font structs hold pointers, so they are built in RAM at begin()
+    AssetFont* fonts;         // One slot per entry, or nullptr without fonts
+
+public:
+    AssetBundle();
+    ~AssetBundle();
+
+    AssetBundle(const AssetBundle&) = delete;
+    AssetBundle& operator=(const AssetBundle&) = delete;
+
+    // Map the bundle partition. The payload CRC is checked against the
+    // header; expected_checksum (ASSET_BUNDLE_CHECKSUM) also rejects a
+    // bundle that does not match the compiled asset_ids.h.
+    bool begin(const char* partition_label = ASSET_PARTITION_LABEL, uint32_t expected_checksum = 0);
+
+    // Use a bundle that is already in memory
+    bool begin(const uint8_t* data, uint32_t size, uint32_t expected_checksum = 0);
+
+    void end();
+
+    bool isReady() const { return header != nullptr; }
+    uint16_t getCount() const { return header ? header->count : 0; }
+    uint32_t getSize() const { return header ? header->size : 0; }
+    uint32_t getChecksum() const { return header ? header->checksum : 0; }
+
+    // Directory lookup (nullptr if the id is unknown)
+    const AssetEntry* find(uint16_t id) const;
+    const uint8_t* getData(uint16_t id, uint32_t* size = nullptr) const;
+
+    // Typed access; mismatched types return an invalid image / nullptr
+    Image getImage(uint16_t id) const;
+    const AAFont* getAAFont(uint16_t id) const;
+    const GFXfont* getGFXFont(uint16_t id) const;
+    const uint16_t* getPalette(uint16_t id, uint16_t* count = nullptr) const;
+
+private:
+    bool validate(uint32_t available, uint32_t expected_checksum);
+    bool buildFonts();
+};
@@ -0,0 +1,9 @@
+#pragma once
+
+// Generated by tools/build_assets.py from assets/assets.json - do not edit
+
+#define ASSET_BUNDLE_CHECKSUM 0x75ECB8D8
+#define ASSET_COUNT 2
+
+#define ASSET_LOGO         0    // image 650x196 qoi, 8535 bytes
+#define ASSET_FONT_TITLE   1    // GFX font FreeSans18pt7b, 4931 bytes
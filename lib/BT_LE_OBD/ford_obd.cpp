@@ -4,6 +4,7 @@
  */
 
 #include "ford_obd.h"
+#include "trace.h"
 // External display update functions (declared in main.cpp)
 extern void updateEngineOilTemp(float temp);
 extern void updateCoolantTemp(float temp);
@@ -12,9 +13,13 @@ extern void updateThrottlePos(float pos);
 extern void updateEngineLoad(float load);
 extern void updateRPM(int rpm);
 extern void updateSpeed(int speed);
-extern void updateBoost(float boost);
 extern void updateModuleVoltage(float voltage);
 
+// Instrumentation hooks (called from FordOBD::update())
+extern void recordOBDSample(int pidIndex);
+extern void recordOBDRoundTrip(unsigned long us);
+extern void recordTelemetrySample(int pidIndex, float value);
+
 // Global instance
 FordOBD fordOBD;
 
@@ -144,6 +149,7 @@ void notifyCallback(BLERemoteCharacteristic *pChar, uint8_t *data, size_t length
 {
   if (length == 0)
     return;
+  TRACE_INSTANT("ble notify", length);
 
   DEBUG_PRINT("📨 Fast RX (");
   DEBUG_PRINT(length);
@@ -177,6 +183,7 @@ void notifyCallback(BLERemoteCharacteristic *pChar, uint8_t *data, size_t length
   {
     DEBUG_PRINTLN("✅ Fast response complete");
     fordOBD.responseReady = true;
+    fordOBD.responseUs = micros();
     fordOBD.nb_rx_state = ELM_SUCCESS;
     fordOBD.lastSuccessfulResponse = millis();
     fordOBD.consecutiveErrors = 0;
@@ -501,6 +508,7 @@ void FordOBD::fastPollingLoop()
     if (now - lastCommandTime > RESPONSE_TIMEOUT)
     {
       DEBUG_PRINTLN("⏰ Ford response timeout");
+      TRACE_INSTANT("obd timeout", currentPIDIndex);
       nb_rx_state = ELM_TIMEOUT;
       consecutiveErrors++;
     }
@@ -509,6 +517,7 @@ void FordOBD::fastPollingLoop()
   case ELM_TIMEOUT:
   case ELM_ERROR:
     DEBUG_PRINTLN("❌ Ford error - recovering");
+    TRACE_INSTANT("obd recover", consecutiveErrors);
 
     // Ford-specific recovery: shorter delay
     delay(200);
@@ -536,6 +545,7 @@ void FordOBD::fastPollingLoop()
         DEBUG_PRINT("]: ");
         DEBUG_PRINTLN(userPIDs[currentPIDIndex].name);
 
+        TRACE_INSTANT("pid send", currentPIDIndex);
         sendCommand(userPIDs[currentPIDIndex].cmd);
         userPIDs[currentPIDIndex].lastSent = now;
         nb_rx_state = ELM_GETTING_MSG;
@@ -559,6 +569,14 @@ void FordOBD::fastPollingLoop()
 
 void FordOBD::processResponse()
 {
+  // Command written to response complete
+  if (commandSentUs)
+  {
+    recordOBDRoundTrip(responseUs - commandSentUs);
+    TRACE_COUNTER("ble rtt us", responseUs - commandSentUs);
+    commandSentUs = 0;
+  }
+
   response.trim();
   response.toUpperCase();
 
@@ -630,6 +648,7 @@ void FordOBD::processResponse()
 
 void FordOBD::parseOBDData(String data)
 {
+  TRACE_SCOPE("obd parse");
   
   Serial.println("🧪 parseOBDData() called with: " + data);
 
@@ -646,7 +665,9 @@ void FordOBD::parseOBDData(String data)
     String expectedPID = String(userPIDs[i].cmd).substring(2, 4);
     if (pid == expectedPID)
     {
+      recordOBDSample(i);
       String result = "";
+      float value = 0;
 
       if (pid == "05")
       { // Coolant Temperature
@@ -654,6 +675,7 @@ void FordOBD::parseOBDData(String data)
         {
           int temp = hexToInt(data.substring(4, 6)) - 40;
           result = String(temp);
+          value = temp;
 
           updateCoolantTemp((float)temp);
         }
@@ -664,6 +686,7 @@ void FordOBD::parseOBDData(String data)
         {
           int temp = hexToInt(data.substring(4, 6)) - 40;
           result = String(temp);
+          value = temp;
 
           // Update Display (hopefully)
           updateEngineOilTemp((float)temp);
@@ -675,6 +698,7 @@ void FordOBD::parseOBDData(String data)
         {
           float voltage = ((hexToInt(data.substring(4, 6)) << 8) + hexToInt(data.substring(6, 8))) / 1000.0;
           result = String(voltage, 2);
+          value = voltage;
 
           // Optional: Add display update
           updateModuleVoltage(voltage); // If you create this function
@@ -686,6 +710,7 @@ void FordOBD::parseOBDData(String data)
         {
           int temp = hexToInt(data.substring(4, 6)) - 40;
           result = String(temp);
+          value = temp;
         }
       }
       else if (pid == "0C")
@@ -694,6 +719,7 @@ void FordOBD::parseOBDData(String data)
         {
           int rpm = ((hexToInt(data.substring(4, 6)) << 8) + hexToInt(data.substring(6, 8))) / 4;
           result = String(rpm);
+          value = rpm;
         }
       }
       else if (pid == "0D")
@@ -702,24 +728,27 @@ void FordOBD::parseOBDData(String data)
         {
           int speed = hexToInt(data.substring(4, 6));
           result = String(speed);
+          value = speed;
 
           updateSpeed((int)speed);
         }
       }
       else if (pid == "0B")
-      { // Intake Manifold Pressure (BOOST for EcoBoost!)
+      { // Intake Manifold Pressure (absolute; boost is derived against baro)
+        if (data.length() >= 6)
+        {
+          int pressure = hexToInt(data.substring(4, 6));
+          result = String(pressure);
+          value = pressure;
+        }
+      }
+      else if (pid == "33")
+      { // Barometric Pressure
         if (data.length() >= 6)
         {
           int pressure = hexToInt(data.substring(4, 6));
-          // For EcoBoost, show boost above atmospheric (101.3 kPa)
-          if (pressure > 101)
-          {
-            result = String(pressure - 101) + " (+" + String(pressure - 101) + ")";
-          }
-          else
-          {
-            result = String(pressure);
-          }
+          result = String(pressure);
+          value = pressure;
         }
       }
       else if (pid == "11")
@@ -728,6 +757,7 @@ void FordOBD::parseOBDData(String data)
         {
           float throttle = (hexToInt(data.substring(4, 6)) * 100.0) / 255.0;
           result = String(throttle, 1);
+          value = throttle;
         }
       }
       else if (pid == "0A")
@@ -736,6 +766,7 @@ void FordOBD::parseOBDData(String data)
         {
           int pressure = hexToInt(data.substring(4, 6)) * 3;
           result = String(pressure);
+          value = pressure;
         }
       }
       else if (pid == "04")
@@ -744,6 +775,7 @@ void FordOBD::parseOBDData(String data)
         {
           float load = (hexToInt(data.substring(4, 6)) * 100.0) / 255.0;
           result = String(load, 1);
+          value = load;
         }
       }
       else if (pid == "10")
@@ -752,6 +784,7 @@ void FordOBD::parseOBDData(String data)
         {
           float maf = ((hexToInt(data.substring(4, 6)) << 8) + hexToInt(data.substring(6, 8))) / 100.0;
           result = String(maf, 2);
+          value = maf;
         }
       }
       else if (pid == "06")
@@ -760,6 +793,7 @@ void FordOBD::parseOBDData(String data)
         {
           float trim = (hexToInt(data.substring(4, 6)) - 128) * 100.0 / 128.0;
           result = String(trim, 1);
+          value = trim;
         }
       }
       else if (pid == "07")
@@ -768,6 +802,7 @@ void FordOBD::parseOBDData(String data)
         {
           float trim = (hexToInt(data.substring(4, 6)) - 128) * 100.0 / 128.0;
           result = String(trim, 1);
+          value = trim;
         }
       }
       else if (pid == "0E")
@@ -776,6 +811,7 @@ void FordOBD::parseOBDData(String data)
         {
           float timing = (hexToInt(data.substring(4, 6)) / 2.0) - 64.0;
           result = String(timing, 1);
+          value = timing;
         }
       }
       else if (pid == "00")
@@ -790,6 +826,7 @@ void FordOBD::parseOBDData(String data)
       // Display result with Ford-specific formatting
       if (result.length() > 0)
       {
+        recordTelemetrySample(i, value);
         TEMP_PRINT(userPIDs[i].emoji);
         TEMP_PRINT(" ");
         TEMP_PRINT(userPIDs[i].name);
@@ -811,10 +848,12 @@ void FordOBD::sendCommand(String cmd)
     return;
   }
 
+  TRACE_SCOPE("ble write");
   try
   {
     response = "";
     responseReady = false;
+    commandSentUs = micros();
     pTX->writeValue(cmd.c_str(), cmd.length());
     lastCommandTime = millis();
 
@@ -936,6 +975,8 @@ void FordOBD::switchToNextPID()
     attempts++;
   } while (!isPIDReadyToSend(currentPIDIndex) && attempts < numEnabledPIDs);
 
+  TRACE_INSTANT("next pid", currentPIDIndex);
+
   if (attempts >= numEnabledPIDs)
   {
     delay(25);
@@ -69,9 +69,11 @@ static PIDConfig userPIDs[] = {
     {true, "0111\r", "Throttle", "%", "🎯", 500, 0, false}, // 2Hz - Important for turbo
 
     //// EcoBoost Turbo monitoring - Critical for Ford performance
-    //{true,  "010B\r", "Boost", "kPa", "💨", 500, 0, false},          // 2Hz - Turbo pressure!
+    // (boost, fuel flow, economy and power are derived from these in main)
+    {true,  "010B\r", "MAP", "kPa", "💨", 500, 0, false},          // 2Hz - Manifold pressure
     {true, "0104\r", "Engine Load", "%", "⚡", 1000, 0, false}, // 1Hz - Turbo efficiency
-    //{false,  "0110\r", "MAF Rate", "g/s", "🌪️", 1000, 0, false},     // 1Hz - Airflow
+    {true,  "0110\r", "MAF Rate", "g/s", "🌪️", 1000, 0, false},     // 1Hz - Airflow
+    {true,  "0133\r", "Baro", "kPa", "🌤️", 30000, 0, false},       // Slow - Boost reference
 
     // Temperatures - Slower updates OK
     {true, "0105\r", "Coolant", "°C", "🌡️", 3000, 0, false},    // 0.33Hz - Thermal
@@ -135,6 +137,8 @@ private:
   bool responseReady = false;
   unsigned long lastHealthCheck = 0;
   unsigned long lastCommandTime = 0;
+  unsigned long commandSentUs = 0;       // micros() of the last write, 0 once timed
+  volatile unsigned long responseUs = 0; // micros() the response completed
   elm_states nb_rx_state = ELM_NO_RESPONSE;
 
   // PID management
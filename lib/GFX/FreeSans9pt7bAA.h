@@ -0,0 +1,524 @@
+#pragma once
+
+// 4-bpp anti-aliased font generated by tools/fontconvert_aa.py
+
+const uint8_t FreeSans9pt7bAABitmaps[] PROGMEM = {
+    0x84, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x80, 0x40, 0x84,
+    0xF8, 0x84, 0x8F, 0x08, 0xF0, 0x8F, 0x08, 0xF0, 0x8F, 0x08, 0xF0, 0x4B,
+    0x04, 0xB0, 0x04, 0x00, 0x40, 0x00, 0x04, 0x80, 0x08, 0x40, 0x00, 0x08,
+    0xB0, 0x0F, 0x80, 0x00, 0x0B, 0x80, 0x4F, 0x00, 0x08, 0x8F, 0xB8, 0xBF,
+    0x84, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x8F, 0x00, 0xF8, 0x00, 0x00,
+    0x8F, 0x00, 0xF8, 0x00, 0x88, 0xBB, 0x88, 0xF8, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x00, 0xF4, 0x08, 0xB0, 0x00, 0x04, 0xF0, 0x0B, 0x80, 0x00,
+    0x08, 0xF0, 0x0F, 0x80, 0x00, 0x04, 0x40, 0x08, 0x00, 0x00, 0x00, 0x8F,
+    0x80, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0xBF, 0x4F, 0x0B, 0xF0, 0xF8, 0x0F,
+    0x00, 0xF8, 0xF8, 0x0F, 0x00, 0x84, 0xFB, 0x0F, 0x00, 0x00, 0x8F, 0xBF,
+    0x40, 0x00, 0x04, 0xBF, 0xFF, 0x80, 0x00, 0x0F, 0x48, 0xFB, 0x84, 0x0F,
+    0x00, 0x8F, 0xF8, 0x0F, 0x00, 0x8F, 0xBB, 0x0F, 0x08, 0xFB, 0x4F, 0xFF,
+    0xFF, 0xB0, 0x00, 0x8F, 0x84, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x48,
+    0x40, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x04, 0xF0,
+    0x00, 0x00, 0x4F, 0x40, 0x4F, 0x40, 0x0F, 0x80, 0x00, 0x00, 0x88, 0x00,
+    0x08, 0x80, 0x8F, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x4F, 0x80, 0xF4, 0x00,
+    0x00, 0x00, 0x0B, 0xFF, 0xFB, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x88,
+    0x80, 0x0F, 0x40, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x04, 0xFF,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x0B, 0xB0, 0x0B, 0xB0, 0x00, 0x00,
+    0x0B, 0xB0, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x4F, 0x40, 0x0B, 0xB0,
+    0x0B, 0xB0, 0x00, 0x00, 0xBB, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x4B, 0xFF, 0x40, 0x00, 0x04,
+    0xFB, 0x8B, 0xF4, 0x00, 0x08, 0xF0, 0x00, 0xF8, 0x00, 0x08, 0xF4, 0x04,
+    0xF8, 0x00, 0x00, 0xBB, 0x4F, 0xB0, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00,
+    0x08, 0xF8, 0xFB, 0x04, 0x80, 0x8F, 0x40, 0x4F, 0xB8, 0xF0, 0xF8, 0x00,
+    0x04, 0xFF, 0x80, 0xF8, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0x80, 0x08, 0xFF,
+    0xB0, 0x4F, 0xFF, 0xFF, 0x84, 0xF4, 0x00, 0x88, 0x80, 0x00, 0x88, 0xF8,
+    0xF8, 0xF8, 0xB4, 0x40, 0x00, 0x08, 0x00, 0x00, 0x4B, 0x00, 0x00, 0xB4,
+    0x00, 0x04, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x4F, 0x00,
+    0x00, 0x8F, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x8F, 0x00,
+    0x00, 0x0F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x08, 0xB0, 0x00, 0x00, 0xF0,
+    0x00, 0x00, 0x88, 0x00, 0x00, 0x0B, 0x40, 0x44, 0x00, 0x00, 0x0B, 0x40,
+    0x00, 0x08, 0xB0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x4F, 0x00, 0x00, 0x8F, 0x00, 0x00, 0xB8,
+    0x00, 0x04, 0xF0, 0x00, 0x08, 0x80, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0xF0, 0x00, 0xFB, 0xFB, 0xF0, 0x08, 0xF8, 0x00, 0x4F, 0x4F,
+    0x40, 0x04, 0x04, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x08, 0x80, 0x00,
+    0x00, 0x08, 0x80, 0x00, 0x88, 0x8B, 0xB8, 0x88, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x08, 0x80, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x08, 0x80, 0x00,
+    0x00, 0x04, 0x40, 0x00, 0x48, 0x8F, 0x4F, 0x0F, 0x48, 0xFF, 0xFF, 0x88,
+    0x88, 0x48, 0x8F, 0x48, 0x00, 0x00, 0x80, 0x00, 0x04, 0xB0, 0x00, 0x08,
+    0x80, 0x00, 0x0F, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x88, 0x00, 0x00, 0xF0,
+    0x00, 0x00, 0xF0, 0x00, 0x08, 0x80, 0x00, 0x0B, 0x40, 0x00, 0x0F, 0x00,
+    0x00, 0x88, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xBF,
+    0xFB, 0x40, 0x0B, 0xF8, 0x8F, 0xF0, 0x8F, 0x40, 0x04, 0xF8, 0xBB, 0x00,
+    0x00, 0xBB, 0xF8, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x8F, 0xF8, 0x00,
+    0x00, 0x8F, 0xF8, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0xBF, 0x8F, 0x00,
+    0x00, 0xF8, 0x4F, 0xB0, 0x0B, 0xF4, 0x08, 0xFF, 0xFF, 0x40, 0x00, 0x48,
+    0x84, 0x00, 0x00, 0x0F, 0x00, 0xBF, 0x8F, 0xFF, 0x88, 0xBF, 0x00, 0x8F,
+    0x00, 0x8F, 0x00, 0x8F, 0x00, 0x8F, 0x00, 0x8F, 0x00, 0x8F, 0x00, 0x8F,
+    0x00, 0x8F, 0x00, 0x48, 0x04, 0xBF, 0xFB, 0x40, 0x4F, 0xF8, 0x8F, 0xF4,
+    0xBF, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x04, 0xFB, 0x00, 0x00, 0x8F, 0xB0, 0x00, 0x4F, 0xF8, 0x00,
+    0x0B, 0xF8, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0x88, 0x88, 0x00, 0x4F, 0xFF, 0xB4,
+    0x00, 0x04, 0xFB, 0x88, 0xFF, 0x00, 0x0B, 0xB0, 0x00, 0x4F, 0x80, 0x0F,
+    0x80, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0xFF,
+    0xF4, 0x00, 0x00, 0x00, 0x88, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF0,
+    0x48, 0x00, 0x00, 0x08, 0xF0, 0x8F, 0x40, 0x00, 0x08, 0xF0, 0x0F, 0xB4,
+    0x00, 0x8F, 0x80, 0x04, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x08, 0x88, 0x40,
+    0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0x00, 0x00,
+    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x08, 0xB8, 0xF0, 0x00, 0x00, 0x4F, 0x48,
+    0xF0, 0x00, 0x00, 0xF4, 0x08, 0xF0, 0x00, 0x0B, 0xB0, 0x08, 0xF0, 0x00,
+    0x4F, 0x00, 0x08, 0xF0, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0x80, 0x48, 0x88,
+    0x8B, 0xF8, 0x40, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x08, 0xF0,
+    0x00, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x08,
+    0xF8, 0x88, 0x88, 0x40, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00,
+    0x00, 0x00, 0x0B, 0xF8, 0xFF, 0xB4, 0x00, 0x0F, 0xFB, 0x88, 0xFF, 0x40,
+    0x08, 0x40, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00,
+    0x00, 0x08, 0xF0, 0x48, 0x00, 0x00, 0x0B, 0xB0, 0x4F, 0xB0, 0x00, 0x8F,
+    0x40, 0x04, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x08, 0x88, 0x00, 0x00, 0x00,
+    0x8F, 0xFB, 0x40, 0x0B, 0xF8, 0x8B, 0xF4, 0x4F, 0x40, 0x00, 0xF8, 0x8B,
+    0x00, 0x00, 0x00, 0xF8, 0x08, 0x84, 0x00, 0xFB, 0xFF, 0xFF, 0xB0, 0xFF,
+    0x80, 0x08, 0xF8, 0xFB, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x8F, 0x8B,
+    0x00, 0x00, 0xBF, 0x4F, 0x80, 0x08, 0xF8, 0x0B, 0xFF, 0xFF, 0xB0, 0x00,
+    0x48, 0x84, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0x88, 0xBB, 0x00,
+    0x00, 0x04, 0xF4, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x8B, 0x00, 0x00,
+    0x00, 0xF4, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
+    0x8F, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x04,
+    0xF0, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xB4, 0x00,
+    0x08, 0xFB, 0x88, 0xFF, 0x00, 0x0F, 0xB0, 0x00, 0x4F, 0x80, 0x0F, 0x80,
+    0x00, 0x0F, 0x80, 0x0B, 0xF4, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0xFF, 0xF4,
+    0x00, 0x0B, 0xFB, 0x88, 0xFF, 0x40, 0x4F, 0x40, 0x00, 0x0F, 0xB0, 0x8F,
+    0x00, 0x00, 0x08, 0xF0, 0x8F, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xB4, 0x00,
+    0x8F, 0x80, 0x04, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x08, 0x88, 0x40, 0x00,
+    0x00, 0x8F, 0xFF, 0x80, 0x00, 0x0B, 0xFB, 0x8B, 0xF8, 0x00, 0x4F, 0x80,
+    0x00, 0x8F, 0x00, 0x8F, 0x00, 0x00, 0x0F, 0x40, 0x8F, 0x00, 0x00, 0x0F,
+    0x80, 0x4F, 0x40, 0x00, 0x8F, 0x80, 0x0B, 0xF8, 0x8B, 0xFF, 0x80, 0x00,
+    0x8F, 0xFB, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x08, 0x40, 0x00,
+    0x8F, 0x00, 0x0F, 0xB0, 0x04, 0xF8, 0x00, 0x04, 0xFF, 0xFF, 0xB0, 0x00,
+    0x00, 0x08, 0x84, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x8F, 0x48, 0x8F, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8F,
+    0x4F, 0x0F, 0x48, 0x00, 0x00, 0x00, 0x48, 0x80, 0x00, 0x00, 0x4B, 0xFB,
+    0x40, 0x00, 0x8F, 0xF8, 0x40, 0x00, 0x8F, 0xB8, 0x00, 0x00, 0x00, 0xFB,
+    0x40, 0x00, 0x00, 0x00, 0x48, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF,
+    0xB4, 0x00, 0x00, 0x00, 0x04, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x04, 0x40,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x88, 0x88, 0x88, 0x88, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x88, 0x88, 0x88, 0x88,
+    0x40, 0xB4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB8, 0x00, 0x00, 0x00, 0x00,
+    0x8F, 0xF8, 0x40, 0x00, 0x00, 0x00, 0x8B, 0xFB, 0x40, 0x00, 0x00, 0x04,
+    0xBF, 0x80, 0x00, 0x08, 0xBF, 0xB4, 0x00, 0x08, 0xFF, 0x80, 0x00, 0x00,
+    0xFB, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x84, 0x00, 0x0B, 0xFF, 0xFF, 0xB0, 0x4F, 0xB0, 0x08, 0xFB, 0x8F, 0x00,
+    0x00, 0x8F, 0x48, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00,
+    0xBF, 0xB0, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x0F,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0x00, 0x00, 0x0F,
+    0x80, 0x00, 0x00, 0x08, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0x80, 0x00, 0x48, 0xFF, 0x40, 0x00, 0x00, 0x4F, 0xB0,
+    0x00, 0x00, 0x00, 0x4B, 0xF4, 0x00, 0x04, 0xFB, 0x00, 0x04, 0x88, 0x00,
+    0x00, 0xFF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x8B, 0xBB, 0xB0, 0x8F, 0x40,
+    0x0F, 0x80, 0x0B, 0xF0, 0x00, 0xBF, 0x80, 0x0F, 0x80, 0x8F, 0x00, 0x0F,
+    0x80, 0x00, 0x8F, 0x00, 0x0F, 0x80, 0x8F, 0x00, 0x8F, 0x00, 0x00, 0xBB,
+    0x00, 0x0F, 0x80, 0x8F, 0x00, 0x8F, 0x00, 0x00, 0xF8, 0x00, 0x8F, 0x00,
+    0x8F, 0x40, 0x4F, 0x40, 0x0B, 0xF0, 0x04, 0xF8, 0x00, 0x0F, 0xB0, 0x0B,
+    0xF8, 0xBB, 0xFB, 0x8F, 0xB0, 0x00, 0x08, 0xF4, 0x00, 0x88, 0x40, 0x48,
+    0x84, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0xFF, 0xB8, 0x88, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xF8, 0x00, 0x00,
+    0x00, 0x04, 0xF8, 0xBF, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x8F, 0x40, 0x00,
+    0x00, 0x0F, 0xB0, 0x0F, 0x80, 0x00, 0x00, 0x4F, 0x40, 0x0B, 0xF0, 0x00,
+    0x00, 0x8F, 0x00, 0x08, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+    0x08, 0xFB, 0x88, 0x88, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x8F, 0x80,
+    0x0F, 0xB0, 0x00, 0x00, 0x0F, 0xB0, 0x8F, 0x80, 0x00, 0x00, 0x0B, 0xF0,
+    0x48, 0x00, 0x00, 0x00, 0x04, 0x84, 0x48, 0x88, 0x88, 0x84, 0x00, 0x8F,
+    0xFF, 0xFF, 0xFF, 0xB0, 0x8F, 0x00, 0x00, 0x0B, 0xF4, 0x8F, 0x00, 0x00,
+    0x00, 0xF8, 0x8F, 0x00, 0x00, 0x00, 0xF8, 0x8F, 0x00, 0x00, 0x0B, 0xF0,
+    0x8F, 0xFF, 0xFF, 0xFF, 0x80, 0x8F, 0x88, 0x88, 0x8B, 0xF4, 0x8F, 0x00,
+    0x00, 0x00, 0xBB, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00,
+    0x8F, 0x8F, 0x00, 0x00, 0x04, 0xFB, 0x8F, 0xFF, 0xFF, 0xFF, 0xB0, 0x48,
+    0x88, 0x88, 0x84, 0x00, 0x00, 0x00, 0x48, 0x88, 0x40, 0x00, 0x00, 0x4B,
+    0xFF, 0xFF, 0xFB, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x8F, 0xB0, 0x0B, 0xF4,
+    0x00, 0x00, 0x08, 0xF4, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x84, 0x8F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x84, 0x0F, 0x80,
+    0x00, 0x00, 0x04, 0xF8, 0x0B, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x04, 0xFF,
+    0x80, 0x00, 0xBF, 0x80, 0x00, 0x4B, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+    0x48, 0x88, 0x00, 0x00, 0x48, 0x88, 0x88, 0x80, 0x00, 0x00, 0x8F, 0xFF,
+    0xFF, 0xFF, 0x40, 0x00, 0x8F, 0x00, 0x00, 0x4B, 0xF4, 0x00, 0x8F, 0x00,
+    0x00, 0x00, 0xBB, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0x40, 0x8F, 0x00,
+    0x00, 0x00, 0x0F, 0x80, 0x8F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x8F, 0x00,
+    0x00, 0x00, 0x0F, 0x80, 0x8F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x8F, 0x00,
+    0x00, 0x00, 0x8F, 0x40, 0x8F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x8F, 0x00,
+    0x00, 0x4B, 0xF4, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x48, 0x88,
+    0x88, 0x80, 0x00, 0x00, 0x48, 0x88, 0x88, 0x88, 0x80, 0x8F, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00,
+    0x8F, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x8F, 0x88, 0x88, 0x88, 0x80, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xF8, 0x48, 0x88, 0x88,
+    0x88, 0x84, 0x48, 0x88, 0x88, 0x88, 0x80, 0x8F, 0xFF, 0xFF, 0xFF, 0xF0,
+    0x8F, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00,
+    0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF,
+    0x00, 0x8F, 0x88, 0x88, 0x88, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00,
+    0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x88, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x4B, 0xFB, 0x00, 0x0B, 0xF4, 0x00,
+    0x00, 0x00, 0x8F, 0x40, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x08, 0x40, 0x8F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x04, 0x88, 0x88,
+    0x40, 0x8F, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x8F, 0x40, 0x00, 0x00,
+    0x00, 0x0F, 0x80, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x0B, 0xF4,
+    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x84, 0x00, 0x4B, 0xBF, 0x80,
+    0x00, 0x0B, 0xFF, 0xFF, 0xFB, 0x0B, 0x80, 0x00, 0x00, 0x48, 0x88, 0x40,
+    0x04, 0x40, 0x48, 0x00, 0x00, 0x00, 0x48, 0x8F, 0x00, 0x00, 0x00, 0x8F,
+    0x8F, 0x00, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0x8F, 0x00,
+    0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0x8F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x8F, 0x88, 0x88, 0x88, 0xBF, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0x8F,
+    0x00, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00,
+    0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0x48, 0x00, 0x00, 0x00, 0x48,
+    0x84, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+    0xF8, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
+    0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
+    0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
+    0x00, 0xF8, 0x8F, 0x00, 0x00, 0xF8, 0x8F, 0x00, 0x00, 0xF8, 0x4F, 0xB0,
+    0x0B, 0xF4, 0x0B, 0xFF, 0xFF, 0xB0, 0x00, 0x48, 0x84, 0x00, 0x48, 0x00,
+    0x00, 0x00, 0x88, 0x00, 0x8F, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x8F, 0x00,
+    0x00, 0xBF, 0x40, 0x00, 0x8F, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x8F, 0x00,
+    0xBF, 0xB0, 0x00, 0x00, 0x8F, 0x04, 0xFB, 0x00, 0x00, 0x00, 0x8F, 0x4F,
+    0xFB, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0x8F, 0x40, 0x00, 0x00, 0x8F, 0x40,
+    0x0B, 0xF4, 0x00, 0x00, 0x8F, 0x00, 0x04, 0xFB, 0x00, 0x00, 0x8F, 0x00,
+    0x00, 0x8F, 0x80, 0x00, 0x8F, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x8F, 0x00,
+    0x00, 0x04, 0xFB, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x40, 0x48, 0x00,
+    0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0x00,
+    0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0x00,
+    0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0x00,
+    0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+    0xFF, 0xFF, 0x48, 0x88, 0x88, 0x88, 0x48, 0x80, 0x00, 0x00, 0x00, 0x88,
+    0x40, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x8F, 0xF8, 0x00, 0x00,
+    0x08, 0xFF, 0x80, 0x8F, 0xBB, 0x00, 0x00, 0x0B, 0xBF, 0x80, 0x8F, 0x8F,
+    0x00, 0x00, 0x0F, 0x8F, 0x80, 0x8F, 0x0F, 0x80, 0x00, 0x8F, 0x0F, 0x80,
+    0x8F, 0x0B, 0xB0, 0x00, 0xBB, 0x0F, 0x80, 0x8F, 0x08, 0xF0, 0x00, 0xF8,
+    0x0F, 0x80, 0x8F, 0x00, 0xF8, 0x08, 0xF0, 0x0F, 0x80, 0x8F, 0x00, 0xBB,
+    0x0B, 0xB0, 0x0F, 0x80, 0x8F, 0x00, 0x8F, 0x0F, 0x80, 0x0F, 0x80, 0x8F,
+    0x00, 0x0F, 0xFF, 0x00, 0x0F, 0x80, 0x8F, 0x00, 0x0B, 0xFB, 0x00, 0x0F,
+    0x80, 0x48, 0x00, 0x04, 0x84, 0x00, 0x08, 0x40, 0x48, 0x40, 0x00, 0x00,
+    0x08, 0x40, 0x8F, 0xB0, 0x00, 0x00, 0x0F, 0x80, 0x8F, 0xF8, 0x00, 0x00,
+    0x0F, 0x80, 0x8F, 0xBF, 0x40, 0x00, 0x0F, 0x80, 0x8F, 0x0F, 0xB0, 0x00,
+    0x0F, 0x80, 0x8F, 0x04, 0xF8, 0x00, 0x0F, 0x80, 0x8F, 0x00, 0xBF, 0x00,
+    0x0F, 0x80, 0x8F, 0x00, 0x4F, 0xB0, 0x0F, 0x80, 0x8F, 0x00, 0x08, 0xF4,
+    0x0F, 0x80, 0x8F, 0x00, 0x00, 0xBF, 0x0F, 0x80, 0x8F, 0x00, 0x00, 0x4F,
+    0xBF, 0x80, 0x8F, 0x00, 0x00, 0x08, 0xFF, 0x80, 0x8F, 0x00, 0x00, 0x00,
+    0xFF, 0x80, 0x48, 0x00, 0x00, 0x00, 0x48, 0x40, 0x00, 0x00, 0x08, 0x88,
+    0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF,
+    0x80, 0x00, 0x4B, 0xF4, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x40,
+    0x0F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x8F, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xF0, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x8F, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0xF0, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x0F,
+    0x80, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xBF,
+    0x40, 0x00, 0xBF, 0x80, 0x00, 0x4B, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x08, 0x88, 0x40, 0x00, 0x00, 0x48, 0x88,
+    0x88, 0x84, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0x40, 0x8F, 0x00, 0x00, 0x4B,
+    0xF4, 0x8F, 0x00, 0x00, 0x00, 0xF8, 0x8F, 0x00, 0x00, 0x00, 0xF8, 0x8F,
+    0x00, 0x00, 0x04, 0xF8, 0x8F, 0x88, 0x88, 0x8F, 0xB0, 0x8F, 0xFF, 0xFF,
+    0xFB, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00,
+    0x8F, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00,
+    0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88,
+    0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF,
+    0x80, 0x00, 0x4B, 0xF4, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x40,
+    0x0F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x8F, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0xF0, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x8F, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0xF0, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x0F,
+    0x80, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x0B, 0xF4, 0x00, 0x00, 0xFB, 0xBF,
+    0x40, 0x00, 0xBF, 0x80, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+    0xFF, 0xBF, 0x00, 0x00, 0x00, 0x08, 0x88, 0x40, 0x0B, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x48, 0x88, 0x88, 0x88, 0x00, 0x00, 0x8F,
+    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x8F, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0x8F, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0xBB, 0x00, 0x8F, 0x88, 0x88, 0x8B, 0xF4, 0x00, 0x8F,
+    0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x8F, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0x8F, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0x8F, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0x40, 0x48,
+    0x00, 0x00, 0x00, 0x48, 0x40, 0x00, 0x04, 0x88, 0x84, 0x00, 0x00, 0x00,
+    0xBF, 0xFF, 0xFF, 0xB0, 0x00, 0x08, 0xF8, 0x00, 0x08, 0xFB, 0x00, 0x0F,
+    0x80, 0x00, 0x00, 0x8F, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x88, 0x00, 0x00, 0x00,
+    0x04, 0x8B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 0x40, 0x48,
+    0x00, 0x00, 0x00, 0x0F, 0x80, 0x8F, 0x40, 0x00, 0x00, 0x0F, 0x80, 0x0F,
+    0xF4, 0x00, 0x04, 0xBF, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
+    0x04, 0x88, 0x84, 0x00, 0x00, 0x48, 0x88, 0x88, 0x88, 0x88, 0x8F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00,
+    0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x8F,
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00,
+    0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x8F, 0x00, 0x00, 0x00,
+    0x8F, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0x8F,
+    0x00, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00,
+    0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00, 0x8F,
+    0x8F, 0x00, 0x00, 0x00, 0x8F, 0x8F, 0x40, 0x00, 0x00, 0xBF, 0x0F, 0xF4,
+    0x00, 0x0B, 0xF8, 0x04, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x04, 0x88, 0x80,
+    0x00, 0x48, 0x00, 0x00, 0x00, 0x08, 0x80, 0x8F, 0x80, 0x00, 0x00, 0x0F,
+    0xB0, 0x0F, 0xB0, 0x00, 0x00, 0x8F, 0x80, 0x0B, 0xF0, 0x00, 0x00, 0xBF,
+    0x00, 0x04, 0xF8, 0x00, 0x00, 0xFB, 0x00, 0x00, 0xFB, 0x00, 0x04, 0xF4,
+    0x00, 0x00, 0x8F, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x4F, 0x80, 0x0F, 0x80,
+    0x00, 0x00, 0x0F, 0xB0, 0x4F, 0x40, 0x00, 0x00, 0x08, 0xF0, 0x8F, 0x00,
+    0x00, 0x00, 0x04, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xF4, 0x00,
+    0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0x00,
+    0x00, 0x48, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x88, 0x8F, 0x40, 0x00,
+    0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x4F, 0x80, 0x00, 0x4F, 0xF8, 0x00, 0x00,
+    0xF8, 0x0F, 0xB0, 0x00, 0x8F, 0xBF, 0x00, 0x08, 0xF8, 0x0B, 0xF0, 0x00,
+    0xBB, 0x8F, 0x00, 0x08, 0xF0, 0x08, 0xF0, 0x00, 0xF8, 0x0F, 0x80, 0x0F,
+    0xF0, 0x04, 0xF8, 0x08, 0xF4, 0x0F, 0x80, 0x0F, 0x80, 0x00, 0xF8, 0x08,
+    0xF0, 0x08, 0xF0, 0x4F, 0x80, 0x00, 0xBF, 0x0F, 0xB0, 0x04, 0xF4, 0x8F,
+    0x00, 0x00, 0x8F, 0x0F, 0x80, 0x00, 0xF8, 0x8F, 0x00, 0x00, 0x4F, 0xBF,
+    0x00, 0x00, 0xBB, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x8F, 0xF8,
+    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x04, 0x84,
+    0x00, 0x00, 0x08, 0x80, 0x00, 0x48, 0x40, 0x00, 0x00, 0x08, 0x80, 0x0B,
+    0xF4, 0x00, 0x00, 0x8F, 0x40, 0x04, 0xFB, 0x00, 0x04, 0xFB, 0x00, 0x00,
+    0x8F, 0x80, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x8F, 0x40, 0x00, 0x00,
+    0x04, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xF8, 0xFB, 0x00, 0x00, 0x00,
+    0x0F, 0xB0, 0x4F, 0x80, 0x00, 0x00, 0xBF, 0x40, 0x0B, 0xF4, 0x00, 0x04,
+    0xF8, 0x00, 0x00, 0xFB, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x8F, 0x80, 0x48,
+    0x40, 0x00, 0x00, 0x08, 0x80, 0x88, 0x00, 0x00, 0x00, 0x08, 0x80, 0x4F,
+    0xB0, 0x00, 0x00, 0x4F, 0xB0, 0x0B, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00,
+    0xFB, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x8F, 0x80, 0x0F, 0xB0, 0x00, 0x00,
+    0x0B, 0xF0, 0x8F, 0x40, 0x00, 0x00, 0x04, 0xF8, 0xFB, 0x00, 0x00, 0x00,
+    0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x40, 0x00, 0x00, 0x08, 0x88, 0x88, 0x88, 0x88, 0x0F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x00, 0x00, 0x0F,
+    0xF4, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00,
+    0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF4,
+    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x00, 0x00,
+    0x4F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x80, 0xFF, 0xF0, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+    0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+    0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFB, 0x80, 0xFF,
+    0xF0, 0x80, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x88, 0x00, 0x00, 0x0F, 0x00,
+    0x00, 0x0B, 0x40, 0x00, 0x08, 0x80, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xB0,
+    0x00, 0x00, 0x88, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x08,
+    0x80, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x80, 0x48, 0x84, 0x8F, 0xF8, 0x00,
+    0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+    0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+    0xF8, 0x48, 0xF8, 0x8F, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x04, 0xFF, 0x40,
+    0x00, 0x08, 0xB8, 0xB0, 0x00, 0x0F, 0x40, 0xF4, 0x00, 0x8F, 0x00, 0xB8,
+    0x00, 0xB8, 0x00, 0x4F, 0x00, 0x80, 0x00, 0x08, 0x40, 0x48, 0x88, 0x88,
+    0x88, 0x88, 0x80, 0x48, 0x88, 0x88, 0x88, 0x88, 0x80, 0x48, 0x40, 0x0B,
+    0xF0, 0x00, 0xBB, 0x00, 0x8F, 0xFF, 0xB0, 0x00, 0x0B, 0xF8, 0x88, 0xFB,
+    0x00, 0x08, 0x40, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00,
+    0x88, 0xBF, 0xFF, 0x00, 0x4F, 0xF8, 0x84, 0x8F, 0x00, 0x8F, 0x40, 0x00,
+    0x8F, 0x00, 0x8F, 0x40, 0x08, 0xFF, 0x00, 0x0B, 0xFF, 0xFB, 0x4F, 0xF0,
+    0x00, 0x88, 0x80, 0x08, 0x80, 0x84, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
+    0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x8F, 0xFB,
+    0x40, 0xFF, 0xF8, 0x8F, 0xF4, 0xFF, 0x40, 0x04, 0xF8, 0xF8, 0x00, 0x00,
+    0xBF, 0xF8, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x8F, 0xFB, 0x00, 0x00,
+    0xBB, 0xFF, 0xB0, 0x0B, 0xF4, 0xF8, 0xFF, 0xFF, 0xB0, 0x84, 0x08, 0x84,
+    0x00, 0x00, 0x8F, 0xFF, 0xB0, 0x00, 0x08, 0xFB, 0x88, 0xFB, 0x00, 0x0F,
+    0xB0, 0x00, 0x4F, 0x40, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00,
+    0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x0F, 0x80,
+    0x0F, 0xF4, 0x00, 0xBF, 0x00, 0x04, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x08,
+    0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x00, 0x08,
+    0xF0, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00,
+    0x8F, 0xFF, 0x88, 0xF0, 0x0B, 0xFB, 0x88, 0xFF, 0xF0, 0x0F, 0xB0, 0x00,
+    0x4F, 0xF0, 0x8F, 0x40, 0x00, 0x0B, 0xF0, 0x8F, 0x00, 0x00, 0x08, 0xF0,
+    0x8F, 0x00, 0x00, 0x08, 0xF0, 0x4F, 0x40, 0x00, 0x0B, 0xF0, 0x0F, 0xF4,
+    0x00, 0xBF, 0xF0, 0x04, 0xFF, 0xFF, 0xF4, 0xF0, 0x00, 0x08, 0x88, 0x00,
+    0x80, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x0B, 0xFB, 0x88, 0xFB, 0x00, 0x0F,
+    0x40, 0x00, 0x4F, 0x00, 0x8F, 0x88, 0x88, 0x8F, 0x80, 0x8F, 0xFF, 0xFF,
+    0xFF, 0x80, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x08, 0x40,
+    0x0B, 0xF4, 0x00, 0xBF, 0x00, 0x04, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x08,
+    0x88, 0x00, 0x00, 0x00, 0x48, 0x04, 0xFF, 0x08, 0xF0, 0x08, 0xF0, 0x8F,
+    0xFF, 0x4B, 0xF8, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08,
+    0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x04, 0x80, 0x00, 0x8F, 0xFB, 0x4F, 0x80,
+    0x08, 0xFB, 0x8B, 0xFF, 0x80, 0x0F, 0xB0, 0x00, 0x8F, 0x80, 0x8F, 0x00,
+    0x00, 0x0F, 0x80, 0x8F, 0x00, 0x00, 0x0F, 0x80, 0x8F, 0x00, 0x00, 0x0F,
+    0x80, 0x4F, 0x40, 0x00, 0x4F, 0x80, 0x0F, 0xF4, 0x04, 0xBF, 0x80, 0x04,
+    0xFF, 0xFF, 0x4F, 0x80, 0x00, 0x08, 0x84, 0x0F, 0x80, 0x00, 0x00, 0x00,
+    0x4F, 0x40, 0x0F, 0xB0, 0x00, 0xBF, 0x00, 0x04, 0xFF, 0xFF, 0xF4, 0x00,
+    0x00, 0x08, 0x88, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
+    0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x4F, 0xFF,
+    0x80, 0xFB, 0xF8, 0x8F, 0xF4, 0xFF, 0x40, 0x04, 0xF8, 0xF8, 0x00, 0x00,
+    0xF8, 0xF8, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00,
+    0xF8, 0xF8, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0xF8, 0x84, 0x00, 0x00,
+    0x84, 0x84, 0xF8, 0x84, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+    0xF8, 0xF8, 0x84, 0x04, 0x80, 0x08, 0xF0, 0x04, 0x80, 0x00, 0x00, 0x08,
+    0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08,
+    0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x0B, 0xF0, 0xFF,
+    0xB0, 0x88, 0x00, 0x84, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8,
+    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x4F, 0xB0, 0xF8,
+    0x04, 0xFB, 0x00, 0xF8, 0x4F, 0xB0, 0x00, 0xF8, 0xFF, 0x40, 0x00, 0xFF,
+    0xBF, 0xB0, 0x00, 0xFB, 0x04, 0xF8, 0x00, 0xF8, 0x00, 0xBF, 0x00, 0xF8,
+    0x00, 0x4F, 0xB0, 0xF8, 0x00, 0x08, 0xF4, 0x84, 0x00, 0x00, 0x84, 0x84,
+    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+    0x84, 0xF8, 0x4F, 0xFB, 0x04, 0xFF, 0xB4, 0xFB, 0xB8, 0xBF, 0xBF, 0x88,
+    0xFB, 0xFF, 0x00, 0x0B, 0xF4, 0x00, 0x8F, 0xF8, 0x00, 0x08, 0xF0, 0x00,
+    0x8F, 0xF8, 0x00, 0x08, 0xF0, 0x00, 0x8F, 0xF8, 0x00, 0x08, 0xF0, 0x00,
+    0x8F, 0xF8, 0x00, 0x08, 0xF0, 0x00, 0x8F, 0xF8, 0x00, 0x08, 0xF0, 0x00,
+    0x8F, 0xF8, 0x00, 0x08, 0xF0, 0x00, 0x8F, 0x84, 0x00, 0x04, 0x80, 0x00,
+    0x48, 0xF8, 0x4F, 0xFF, 0x80, 0xFB, 0xF8, 0x8F, 0xF4, 0xFF, 0x40, 0x04,
+    0xF8, 0xF8, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00,
+    0xF8, 0xF8, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00,
+    0xF8, 0x84, 0x00, 0x00, 0x84, 0x00, 0x8F, 0xFF, 0xB4, 0x00, 0x08, 0xFB,
+    0x88, 0xFF, 0x00, 0x0F, 0xB0, 0x00, 0x4F, 0x80, 0x8F, 0x00, 0x00, 0x0B,
+    0xF0, 0x8F, 0x00, 0x00, 0x08, 0xF0, 0x8F, 0x00, 0x00, 0x08, 0xF0, 0x4F,
+    0x40, 0x00, 0x0B, 0xB0, 0x0B, 0xF4, 0x00, 0xBF, 0x40, 0x04, 0xFF, 0xFF,
+    0xFB, 0x00, 0x00, 0x08, 0x88, 0x40, 0x00, 0xF8, 0x4F, 0xFB, 0x40, 0xFB,
+    0xF8, 0x8F, 0xF4, 0xFF, 0x40, 0x04, 0xF8, 0xF8, 0x00, 0x00, 0xBF, 0xF8,
+    0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x8F, 0xFB, 0x00, 0x00, 0xBB, 0xFF,
+    0xB0, 0x0B, 0xF8, 0xFB, 0xFF, 0xFF, 0xB0, 0xF8, 0x08, 0x84, 0x00, 0xF8,
+    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00,
+    0x8F, 0xFF, 0x80, 0xF0, 0x08, 0xFB, 0x88, 0xFB, 0xF0, 0x0F, 0xB0, 0x00,
+    0x4F, 0xF0, 0x8F, 0x40, 0x00, 0x0B, 0xF0, 0x8F, 0x00, 0x00, 0x08, 0xF0,
+    0x8F, 0x00, 0x00, 0x08, 0xF0, 0x4F, 0x40, 0x00, 0x0B, 0xF0, 0x0F, 0xF4,
+    0x00, 0xBF, 0xF0, 0x04, 0xFF, 0xFF, 0xFB, 0xF0, 0x00, 0x08, 0x88, 0x08,
+    0xF0, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00,
+    0x00, 0x00, 0x04, 0x80, 0xF8, 0x8F, 0x80, 0xFB, 0xF8, 0x40, 0xFF, 0x00,
+    0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00,
+    0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x84, 0x00, 0x00, 0x08, 0xFF,
+    0xF4, 0x00, 0xBF, 0x88, 0xBF, 0x40, 0xF8, 0x00, 0x08, 0x40, 0xFB, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0x84, 0x00, 0x00, 0x8B, 0xFF, 0xB0, 0x84, 0x00,
+    0x0B, 0xF0, 0xFB, 0x00, 0x4B, 0xF0, 0x4F, 0xFF, 0xFF, 0x40, 0x04, 0x88,
+    0x80, 0x00, 0x08, 0xF0, 0x08, 0xF0, 0x8F, 0xFF, 0x4B, 0xF8, 0x08, 0xF0,
+    0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xFF,
+    0x00, 0x88, 0xF8, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0xF8, 0xF8, 0x00,
+    0x00, 0xF8, 0xF8, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0xF8, 0xF8, 0x00,
+    0x00, 0xF8, 0xF8, 0x00, 0x04, 0xF8, 0xFF, 0x40, 0x4F, 0xF8, 0x8F, 0xFF,
+    0xF4, 0xF8, 0x04, 0x88, 0x40, 0x84, 0x8F, 0x00, 0x00, 0x4F, 0x40, 0x4F,
+    0x40, 0x00, 0x8F, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x08, 0xF0, 0x04,
+    0xF4, 0x00, 0x04, 0xF4, 0x08, 0xF0, 0x00, 0x00, 0xF8, 0x0F, 0x80, 0x00,
+    0x00, 0x8F, 0x8F, 0x00, 0x00, 0x00, 0x4F, 0xBB, 0x00, 0x00, 0x00, 0x0F,
+    0xF8, 0x00, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x0B, 0xF4,
+    0x00, 0x4F, 0x80, 0x8F, 0x00, 0x0F, 0xF8, 0x00, 0x8F, 0x00, 0x4F, 0x80,
+    0x4F, 0xBB, 0x00, 0xBB, 0x00, 0x0F, 0x80, 0x8F, 0x8F, 0x00, 0xF8, 0x00,
+    0x08, 0xF0, 0xB8, 0x0F, 0x44, 0xF4, 0x00, 0x08, 0xF0, 0xF8, 0x0F, 0x88,
+    0xF0, 0x00, 0x00, 0xFB, 0xF0, 0x08, 0xBB, 0x80, 0x00, 0x00, 0xBF, 0xF0,
+    0x08, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x48, 0x40, 0x00, 0x88, 0x00, 0x00, 0x4F, 0x40, 0x00, 0xBB, 0x0B, 0xF0,
+    0x08, 0xF0, 0x00, 0xFB, 0x4F, 0x40, 0x00, 0x4F, 0xBB, 0x00, 0x00, 0x0B,
+    0xF0, 0x00, 0x00, 0x4F, 0xF8, 0x00, 0x00, 0xBB, 0x8F, 0x40, 0x08, 0xF4,
+    0x0B, 0xB0, 0x4F, 0x80, 0x04, 0xF8, 0x48, 0x00, 0x00, 0x48, 0x8F, 0x00,
+    0x00, 0x8F, 0x4F, 0x40, 0x00, 0xBB, 0x0F, 0x80, 0x00, 0xF8, 0x08, 0xF0,
+    0x08, 0xF0, 0x04, 0xF4, 0x0F, 0xB0, 0x00, 0xF8, 0x4F, 0x40, 0x00, 0x8F,
+    0x8F, 0x00, 0x00, 0x4F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x08,
+    0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x0F, 0xFB,
+    0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x08, 0x88,
+    0x88, 0xF8, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0B,
+    0xF4, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x04, 0xFB, 0x00, 0x00, 0x4F, 0xB0,
+    0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0x48, 0x88, 0x88, 0x88, 0x00, 0x08,
+    0x40, 0x00, 0xBF, 0x80, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8,
+    0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x04, 0xF4, 0x00, 0x8F, 0x80,
+    0x00, 0x4B, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8,
+    0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFB, 0x40, 0x00, 0x4F,
+    0x80, 0x44, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x48, 0x00, 0x00, 0x8F, 0xB0, 0x00,
+    0x08, 0xF0, 0x00, 0x08, 0xF0, 0x00, 0x08, 0xF0, 0x00, 0x08, 0xF0, 0x00,
+    0x08, 0xF0, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x8F, 0x80, 0x00, 0xFB, 0x40,
+    0x08, 0xF0, 0x00, 0x08, 0xF0, 0x00, 0x08, 0xF0, 0x00, 0x08, 0xF0, 0x00,
+    0x08, 0xF0, 0x00, 0x4B, 0xF0, 0x00, 0x8F, 0x40, 0x00, 0x04, 0x80, 0x00,
+    0x00, 0x4F, 0xFF, 0x40, 0x08, 0x8B, 0x08, 0xFB, 0x8F, 0x00, 0x00, 0x4F,
+    0xF4
+};
+
+const AAGlyph FreeSans9pt7bAAGlyphs[] PROGMEM = {
+    {0, 0, 0, 4, 0, 0},        // 0x20 ' '
+    {0, 2, 14, 6, 2, -13},     // 0x21 '!'
+    {14, 5, 5, 6, 0, -12},     // 0x22 '"'
+    {29, 10, 13, 10, 0, -12},  // 0x23 '#'
+    {94, 8, 15, 10, 1, -13},   // 0x24 '$'
+    {154, 15, 13, 16, 0, -12}, // 0x25 '%'
+    {258, 10, 13, 12, 1, -12}, // 0x26 '&'
+    {323, 2, 5, 4, 1, -12},    // 0x27 '''
+    {328, 5, 17, 6, 1, -13},   // 0x28 '('
+    {379, 5, 17, 6, 0, -13},   // 0x29 ')'
+    {430, 5, 6, 7, 1, -13},    // 0x2A '*'
+    {448, 8, 9, 10, 1, -8},    // 0x2B '+'
+    {484, 2, 5, 5, 1, -2},     // 0x2C ','
+    {489, 4, 2, 6, 1, -5},     // 0x2D '-'
+    {493, 2, 3, 4, 1, -2},     // 0x2E '.'
+    {496, 5, 14, 5, 0, -13},   // 0x2F '/'
+    {538, 8, 13, 10, 1, -12},  // 0x30 '0'
+    {590, 4, 13, 10, 2, -12},  // 0x31 '1'
+    {616, 8, 13, 10, 1, -12},  // 0x32 '2'
+    {668, 9, 13, 10, 0, -12},  // 0x33 '3'
+    {733, 9, 13, 10, 0, -12},  // 0x34 '4'
+    {798, 9, 13, 10, 0, -12},  // 0x35 '5'
+    {863, 8, 13, 10, 1, -12},  // 0x36 '6'
+    {915, 8, 13, 10, 1, -12},  // 0x37 '7'
+    {967, 9, 13, 10, 0, -12},  // 0x38 '8'
+    {1032, 9, 13, 10, 0, -12}, // 0x39 '9'
+    {1097, 2, 10, 4, 1, -9},   // 0x3A ':'
+    {1107, 2, 12, 4, 1, -9},   // 0x3B ';'
+    {1119, 9, 9, 10, 1, -8},   // 0x3C '<'
+    {1164, 9, 5, 10, 1, -6},   // 0x3D '='
+    {1189, 9, 9, 10, 1, -8},   // 0x3E '>'
+    {1234, 8, 14, 10, 1, -13}, // 0x3F '?'
+    {1290, 17, 16, 18, 0, -13}, // 0x40 '@'
+    {1434, 12, 14, 12, 0, -13}, // 0x41 'A'
+    {1518, 10, 14, 12, 1, -13}, // 0x42 'B'
+    {1588, 12, 14, 12, 0, -13}, // 0x43 'C'
+    {1672, 11, 14, 12, 1, -13}, // 0x44 'D'
+    {1756, 10, 14, 11, 1, -13}, // 0x45 'E'
+    {1826, 9, 14, 10, 1, -13}, // 0x46 'F'
+    {1896, 13, 14, 14, 0, -13}, // 0x47 'G'
+    {1994, 10, 14, 12, 1, -13}, // 0x48 'H'
+    {2064, 2, 14, 5, 2, -13},  // 0x49 'I'
+    {2078, 8, 14, 9, 0, -13},  // 0x4A 'J'
+    {2134, 11, 14, 12, 1, -13}, // 0x4B 'K'
+    {2218, 8, 14, 10, 1, -13}, // 0x4C 'L'
+    {2274, 13, 14, 15, 1, -13}, // 0x4D 'M'
+    {2372, 11, 14, 13, 1, -13}, // 0x4E 'N'
+    {2456, 13, 14, 14, 0, -13}, // 0x4F 'O'
+    {2554, 10, 14, 12, 1, -13}, // 0x50 'P'
+    {2624, 13, 15, 14, 0, -13}, // 0x51 'Q'
+    {2729, 11, 14, 12, 1, -13}, // 0x52 'R'
+    {2813, 11, 14, 12, 0, -13}, // 0x53 'S'
+    {2897, 10, 14, 11, 0, -13}, // 0x54 'T'
+    {2967, 10, 14, 12, 1, -13}, // 0x55 'U'
+    {3037, 11, 14, 12, 0, -13}, // 0x56 'V'
+    {3121, 16, 14, 16, 0, -13}, // 0x57 'W'
+    {3233, 11, 14, 12, 0, -13}, // 0x58 'X'
+    {3317, 11, 14, 12, 0, -13}, // 0x59 'Y'
+    {3401, 10, 14, 11, 0, -13}, // 0x5A 'Z'
+    {3471, 3, 17, 5, 1, -13},  // 0x5B '['
+    {3505, 5, 14, 5, 0, -13},  // 0x5C '\'
+    {3547, 4, 17, 5, 0, -13},  // 0x5D ']'
+    {3581, 7, 7, 8, 1, -12},   // 0x5E '^'
+    {3609, 11, 2, 10, -1, 2},  // 0x5F '_'
+    {3621, 4, 3, 4, 0, -13},   // 0x60 '`'
+    {3627, 9, 10, 10, 0, -9},  // 0x61 'a'
+    {3677, 8, 14, 10, 1, -13}, // 0x62 'b'
+    {3733, 9, 10, 9, 0, -9},   // 0x63 'c'
+    {3783, 9, 14, 10, 0, -13}, // 0x64 'd'
+    {3853, 9, 10, 10, 0, -9},  // 0x65 'e'
+    {3903, 4, 14, 5, 0, -13},  // 0x66 'f'
+    {3931, 9, 14, 10, 0, -9},  // 0x67 'g'
+    {4001, 8, 14, 10, 1, -13}, // 0x68 'h'
+    {4057, 2, 14, 4, 1, -13},  // 0x69 'i'
+    {4071, 3, 18, 4, 0, -13},  // 0x6A 'j'
+    {4107, 8, 14, 9, 1, -13},  // 0x6B 'k'
+    {4163, 2, 14, 4, 1, -13},  // 0x6C 'l'
+    {4177, 12, 10, 14, 1, -9}, // 0x6D 'm'
+    {4237, 8, 10, 10, 1, -9},  // 0x6E 'n'
+    {4277, 9, 10, 10, 0, -9},  // 0x6F 'o'
+    {4327, 8, 13, 10, 1, -9},  // 0x70 'p'
+    {4379, 9, 13, 10, 0, -9},  // 0x71 'q'
+    {4444, 5, 10, 6, 1, -9},   // 0x72 'r'
+    {4474, 7, 10, 8, 1, -9},   // 0x73 's'
+    {4514, 4, 12, 5, 0, -11},  // 0x74 't'
+    {4538, 8, 10, 10, 1, -9},  // 0x75 'u'
+    {4578, 9, 10, 8, 0, -9},   // 0x76 'v'
+    {4628, 13, 10, 12, 0, -9}, // 0x77 'w'
+    {4698, 8, 10, 8, 0, -9},   // 0x78 'x'
+    {4738, 8, 14, 8, 0, -9},   // 0x79 'y'
+    {4794, 8, 10, 8, 0, -9},   // 0x7A 'z'
+    {4834, 5, 17, 6, 0, -13},  // 0x7B '{'
+    {4885, 2, 17, 4, 1, -13},  // 0x7C '|'
+    {4902, 5, 17, 6, 1, -13},  // 0x7D '}'
+    {4953, 8, 4, 9, 0, -8}};   // 0x7E '~'
+
+const AAFont FreeSans9pt7bAA PROGMEM = {(uint8_t *)FreeSans9pt7bAABitmaps,
+                                       (AAGlyph *)FreeSans9pt7bAAGlyphs, 0x20,
+                                       0x7E, 21};
+
+// Approx. 6119 bytes
@@ -0,0 +1,157 @@
+#include "aa_glyph_cache.h"
+#include "color_blend.h"
+#include "esp_heap_caps.h"
+
+AAGlyphCache::AAGlyphCache() :
+    entries(nullptr),
+    pool(nullptr),
+    pool_used(0),
+    hits(0),
+    misses(0) {
+}
+
+AAGlyphCache::~AAGlyphCache() {
+    heap_caps_free(entries);
+    heap_caps_free(pool);
+}
+
+bool AAGlyphCache::begin() {
+    if (entries) return true;
+
+    entries = (BlendedGlyph*)heap_caps_calloc(AA_CACHE_ENTRIES, sizeof(BlendedGlyph),
+                                              MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    pool = (uint8_t*)heap_caps_malloc(AA_CACHE_POOL_SIZE, MALLOC_CAP_SPIRAM);
+
+    if (!entries || !pool) {
+        heap_caps_free(entries);
+        heap_caps_free(pool);
+        entries = nullptr;
+        pool = nullptr;
+        return false;
+    }
+
+    clear();
+    return true;
+}
+
+const BlendedGlyph* AAGlyphCache::get(const AAFont* font, char c, uint16_t fg, uint16_t bg) {
+    return lookup(font, c, fg, bg, 1);
+}
+
+const BlendedGlyph* AAGlyphCache::getCoverage(const AAFont* font, char c, uint16_t fg) {
+    return lookup(font, c, fg, 0, 0);
+}
+
+void AAGlyphCache::clear() {
+    if (entries) {
+        memset(entries, 0, sizeof(BlendedGlyph) * AA_CACHE_ENTRIES);
+    }
+    pool_used = 0;
+}
+
+// Private implementation functions
+const BlendedGlyph* AAGlyphCache::lookup(const AAFont* font, char c, uint16_t fg, uint16_t bg, uint8_t blended) {
+    if (!entries || !font) return nullptr;
+
+    uint8_t code = (uint8_t)c;
+    if (code < font->first || code > font->last) code = '?';
+
+    uint32_t key = (uint32_t)(uintptr_t)font;
+    uint32_t idx = ((key >> 2) ^ (code * 31u) ^ (fg * 3u) ^ (bg * 7u) ^ blended) & (AA_CACHE_ENTRIES - 1);
+    BlendedGlyph* entry = &entries[idx];
+
+    if (entry->font == font && entry->code == code && entry->blended == blended &&
+        entry->fg == fg && entry->bg == bg) {
+        hits++;
+        return entry;
+    }
+
+    // Slot is empty or holds another glyph - replace it
+    misses++;
+    if (!build(entry, font, code, fg, bg, blended)) {
+        // Pool exhausted: start over and retry once
+        clear();
+        entry = &entries[idx];
+        if (!build(entry, font, code, fg, bg, blended)) return nullptr;
+    }
+    return entry;
+}
+
+void* AAGlyphCache::allocate(uint32_t bytes) {
+    bytes = (bytes + 3) & ~3u;
+    if (pool_used + bytes > AA_CACHE_POOL_SIZE) return nullptr;
+
+    void* ptr = pool + pool_used;
+    pool_used += bytes;
+    return ptr;
+}
+
+bool AAGlyphCache::build(BlendedGlyph* entry, const AAFont* font, uint8_t code, uint16_t fg, uint16_t bg, uint8_t blended) {
+    const AAGlyph* glyph = &font->glyph[code - font->first];
+    const uint8_t* bitmap = font->bitmap + glyph->bitmapOffset;
+    uint8_t w = glyph->width;
+    uint8_t h = glyph->height;
+    uint16_t row_bytes = (w + 1) / 2;
+
+    // Pass 1: count runs and edge pixels
+    uint16_t run_count = 0;
+    uint16_t color_count = 0;
+    for (uint8_t yy = 0; yy < h; yy++) {
+        const uint8_t* row = bitmap + yy * row_bytes;
+        int8_t prev = -1;  // -1 none, 0 blended, 1 solid
+        for (uint8_t xx = 0; xx < w; xx++) {
+            uint8_t cov = (row[xx >> 1] >> ((xx & 1) ? 0 : 4)) & 0x0F;
+            int8_t kind = (cov == 0) ? -1 : (cov == 15) ? 1 : 0;
+            if (kind >= 0 && (kind != prev)) run_count++;
+            if (kind == 0) color_count++;
+            prev = kind;
+        }
+    }
+
+    AARun* runs = (AARun*)allocate(run_count * sizeof(AARun));
+    uint16_t* colors = (uint16_t*)allocate(color_count * sizeof(uint16_t));
+    if ((run_count && !runs) || (color_count && !colors)) {
+        entry->font = nullptr;
+        return false;
+    }
+
+    // Pass 2: emit runs and pre-blended colours
+    AARun* run = nullptr;
+    uint16_t r = 0, c = 0;
+    for (uint8_t yy = 0; yy < h; yy++) {
+        const uint8_t* row = bitmap + yy * row_bytes;
+        int8_t prev = -1;
+        for (uint8_t xx = 0; xx < w; xx++) {
+            uint8_t cov = (row[xx >> 1] >> ((xx & 1) ? 0 : 4)) & 0x0F;
+            int8_t kind = (cov == 0) ? -1 : (cov == 15) ? 1 : 0;
+            if (kind >= 0) {
+                if (kind != prev) {
+                    run = &runs[r++];
+                    run->y = yy;
+                    run->x = xx;
+                    run->len = 0;
+                    run->solid = (uint8_t)kind;
+                }
+                run->len++;
+                if (kind == 0) {
+                    colors[c++] = blended ? blendRGB565_4bit(fg, bg, cov) : coverage4_to_alpha32[cov];
+                }
+            }
+            prev = kind;
+        }
+    }
+
+    entry->font = font;
+    entry->code = code;
+    entry->blended = blended;
+    entry->fg = fg;
+    entry->bg = bg;
+    entry->x_offset = glyph->xOffset;
+    entry->y_offset = glyph->yOffset;
+    entry->width = w;
+    entry->height = h;
+    entry->run_count = run_count;
+    entry->runs = runs;
+    entry->colors = colors;
+    return true;
+}
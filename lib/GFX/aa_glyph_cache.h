@@ -0,0 +1,73 @@
+#pragma once
+#include <Arduino.h>
+#include "font_manager.h"
+
+// Cache configuration
+#define AA_CACHE_ENTRIES     128           // Direct-mapped slots
+#define AA_CACHE_POOL_SIZE   (32 * 1024)   // Run and colour storage in PSRAM
+
+// One horizontal run inside a pre-blended glyph
+// Solid runs are filled with the foreground colour; blended runs copy
+// 'len' colours from the glyph's colour array.
+struct AARun {
+    uint8_t y;
+    uint8_t x;
+    uint8_t len;
+    uint8_t solid;
+};
+
+// Glyph pre-blended for one foreground/background pair
+// Without a known background ('blended' == 0) the colour array holds the
+// 0..32 blend weights instead, applied against the frame buffer at draw time.
+struct BlendedGlyph {
+    const AAFont* font;
+    uint8_t code;
+    uint8_t blended;
+    uint16_t fg;
+    uint16_t bg;
+    int8_t x_offset;          // Cursor to top-left of bounding box
+    int8_t y_offset;
+    uint8_t width;
+    uint8_t height;
+    uint16_t run_count;
+    const AARun* runs;
+    const uint16_t* colors;   // Edge pixels (colours or weights), consumed in run order
+};
+
+// Pre-blended anti-aliased glyph cache
+// Text on a known background (labels, readouts) is blended once per
+// (glyph, fg, bg) and then drawn as plain fills and copies. When the pool
+// fills up the whole cache is dropped and rebuilt on demand.
+class AAGlyphCache {
+private:
+    BlendedGlyph* entries;
+    uint8_t* pool;
+    uint32_t pool_used;
+
+    // Statistics
+    uint32_t hits;
+    uint32_t misses;
+
+public:
+    AAGlyphCache();
+    ~AAGlyphCache();
+
+    bool begin();
+    bool isReady() const { return entries != nullptr; }
+
+    // Lookup (blends the glyph on first use, nullptr if it cannot be cached)
+    const BlendedGlyph* get(const AAFont* font, char c, uint16_t fg, uint16_t bg);
+    const BlendedGlyph* getCoverage(const AAFont* font, char c, uint16_t fg);
+
+    void clear();
+
+    // Statistics
+    uint32_t getPoolUsed() const { return pool_used; }
+    uint32_t getHits() const { return hits; }
+    uint32_t getMisses() const { return misses; }
+
+private:
+    const BlendedGlyph* lookup(const AAFont* font, char c, uint16_t fg, uint16_t bg, uint8_t blended);
+    void* allocate(uint32_t bytes);
+    bool build(BlendedGlyph* entry, const AAFont* font, uint8_t code, uint16_t fg, uint16_t bg, uint8_t blended);
+};
@@ -0,0 +1,224 @@
+#include "blit_engine.h"
+
+#ifdef ESP_PLATFORM
+#if __has_include("esp_memory_utils.h")
+#include "esp_memory_utils.h"
+#else
+#include "soc/soc_memory_layout.h"
+#endif
+#if CONFIG_IDF_TARGET_ESP32S3
+#include "esp32s3/rom/cache.h"
+#endif
+
+static portMUX_TYPE blit_lock = portMUX_INITIALIZER_UNLOCKED;
+#endif
+
+BlitEngine::BlitEngine() :
+#ifdef ESP_PLATFORM
+    driver(nullptr),
+    idle(nullptr),
+#endif
+    dma_ready(false),
+    jobs_active(0) {
+    memset(jobs, 0, sizeof(jobs));
+    memset(&stats, 0, sizeof(stats));
+}
+
+BlitEngine::~BlitEngine() {
+#ifdef ESP_PLATFORM
+    if (dma_ready) {
+        wait();
+        esp_async_memcpy_uninstall(driver);
+    }
+    if (idle) vSemaphoreDelete(idle);
+#endif
+}
+
+bool BlitEngine::begin() {
+    if (dma_ready) return true;
+
+#ifdef ESP_PLATFORM
+    if (!idle) {
+        idle = xSemaphoreCreateBinary();
+        if (!idle) return false;
+    }
+
+    async_memcpy_config_t config = ASYNC_MEMCPY_DEFAULT_CONFIG();
+    config.backlog = BLIT_DMA_BACKLOG;
+    config.psram_trans_align = BLIT_DMA_ALIGN;
+    if (esp_async_memcpy_install(&config, &driver) != ESP_OK) {
+        Serial.println("GDMA memcpy unavailable - blits use the CPU");
+        return false;
+    }
+    dma_ready = true;
+#endif
+    return dma_ready;
+}
+
+bool BlitEngine::copyRect(uint16_t* dst, int32_t dst_stride, const uint16_t* src, int32_t src_stride,
+                          int16_t w, int16_t h, BlitCallback callback, void* arg) {
+    if (!dst || !src || w <= 0 || h <= 0) {
+        if (callback) callback(arg);
+        return false;
+    }
+
+    uint32_t row_bytes = w * sizeof(uint16_t);
+    uint32_t total_bytes = row_bytes * h;
+
+#ifdef ESP_PLATFORM
+    BlitJob* job = canUseDMA(dst, dst_stride * 2, src, src_stride * 2, row_bytes, total_bytes) ? allocJob() : nullptr;
+    if (job) {
+        // Contiguous blocks go as one transfer, otherwise one per row
+        bool contiguous = dst_stride == w && src_stride == w;
+        uint16_t transfers = contiguous ? 1 : h;
+        uint32_t transfer_bytes = contiguous ? total_bytes : row_bytes;
+        uint16_t rows_per_transfer = contiguous ? h : 1;
+
+        job->busy = true;
+        job->engine = this;
+        job->callback = callback;
+        job->arg = arg;
+        job->dst = (uint8_t*)dst;
+        job->dst_stride_bytes = dst_stride * 2;
+        job->row_bytes = row_bytes;
+        job->rows = h;
+        job->pending = transfers + 1;    // Held until queueing is finished
+        portENTER_CRITICAL(&blit_lock);
+        jobs_active++;
+        portEXIT_CRITICAL(&blit_lock);
+
+#if CONFIG_IDF_TARGET_ESP32S3
+        // DMA reads memory, not the cache: flush the source, and drop
+        // destination lines so no stale write-back lands on the new pixels
+        for (int16_t row = 0; row < h; row++) {
+            if (esp_ptr_external_ram(src)) Cache_WriteBack_Addr((uint32_t)(uintptr_t)(src + row * src_stride), row_bytes);
+            if (esp_ptr_external_ram(dst)) Cache_Invalidate_Addr((uint32_t)(uintptr_t)(dst + row * dst_stride), row_bytes);
+        }
+#endif
+
+        uint16_t queued = 0;
+        for (; queued < transfers; queued++) {
+            if (esp_async_memcpy(driver, dst + queued * dst_stride, (void*)(src + queued * src_stride),
+                                 transfer_bytes, onRowDone, job) != ESP_OK) {
+                break;
+            }
+        }
+
+        // Driver out of descriptors: the rest goes through the CPU
+        uint16_t dma_rows = queued * rows_per_transfer;
+        job->rows = dma_rows;
+        if (dma_rows < h) {
+            copyCPU(dst + dma_rows * dst_stride, dst_stride, src + dma_rows * src_stride, src_stride, w, h - dma_rows);
+            portENTER_CRITICAL(&blit_lock);
+            job->pending -= transfers - queued;
+            portEXIT_CRITICAL(&blit_lock);
+            stats.cpu_bytes += (h - dma_rows) * row_bytes;
+        }
+        if (queued) {
+            stats.dma_copies++;
+            stats.dma_bytes += dma_rows * row_bytes;
+        } else {
+            stats.cpu_copies++;
+        }
+
+        finishRow(job);
+        return queued > 0;
+    }
+#endif
+
+    copyCPU(dst, dst_stride, src, src_stride, w, h);
+    stats.cpu_copies++;
+    stats.cpu_bytes += total_bytes;
+    if (callback) callback(arg);
+    return false;
+}
+
+void BlitEngine::wait() {
+#ifdef ESP_PLATFORM
+    while (jobs_active) {
+        xSemaphoreTake(idle, pdMS_TO_TICKS(5));
+    }
+#endif
+}
+
+// Private implementation functions
+bool BlitEngine::canUseDMA(const void* dst, int32_t dst_stride_bytes, const void* src, int32_t src_stride_bytes,
+                           uint32_t row_bytes, uint32_t total_bytes) const {
+#ifdef ESP_PLATFORM
+    if (!dma_ready || total_bytes < BLIT_DMA_MIN_BYTES) return false;
+
+    // GDMA reaches internal SRAM and PSRAM, never memory-mapped flash
+    if (!esp_ptr_dma_capable(src) && !esp_ptr_external_ram(src)) return false;
+    if (!esp_ptr_dma_capable(dst) && !esp_ptr_external_ram(dst)) return false;
+
+    uint32_t bits = (uintptr_t)dst | (uintptr_t)src | dst_stride_bytes | src_stride_bytes | row_bytes;
+    return (bits & (BLIT_DMA_ALIGN - 1)) == 0;
+#else
+    (void)dst;
+    (void)dst_stride_bytes;
+    (void)src;
+    (void)src_stride_bytes;
+    (void)row_bytes;
+    (void)total_bytes;
+    return false;
+#endif
+}
+
+void BlitEngine::copyCPU(uint16_t* dst, int32_t dst_stride, const uint16_t* src, int32_t src_stride, int16_t w, int16_t h) {
+    if (dst_stride == w && src_stride == w) {
+        memcpy(dst, src, w * h * sizeof(uint16_t));
+        return;
+    }
+    for (int16_t row = 0; row < h; row++) {
+        memcpy(dst, src, w * sizeof(uint16_t));
+        dst += dst_stride;
+        src += src_stride;
+    }
+}
+
+#ifdef ESP_PLATFORM
+BlitEngine::BlitJob* BlitEngine::allocJob() {
+    for (uint8_t i = 0; i < BLIT_MAX_JOBS; i++) {
+        if (!jobs[i].busy) return &jobs[i];
+    }
+    return nullptr;
+}
+
+// One transfer of a job finished (ISR or task); returns true if a task was woken
+bool IRAM_ATTR BlitEngine::finishRow(BlitJob* job) {
+    portENTER_CRITICAL_SAFE(&blit_lock);
+    bool done = (--job->pending == 0);
+    portEXIT_CRITICAL_SAFE(&blit_lock);
+    if (!done) return false;
+
+#if CONFIG_IDF_TARGET_ESP32S3
+    // Lines the CPU may have fetched while the DMA was writing
+    if (esp_ptr_external_ram(job->dst)) {
+        for (uint16_t row = 0; row < job->rows; row++) {
+            Cache_Invalidate_Addr((uint32_t)(uintptr_t)(job->dst + row * job->dst_stride_bytes), job->row_bytes);
+        }
+    }
+#endif
+    if (job->callback) job->callback(job->arg);
+
+    BlitEngine* engine = job->engine;
+    portENTER_CRITICAL_SAFE(&blit_lock);
+    job->busy = false;                   // Slot can be reused
+    bool idle_now = (--engine->jobs_active == 0);
+    portEXIT_CRITICAL_SAFE(&blit_lock);
+
+    BaseType_t woken = pdFALSE;
+    if (idle_now) {
+        if (xPortInIsrContext()) {
+            xSemaphoreGiveFromISR(engine->idle, &woken);
+        } else {
+            xSemaphoreGive(engine->idle);
+        }
+    }
+    return woken == pdTRUE;
+}
+
+bool IRAM_ATTR BlitEngine::onRowDone(async_memcpy_t driver, async_memcpy_event_t* event, void* arg) {
+    return finishRow((BlitJob*)arg);
+}
+#endif
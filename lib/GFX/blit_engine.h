@@ -0,0 +1,86 @@
+#pragma once
+#include <Arduino.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_async_memcpy.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#endif
+
+// Blit configuration
+#define BLIT_MAX_JOBS           4          // Rectangles in flight
+#define BLIT_DMA_BACKLOG        256        // DMA descriptors (4095 bytes each) in flight
+#define BLIT_DMA_ALIGN          64         // Address/size alignment for PSRAM DMA (cache line)
+#define BLIT_DMA_MIN_BYTES      4096       // Smaller copies are faster on the CPU
+
+// Called once every row of a copy has landed (from the DMA ISR for async copies)
+typedef void (*BlitCallback)(void* arg);
+
+struct BlitStats {
+    uint32_t dma_copies;      // Rectangles handed to GDMA
+    uint32_t cpu_copies;      // Rectangles copied with memcpy
+    uint32_t dma_bytes;
+    uint32_t cpu_bytes;
+};
+
+// Memory-to-memory copy engine
+// Large copies between DMA-reachable buffers (internal SRAM or PSRAM, with
+// 64-byte aligned rows) are queued on the async memcpy GDMA driver so the
+// CPU can keep rendering elsewhere; completion is reported through a
+// callback. Everything else - flash sources, unaligned rows, small copies,
+// host builds without ESP_PLATFORM - falls back to row memcpy, and the
+// callback runs before copyRect() returns, so callers see one behaviour.
+class BlitEngine {
+private:
+#ifdef ESP_PLATFORM
+    async_memcpy_t driver;
+    SemaphoreHandle_t idle;   // Given when the last job completes
+#endif
+    bool dma_ready;
+
+    struct BlitJob {
+        BlitEngine* engine;
+        volatile bool busy;
+        volatile uint16_t pending;   // Transfers outstanding (+1 while queueing)
+        BlitCallback callback;
+        void* arg;
+        uint8_t* dst;         // Rows to invalidate in the data cache on completion
+        int32_t dst_stride_bytes;
+        uint32_t row_bytes;
+        uint16_t rows;
+    };
+    BlitJob jobs[BLIT_MAX_JOBS];
+    volatile uint8_t jobs_active;
+
+    BlitStats stats;
+
+public:
+    BlitEngine();
+    ~BlitEngine();
+
+    // Install the GDMA driver (false: every copy uses the CPU)
+    bool begin();
+    bool isDMAReady() const { return dma_ready; }
+
+    // Copy a w x h block of 16-bit pixels (strides in pixels). Returns true
+    // if the copy was queued on DMA; false if it was already done on the CPU.
+    bool copyRect(uint16_t* dst, int32_t dst_stride, const uint16_t* src, int32_t src_stride,
+                  int16_t w, int16_t h, BlitCallback callback = nullptr, void* arg = nullptr);
+
+    // Block until every queued copy has completed
+    void wait();
+    bool isBusy() const { return jobs_active != 0; }
+
+    const BlitStats& getStats() const { return stats; }
+    void resetStats() { memset(&stats, 0, sizeof(stats)); }
+
+private:
+    bool canUseDMA(const void* dst, int32_t dst_stride_bytes, const void* src, int32_t src_stride_bytes,
+                   uint32_t row_bytes, uint32_t total_bytes) const;
+    void copyCPU(uint16_t* dst, int32_t dst_stride, const uint16_t* src, int32_t src_stride, int16_t w, int16_t h);
+#ifdef ESP_PLATFORM
+    BlitJob* allocJob();
+    static bool finishRow(BlitJob* job);
+    static bool IRAM_ATTR onRowDone(async_memcpy_t driver, async_memcpy_event_t* event, void* arg);
+#endif
+};
@@ -0,0 +1,30 @@
+#pragma once
+#include <Arduino.h>
+
+// Fixed-point RGB565 blending
+// Both colours are spread into a 32-bit word (G in the high half, R and B in
+// the low half) so all three channels are interpolated with one multiply.
+
+#define RGB565_SPREAD_MASK 0x07E0F81Fu
+
+// alpha: 0 (all bg) .. 32 (all fg)
+static inline uint16_t blendRGB565_32(uint16_t fg, uint16_t bg, uint32_t alpha) {
+    uint32_t f = (fg | ((uint32_t)fg << 16)) & RGB565_SPREAD_MASK;
+    uint32_t b = (bg | ((uint32_t)bg << 16)) & RGB565_SPREAD_MASK;
+    uint32_t r = ((((f - b) * alpha) >> 5) + b) & RGB565_SPREAD_MASK;
+    return (uint16_t)(r | (r >> 16));
+}
+
+// alpha: 0 (all bg) .. 255 (all fg)
+static inline uint16_t blendRGB565(uint16_t fg, uint16_t bg, uint8_t alpha) {
+    return blendRGB565_32(fg, bg, (alpha + 4) >> 3);
+}
+
+// 4-bit coverage (0..15) to 0..32 blend weight
+static const uint8_t coverage4_to_alpha32[16] = {
+    0, 2, 4, 6, 9, 11, 13, 15, 17, 19, 21, 23, 26, 28, 30, 32
+};
+
+static inline uint16_t blendRGB565_4bit(uint16_t fg, uint16_t bg, uint8_t coverage) {
+    return blendRGB565_32(fg, bg, coverage4_to_alpha32[coverage & 0x0F]);
+}
@@ -1,13 +1,56 @@
 #include "color_correction.h"
+#include "esp_heap_caps.h"
+#include <math.h>
+
+#define DIRECT_LUT_ENTRIES 65536
+
+// Profile helpers
+bool ColorProfile::isIdentity() const {
+    for (int ch = 0; ch < 3; ch++) {
+        if (gamma[ch] != 1.0f || gain[ch] != 1.0f || lift[ch] != 0.0f) return false;
+    }
+    return saturation == 1.0f;
+}
+
+ColorProfile ColorProfile::lerp(const ColorProfile& a, const ColorProfile& b, float t) {
+    ColorProfile p;
+    for (int ch = 0; ch < 3; ch++) {
+        p.gamma[ch] = a.gamma[ch] + (b.gamma[ch] - a.gamma[ch]) * t;
+        p.gain[ch] = a.gain[ch] + (b.gain[ch] - a.gain[ch]) * t;
+        p.lift[ch] = a.lift[ch] + (b.lift[ch] - a.lift[ch]) * t;
+    }
+    p.saturation = a.saturation + (b.saturation - a.saturation) * t;
+    return p;
+}
 
 ColorCorrection::ColorCorrection() {
     updateLookupTables();
 }
 
+ColorCorrection::~ColorCorrection() {
+    heap_caps_free(direct_lut);
+    heap_caps_free(back_lut);
+}
+
+bool ColorCorrection::enableDirectLUT(bool enable, bool internal) {
+    heap_caps_free(direct_lut);
+    heap_caps_free(back_lut);
+    direct_lut = nullptr;
+    back_lut = nullptr;
+    invalidate();
+    if (!enable) return true;
+    
+    lut_caps = internal ? (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT) : MALLOC_CAP_SPIRAM;
+    direct_lut = (uint16_t*)heap_caps_malloc(DIRECT_LUT_ENTRIES * sizeof(uint16_t), lut_caps);
+    return direct_lut != nullptr;
+}
+
 uint16_t ColorCorrection::correctColor(uint16_t rgb565) {
     if (lut_dirty) {
         updateLookupTables();
-        lut_dirty = false;
+    }
+    if (direct_lut) {
+        return direct_lut[rgb565];
     }
     
     // Extract RGB components
@@ -25,9 +68,69 @@ uint16_t ColorCorrection::correctColor(uint16_t rgb565) {
 }
 
 void ColorCorrection::correctBuffer(uint16_t* buffer, uint32_t pixel_count) {
+    if (isIdentity()) return;
+    if (lut_dirty) {
+        updateLookupTables();
+    }
+    
+    if (direct_lut) {
+        const uint16_t* lut = direct_lut;
+        for (uint32_t i = 0; i < pixel_count; i++) {
+            buffer[i] = lut[buffer[i]];
+        }
+        return;
+    }
     for (uint32_t i = 0; i < pixel_count; i++) {
-        buffer[i] = correctColor(buffer[i]);
+        uint16_t c = buffer[i];
+        buffer[i] = (red_lut[c >> 11] << 11) | (green_lut[(c >> 5) & 0x3F] << 5) | blue_lut[c & 0x1F];
+    }
+}
+
+void ColorCorrection::setProfile(const ColorProfile& p, bool incremental) {
+    ColorProfile q;
+    for (int ch = 0; ch < 3; ch++) {
+        q.gamma[ch] = constrain(p.gamma[ch], 0.5f, 3.0f);
+        q.gain[ch] = constrain(p.gain[ch], 0.0f, 2.0f);
+        q.lift[ch] = constrain(p.lift[ch], 0.0f, 0.5f);
+    }
+    q.saturation = constrain(p.saturation, 0.0f, 2.0f);
+    
+    if (incremental && direct_lut && !back_lut) {
+        back_lut = (uint16_t*)heap_caps_malloc(DIRECT_LUT_ENTRIES * sizeof(uint16_t), lut_caps);
+    }
+    if (!incremental || !direct_lut || !back_lut) {
+        profile = q;
+        temperature = 0;
+        invalidate();
+        return;
     }
+    
+    pending = q;
+    buildCurves(pending, pending_curves);
+    build_pos = 0;
+    building = true;
+}
+
+bool ColorCorrection::buildStep(uint32_t max_entries) {
+    if (!building) return false;
+    
+    uint32_t end = build_pos + max_entries;
+    if (end > DIRECT_LUT_ENTRIES) end = DIRECT_LUT_ENTRIES;
+    buildDirect(back_lut, pending_curves, pending.saturation, build_pos, end);
+    build_pos = end;
+    if (build_pos < DIRECT_LUT_ENTRIES) return false;
+    
+    // Complete: swap the new table in with its profile
+    uint16_t* old = direct_lut;
+    direct_lut = back_lut;
+    back_lut = old;
+    profile = pending;
+    temperature = 0;
+    memcpy(curves, pending_curves, sizeof(curves));
+    buildChannelTables();
+    building = false;
+    generation++;
+    return true;
 }
 
 void ColorCorrection::setTemperature(int8_t temp) {
@@ -36,35 +139,35 @@ void ColorCorrection::setTemperature(int8_t temp) {
     if (temp < 0) {
         // Warmer - reduce blue, slightly increase red
         float factor = abs(temp) / 100.0f;
-        red_gain = 1.0f + (factor * 0.3f);
-        green_gain = 1.0f + (factor * 0.1f);
-        blue_gain = 1.0f - (factor * 0.4f);
+        profile.gain[0] = 1.0f + (factor * 0.3f);
+        profile.gain[1] = 1.0f + (factor * 0.1f);
+        profile.gain[2] = 1.0f - (factor * 0.4f);
     } else if (temp > 0) {
         // Cooler - reduce red, increase blue
         float factor = temp / 100.0f;
-        red_gain = 1.0f - (factor * 0.3f);
-        green_gain = 1.0f - (factor * 0.1f);
-        blue_gain = 1.0f + (factor * 0.2f);
+        profile.gain[0] = 1.0f - (factor * 0.3f);
+        profile.gain[1] = 1.0f - (factor * 0.1f);
+        profile.gain[2] = 1.0f + (factor * 0.2f);
     } else {
-        red_gain = green_gain = blue_gain = 1.0f;
+        profile.gain[0] = profile.gain[1] = profile.gain[2] = 1.0f;
     }
     
-    lut_dirty = true;
+    invalidate();
 }
 
 void ColorCorrection::setRedGain(float gain) {
-    red_gain = constrain(gain, 0.5f, 2.0f);
-    lut_dirty = true;
+    profile.gain[0] = constrain(gain, 0.5f, 2.0f);
+    invalidate();
 }
 
 void ColorCorrection::setGreenGain(float gain) {
-    green_gain = constrain(gain, 0.5f, 2.0f);
-    lut_dirty = true;
+    profile.gain[1] = constrain(gain, 0.5f, 2.0f);
+    invalidate();
 }
 
 void ColorCorrection::setBlueGain(float gain) {
-    blue_gain = constrain(gain, 0.5f, 2.0f);
-    lut_dirty = true;
+    profile.gain[2] = constrain(gain, 0.5f, 2.0f);
+    invalidate();
 }
 
 void ColorCorrection::setRGBGains(float r, float g, float b) {
@@ -79,33 +182,70 @@ void ColorCorrection::presetWarmDisplay() {
 }
 
 void ColorCorrection::resetToDefault() {
-    red_gain = green_gain = blue_gain = 1.0f;
+    profile = ColorProfile();
     temperature = 0;
+    invalidate();
+}
+
+// Setters take effect at the next correction and cancel a pending rebuild
+void ColorCorrection::invalidate() {
     lut_dirty = true;
+    building = false;
 }
 
 void ColorCorrection::updateLookupTables() {
-    // Update red lookup table (5-bit)
+    buildCurves(profile, curves);
+    buildChannelTables();
+    if (direct_lut) {
+        buildDirect(direct_lut, curves, profile.saturation, 0, DIRECT_LUT_ENTRIES);
+    }
+    lut_dirty = false;
+    generation++;
+}
+
+// Gamma, gain and lift per channel, sampled at 8-bit input
+void ColorCorrection::buildCurves(const ColorProfile& p, uint8_t (*curve)[256]) {
+    for (int ch = 0; ch < 3; ch++) {
+        float max_out = (ch == 1) ? 63.0f : 31.0f;
+        for (int v = 0; v < 256; v++) {
+            float normalized = v / 255.0f;
+            if (p.gamma[ch] != 1.0f) {
+                normalized = powf(normalized, p.gamma[ch]);
+            }
+            normalized *= p.gain[ch];
+            normalized = p.lift[ch] + (1.0f - p.lift[ch]) * normalized;
+            normalized = constrain(normalized, 0.0f, 1.0f);
+            curve[ch][v] = (uint8_t)(normalized * max_out + 0.5f);
+        }
+    }
+}
+
+// 5/6-bit channel tables (no saturation - it needs all three channels)
+void ColorCorrection::buildChannelTables() {
     for (int i = 0; i < 32; i++) {
-        float normalized = i / 31.0f;
-        normalized *= red_gain;
-        normalized = constrain(normalized, 0.0f, 1.0f);
-        red_lut[i] = (uint16_t)(normalized * 31.0f);
+        red_lut[i] = curves[0][(i << 3) | (i >> 2)];
+        blue_lut[i] = curves[2][(i << 3) | (i >> 2)];
     }
-    
-    // Update green lookup table (6-bit)
     for (int i = 0; i < 64; i++) {
-        float normalized = i / 63.0f;
-        normalized *= green_gain;
-        normalized = constrain(normalized, 0.0f, 1.0f);
-        green_lut[i] = (uint16_t)(normalized * 63.0f);
+        green_lut[i] = curves[1][(i << 2) | (i >> 4)];
     }
-    
-    // Update blue lookup table (5-bit)
-    for (int i = 0; i < 32; i++) {
-        float normalized = i / 31.0f;
-        normalized *= blue_gain;
-        normalized = constrain(normalized, 0.0f, 1.0f);
-        blue_lut[i] = (uint16_t)(normalized * 31.0f);
+}
+
+// Direct table entries [from, to): expand to 8 bits, saturate around the
+// luma in 8.8 fixed point, then through the curves
+void ColorCorrection::buildDirect(uint16_t* lut, const uint8_t (*curve)[256], float saturation,
+                                  uint32_t from, uint32_t to) {
+    int32_t sat = (int32_t)(saturation * 256.0f + 0.5f);
+    for (uint32_t c = from; c < to; c++) {
+        int32_t r = ((c >> 8) & 0xF8) | (c >> 13);
+        int32_t g = ((c >> 3) & 0xFC) | ((c >> 9) & 0x03);
+        int32_t b = ((c << 3) & 0xF8) | ((c >> 2) & 0x07);
+        if (sat != 256) {
+            int32_t y = (77 * r + 150 * g + 29 * b) >> 8;
+            r = constrain(y + (((r - y) * sat) >> 8), 0, 255);
+            g = constrain(y + (((g - y) * sat) >> 8), 0, 255);
+            b = constrain(y + (((b - y) * sat) >> 8), 0, 255);
+        }
+        lut[c] = (curve[0][r] << 11) | (curve[1][g] << 5) | curve[2][b];
     }
-}
\ No newline at end of file
+}
@@ -2,30 +2,85 @@
 #include <Arduino.h>
 #include "color_correction.h"
 
+// How Graphics applies the correction
+enum ColorCorrectionMode {
+    CORRECTION_OFF,
+    CORRECTION_POST_PASS,     // applyColorCorrection() rewrites the frame buffer
+    CORRECTION_AT_DRAW        // Colours are corrected as they are drawn
+};
+
+// Direct-table entries rebuilt per buildStep() call (4 calls per rebuild)
+#define COLOR_LUT_STEP_ENTRIES 16384
+
+// Colour pipeline, applied per pixel in this order:
+// saturation, gamma, gain, black lift. Arrays are R, G, B.
+struct ColorProfile {
+    float gamma[3] = {1.0f, 1.0f, 1.0f};   // 0.5 to 3.0, > 1 darkens mid-tones
+    float gain[3] = {1.0f, 1.0f, 1.0f};    // 0.0 to 2.0
+    float lift[3] = {0.0f, 0.0f, 0.0f};    // Black level, 0.0 to 0.5
+    float saturation = 1.0f;               // 0.0 (grey) to 2.0
+    
+    bool isIdentity() const;
+    
+    // Linear blend between two profiles (t = 0 gives a, 1 gives b)
+    static ColorProfile lerp(const ColorProfile& a, const ColorProfile& b, float t);
+};
 
 class ColorCorrection {
 private:
-    // Correction factors (0.5 to 2.0, where 1.0 = no change)
-    float red_gain = 1.0f;
-    float green_gain = 1.0f; 
-    float blue_gain = 1.0f;
+    ColorProfile profile;
     
     // Color temperature adjustment (-100 to +100)
     int8_t temperature = 0;  // Negative = warmer, Positive = cooler
     
+    // Per-channel curves over 8-bit input (5/6-bit output), baked from profile
+    uint8_t curves[3][256];
+    
     // Pre-computed lookup tables for performance
     uint16_t red_lut[32];
-    uint16_t green_lut[64]; 
+    uint16_t green_lut[64];
     uint16_t blue_lut[32];
     bool lut_dirty = true;
     
+    // Optional RGB565 -> RGB565 table, one load per pixel (128 KB).
+    // Saturation needs it; the channel tables can't mix channels.
+    uint16_t* direct_lut = nullptr;
+    
+    // Incremental rebuild: the next table is built into back_lut a slice at
+    // a time and swapped in when complete, so a frame never sees a mix
+    uint16_t* back_lut = nullptr;
+    uint32_t lut_caps = 0;
+    ColorProfile pending;
+    uint8_t pending_curves[3][256];
+    uint32_t build_pos = 0;
+    bool building = false;
+    
+    uint32_t generation = 0;   // Bumped whenever the output colours change
+    
 public:
     ColorCorrection();
+    ~ColorCorrection();
+    
+    ColorCorrection(const ColorCorrection&) = delete;
+    ColorCorrection& operator=(const ColorCorrection&) = delete;
+    
+    // Allocate (PSRAM, or internal SRAM) or free the 64K-entry direct table
+    bool enableDirectLUT(bool enable = true, bool internal = false);
+    bool hasDirectLUT() const { return direct_lut != nullptr; }
     
     // Main correction function
     uint16_t correctColor(uint16_t rgb565);
     void correctBuffer(uint16_t* buffer, uint32_t pixel_count);
     
+    // Full pipeline. Immediate: tables are rebuilt on the next correction.
+    // Incremental (needs the direct table): call buildStep() once per frame
+    // until it returns true; the old tables stay in use until then.
+    void setProfile(const ColorProfile& p, bool incremental = false);
+    const ColorProfile& getProfile() const { return profile; }
+    bool buildStep(uint32_t max_entries = COLOR_LUT_STEP_ENTRIES);
+    bool isBuilding() const { return building; }
+    uint32_t getGeneration() const { return generation; }
+    
     // Color temperature adjustment (most common fix)
     void setTemperature(int8_t temp);  // -100 (warm) to +100 (cool)
     
@@ -41,10 +96,15 @@ public:
     
     // Getters
     int8_t getTemperature() const { return temperature; }
-    float getRedGain() const { return red_gain; }
-    float getGreenGain() const { return green_gain; }
-    float getBlueGain() const { return blue_gain; }
+    float getRedGain() const { return profile.gain[0]; }
+    float getGreenGain() const { return profile.gain[1]; }
+    float getBlueGain() const { return profile.gain[2]; }
+    bool isIdentity() const { return profile.isIdentity(); }
     
 private:
+    void invalidate();
     void updateLookupTables();
-};
\ No newline at end of file
+    void buildChannelTables();
+    void buildDirect(uint16_t* lut, const uint8_t (*curve)[256], float saturation, uint32_t from, uint32_t to);
+    static void buildCurves(const ColorProfile& p, uint8_t (*curve)[256]);
+};
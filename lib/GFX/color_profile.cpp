@@ -0,0 +1,125 @@
+#include "color_profile.h"
+
+// Helper macros
+#ifndef max
+#define max(a,b) ((a)>(b)?(a):(b))
+#endif
+#ifndef min
+#define min(a,b) ((a)<(b)?(a):(b))
+#endif
+
+ColorProfileManager::ColorProfileManager() :
+    correction(nullptr),
+    day(defaultDay()),
+    night(defaultNight()),
+    source(PROFILE_MANUAL),
+    night_selected(false),
+    blend(0.0f),
+    built_blend(0.0f),
+    transition_ms(2000),
+    last_update_ms(0),
+    last_step_ms(0),
+    seen_generation(0),
+    night_below(40),
+    day_above(80),
+    night_start(20 * 60),
+    night_end(7 * 60) {
+}
+
+void ColorProfileManager::begin(ColorCorrection* cc) {
+    correction = cc;
+    blend = built_blend = night_selected ? 1.0f : 0.0f;
+    last_update_ms = last_step_ms = millis();
+    if (correction) {
+        correction->setProfile(night_selected ? night : day);
+        correction->correctColor(0);
+        seen_generation = correction->getGeneration();
+    }
+}
+
+void ColorProfileManager::setProfiles(const ColorProfile& day_profile, const ColorProfile& night_profile) {
+    day = day_profile;
+    night = night_profile;
+    built_blend = -1.0f;     // Rebuild at the current blend
+}
+
+void ColorProfileManager::setNight(bool enable) {
+    if (source == PROFILE_MANUAL) night_selected = enable;
+}
+
+void ColorProfileManager::setAmbientLight(uint16_t level) {
+    if (source != PROFILE_AMBIENT) return;
+
+    // Dead band between the thresholds keeps dusk from flickering
+    if (level < night_below) night_selected = true;
+    else if (level > day_above) night_selected = false;
+}
+
+void ColorProfileManager::setAmbientThresholds(uint16_t night_level, uint16_t day_level) {
+    night_below = night_level;
+    day_above = day_level > night_level ? day_level : night_level;
+}
+
+void ColorProfileManager::setTimeOfDay(uint8_t hour, uint8_t minute) {
+    if (source != PROFILE_TIME) return;
+
+    uint16_t now = (hour % 24) * 60 + (minute % 60);
+    if (night_start <= night_end) {
+        night_selected = now >= night_start && now < night_end;
+    } else {
+        night_selected = now >= night_start || now < night_end;   // Wraps midnight
+    }
+}
+
+void ColorProfileManager::setNightHours(uint8_t start_hour, uint8_t end_hour) {
+    night_start = (start_hour % 24) * 60;
+    night_end = (end_hour % 24) * 60;
+}
+
+bool ColorProfileManager::update(uint32_t now_ms) {
+    if (!correction) return false;
+
+    uint32_t dt = now_ms - last_update_ms;
+    last_update_ms = now_ms;
+
+    // Move the blend towards the selected profile
+    float target = night_selected ? 1.0f : 0.0f;
+    if (blend != target) {
+        float step = transition_ms ? (float)dt / transition_ms : 1.0f;
+        if (blend < target) blend = min(blend + step, target);
+        else                blend = max(blend - step, target);
+    }
+
+    // Hand the next intermediate profile over once the previous one is in
+    if (!correction->isBuilding() && blend != built_blend &&
+        (now_ms - last_step_ms >= PROFILE_STEP_MS || blend == target)) {
+        correction->setProfile(ColorProfile::lerp(day, night, blend), true);
+        built_blend = blend;
+        last_step_ms = now_ms;
+    }
+    correction->buildStep();
+
+    // Immediate rebuilds (no direct table) happen on the next correction
+    correction->correctColor(0);
+
+    uint32_t generation = correction->getGeneration();
+    if (generation == seen_generation) return false;
+    seen_generation = generation;
+    return true;
+}
+
+ColorProfile ColorProfileManager::defaultDay() {
+    return ColorProfile();
+}
+
+ColorProfile ColorProfileManager::defaultNight() {
+    ColorProfile p;
+    p.gamma[0] = 1.2f;       // Deeper mid-tones, blue most of all
+    p.gamma[1] = 1.3f;
+    p.gamma[2] = 1.5f;
+    p.gain[0] = 0.55f;       // Dim, and shift towards red
+    p.gain[1] = 0.40f;
+    p.gain[2] = 0.25f;
+    p.saturation = 0.8f;
+    return p;
+}
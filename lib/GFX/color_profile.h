@@ -0,0 +1,75 @@
+#pragma once
+#include <Arduino.h>
+#include "color_correction.h"
+
+// What selects between the day and night profiles
+enum ProfileSource {
+    PROFILE_MANUAL,          // setNight()
+    PROFILE_AMBIENT,         // setAmbientLight(), with hysteresis
+    PROFILE_TIME             // setTimeOfDay() against the night hours
+};
+
+// Minimum time between transition steps; each step is one LUT rebuild
+#define PROFILE_STEP_MS 50
+
+// Day/night colour profiles with animated transitions
+// Call update() every loop iteration: it blends towards the selected
+// profile and spreads each LUT rebuild over several calls, so a switch
+// never stalls a frame. When update() returns true the correction changed
+// and anything drawn (or cached) with corrected colours should be redrawn.
+class ColorProfileManager {
+private:
+    ColorCorrection* correction;
+    ColorProfile day;
+    ColorProfile night;
+    ProfileSource source;
+
+    bool night_selected;
+    float blend;             // 0 = day, 1 = night
+    float built_blend;       // Blend of the last profile handed to the correction
+    uint16_t transition_ms;
+    uint32_t last_update_ms;
+    uint32_t last_step_ms;
+    uint32_t seen_generation;
+
+    // Ambient light thresholds (sensor units), night below / day above
+    uint16_t night_below;
+    uint16_t day_above;
+
+    // Night hours, minutes since midnight (may wrap past midnight)
+    uint16_t night_start;
+    uint16_t night_end;
+
+public:
+    ColorProfileManager();
+
+    // Starts in the day profile, applied immediately
+    void begin(ColorCorrection* cc);
+
+    void setProfiles(const ColorProfile& day_profile, const ColorProfile& night_profile);
+    const ColorProfile& getDayProfile() const { return day; }
+    const ColorProfile& getNightProfile() const { return night; }
+
+    // Selection
+    void setSource(ProfileSource s) { source = s; }
+    ProfileSource getSource() const { return source; }
+    void setNight(bool enable);                        // PROFILE_MANUAL
+    void setAmbientLight(uint16_t level);              // PROFILE_AMBIENT
+    void setAmbientThresholds(uint16_t night_level, uint16_t day_level);
+    void setTimeOfDay(uint8_t hour, uint8_t minute);   // PROFILE_TIME
+    void setNightHours(uint8_t start_hour, uint8_t end_hour);
+
+    // Transition length (0 = switch in one step)
+    void setTransitionTime(uint16_t ms) { transition_ms = ms; }
+
+    // Advance the transition; true when the corrected colours changed
+    bool update(uint32_t now_ms);
+
+    bool isNight() const { return night_selected; }
+    bool isTransitioning() const { return blend != built_blend || (correction && correction->isBuilding()); }
+    float getBlend() const { return blend; }
+
+    // Defaults: neutral day, dimmed and warm night
+    static ColorProfile defaultDay();
+    static ColorProfile defaultNight();
+};
@@ -0,0 +1,204 @@
+#include "compositor.h"
+#include "color_blend.h"
+
+// Helper macros
+#ifndef max
+#define max(a,b) ((a)>(b)?(a):(b))
+#endif
+#ifndef min
+#define min(a,b) ((a)<(b)?(a):(b))
+#endif
+
+Compositor::Compositor() :
+    gfx(nullptr),
+    layer_count(0),
+    pixels_composited(0) {
+}
+
+Compositor::~Compositor() {
+    // Layer surfaces belong to the caller; save-under buffers free themselves
+}
+
+bool Compositor::begin(Graphics* g) {
+    if (!g) return false;
+
+    gfx = g;
+    return true;
+}
+
+void Compositor::composite(const Surface& src, int16_t x, int16_t y, const CompositeOptions& options) {
+    if (!gfx || !src.isReady()) return;
+
+    blend(gfx->getTargetPixels(), gfx->getTargetWidth(), gfx->getTargetHeight(), gfx->getTargetStride(),
+          src, x, y, options);
+    gfx->markUntracked(x, y, src.getWidth(), src.getHeight());
+}
+
+// Layers
+int8_t Compositor::addLayer(Surface* surface, int16_t x, int16_t y, const CompositeOptions& options) {
+    if (!gfx || !surface || !surface->isReady() || layer_count >= COMPOSITOR_MAX_LAYERS) return -1;
+
+    CompositorLayer& layer = layers[layer_count];
+    if (!layer.under.begin(surface->getWidth(), surface->getHeight(), SURFACE_PSRAM)) return -1;
+
+    layer.surface = surface;
+    layer.x = x;
+    layer.y = y;
+    layer.options = options;
+    layer.visible = false;
+    return layer_count++;
+}
+
+bool Compositor::show(int8_t id) {
+    CompositorLayer* layer = getLayer(id);
+    if (!layer) return false;
+    if (layer->visible) return true;
+
+    saveUnder(*layer);
+    blend(gfx->getFrameBuffer(), LCD_H_RES, LCD_V_RES, LCD_H_RES, *layer->surface, layer->x, layer->y, layer->options);
+    gfx->markUntracked(layer->x, layer->y, layer->surface->getWidth(), layer->surface->getHeight());
+    layer->visible = true;
+    return true;
+}
+
+bool Compositor::hide(int8_t id) {
+    CompositorLayer* layer = getLayer(id);
+    if (!layer) return false;
+    if (!layer->visible) return true;
+
+    restoreUnder(*layer);
+    layer->visible = false;
+    return true;
+}
+
+bool Compositor::isVisible(int8_t id) const {
+    return id >= 0 && id < layer_count && layers[id].visible;
+}
+
+bool Compositor::moveLayer(int8_t id, int16_t x, int16_t y) {
+    CompositorLayer* layer = getLayer(id);
+    if (!layer) return false;
+    if (x == layer->x && y == layer->y) return true;
+
+    bool was_visible = layer->visible;
+    hide(id);
+    layer->x = x;
+    layer->y = y;
+    return was_visible ? show(id) : true;
+}
+
+bool Compositor::setLayerAlpha(int8_t id, uint8_t alpha) {
+    CompositorLayer* layer = getLayer(id);
+    if (!layer) return false;
+    if (alpha == layer->options.alpha) return true;
+
+    layer->options.alpha = alpha;
+    return refresh(id);
+}
+
+bool Compositor::refresh(int8_t id) {
+    CompositorLayer* layer = getLayer(id);
+    if (!layer) return false;
+    if (!layer->visible) return true;
+
+    // Blend over the saved pixels, not over the previous overlay
+    restoreUnder(*layer);
+    layer->visible = false;
+    return show(id);
+}
+
+// Private implementation functions
+CompositorLayer* Compositor::getLayer(int8_t id) {
+    if (!gfx || id < 0 || id >= layer_count) return nullptr;
+    return &layers[id];
+}
+
+bool Compositor::clipToScreen(const CompositorLayer& layer, int16_t* x1, int16_t* y1, int16_t* x2, int16_t* y2) const {
+    *x1 = max(layer.x, 0);
+    *y1 = max(layer.y, 0);
+    *x2 = min(layer.x + layer.surface->getWidth(), LCD_H_RES);
+    *y2 = min(layer.y + layer.surface->getHeight(), LCD_V_RES);
+    return *x1 < *x2 && *y1 < *y2;
+}
+
+void Compositor::saveUnder(CompositorLayer& layer) {
+    int16_t x1, y1, x2, y2;
+    if (!clipToScreen(layer, &x1, &y1, &x2, &y2)) return;
+
+    const uint16_t* fb = gfx->getFrameBuffer();
+    size_t row_bytes = (x2 - x1) * sizeof(uint16_t);
+    for (int16_t py = y1; py < y2; py++) {
+        memcpy(layer.under.row(py - layer.y) + (x1 - layer.x), fb + py * LCD_H_RES + x1, row_bytes);
+    }
+}
+
+void Compositor::restoreUnder(CompositorLayer& layer) {
+    int16_t x1, y1, x2, y2;
+    if (!clipToScreen(layer, &x1, &y1, &x2, &y2)) return;
+
+    uint16_t* fb = gfx->getFrameBuffer();
+    size_t row_bytes = (x2 - x1) * sizeof(uint16_t);
+    for (int16_t py = y1; py < y2; py++) {
+        memcpy(fb + py * LCD_H_RES + x1, layer.under.row(py - layer.y) + (x1 - layer.x), row_bytes);
+    }
+    gfx->markUntracked(x1, y1, x2 - x1, y2 - y1);
+}
+
+void Compositor::blend(uint16_t* dst, int16_t dst_w, int16_t dst_h, int32_t dst_stride,
+                       const Surface& src, int16_t x, int16_t y, const CompositeOptions& options) {
+    if (!dst || options.alpha == 0) return;
+
+    // Destination rectangle: surface bounds, target bounds and the options clip
+    int16_t x1 = max(x, 0);
+    int16_t y1 = max(y, 0);
+    int16_t x2 = min(x + src.getWidth(), dst_w);
+    int16_t y2 = min(y + src.getHeight(), dst_h);
+    if (options.clip_w > 0 && options.clip_h > 0) {
+        x1 = max(x1, options.clip_x);
+        y1 = max(y1, options.clip_y);
+        x2 = min(x2, options.clip_x + options.clip_w);
+        y2 = min(y2, options.clip_y + options.clip_h);
+    }
+    if (x1 >= x2 || y1 >= y2) return;
+
+    int16_t w = x2 - x1;
+    uint32_t global32 = (options.alpha + 4) >> 3;          // 0..32
+    bool opaque = options.alpha == 255;
+    CompositeMode mode = options.mode;
+    if (mode == COMPOSITE_PIXEL_ALPHA && !src.hasAlpha()) mode = COMPOSITE_OPAQUE;
+
+    for (int16_t py = y1; py < y2; py++) {
+        const uint16_t* s = src.row(py - y) + (x1 - x);
+        uint16_t* d = dst + py * dst_stride + x1;
+
+        switch (mode) {
+            case COMPOSITE_OPAQUE:
+                if (opaque) {
+                    memcpy(d, s, w * sizeof(uint16_t));
+                } else {
+                    for (int16_t i = 0; i < w; i++) {
+                        d[i] = blendRGB565_32(s[i], d[i], global32);
+                    }
+                }
+                break;
+
+            case COMPOSITE_COLOR_KEY:
+                for (int16_t i = 0; i < w; i++) {
+                    if (s[i] == options.color_key) continue;
+                    d[i] = opaque ? s[i] : blendRGB565_32(s[i], d[i], global32);
+                }
+                break;
+
+            case COMPOSITE_PIXEL_ALPHA: {
+                const uint8_t* a = src.getAlpha() + (py - y) * src.getWidth() + (x1 - x);
+                for (int16_t i = 0; i < w; i++) {
+                    uint32_t pa = opaque ? a[i] : (a[i] * (options.alpha + 1)) >> 8;
+                    if (pa == 0) continue;
+                    d[i] = (pa >= 255) ? s[i] : blendRGB565(s[i], d[i], pa);
+                }
+                break;
+            }
+        }
+    }
+    pixels_composited += (uint32_t)w * (y2 - y1);
+}
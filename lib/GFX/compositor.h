@@ -0,0 +1,82 @@
+#pragma once
+#include <Arduino.h>
+#include "graphics.h"
+#include "surface.h"
+
+// Compositor configuration
+#define COMPOSITOR_MAX_LAYERS   4
+
+// How source pixels are combined with the destination
+enum CompositeMode {
+    COMPOSITE_OPAQUE = 0,     // Copy every pixel
+    COMPOSITE_COLOR_KEY,      // Skip pixels equal to color_key
+    COMPOSITE_PIXEL_ALPHA     // Weight by the surface's alpha plane
+};
+
+// Composite options (global alpha applies on top of every mode)
+struct CompositeOptions {
+    CompositeMode mode = COMPOSITE_OPAQUE;
+    uint16_t color_key = 0x0000;
+    uint8_t alpha = 255;      // 0 = invisible, 255 = as is
+    int16_t clip_x = 0;       // Clipping rectangle on the destination
+    int16_t clip_y = 0;
+    int16_t clip_w = 0;       // 0 = no clipping
+    int16_t clip_h = 0;
+};
+
+// Overlay shown on top of the frame buffer
+struct CompositorLayer {
+    Surface* surface;
+    Surface under;            // Screen pixels covered while the layer is shown
+    int16_t x, y;
+    CompositeOptions options;
+    bool visible;
+};
+
+// Surface compositor
+// composite() blends a surface into the current Graphics target. Layers
+// are overlays (warnings, popups) on the screen: showing one saves the
+// frame buffer pixels it covers, so hiding or moving it puts them back
+// without redrawing anything underneath. Overlapping layers must be hidden
+// in the reverse order they were shown, and anything drawn under a visible
+// layer is lost when it is hidden.
+class Compositor {
+private:
+    Graphics* gfx;
+    CompositorLayer layers[COMPOSITOR_MAX_LAYERS];
+    uint8_t layer_count;
+
+    // Statistics
+    uint32_t pixels_composited;
+
+public:
+    Compositor();
+    ~Compositor();
+
+    bool begin(Graphics* g);
+
+    // Blend a surface into the current Graphics target
+    void composite(const Surface& src, int16_t x, int16_t y, const CompositeOptions& options);
+
+    // Overlay layers (the surface must outlive the layer); returns -1 when full
+    int8_t addLayer(Surface* surface, int16_t x, int16_t y, const CompositeOptions& options);
+    bool show(int8_t id);
+    bool hide(int8_t id);
+    bool isVisible(int8_t id) const;
+
+    // Changes are applied immediately to visible layers
+    bool moveLayer(int8_t id, int16_t x, int16_t y);
+    bool setLayerAlpha(int8_t id, uint8_t alpha);
+    bool refresh(int8_t id);  // Surface contents changed
+
+    // Statistics
+    uint32_t getPixelsComposited() const { return pixels_composited; }
+
+private:
+    CompositorLayer* getLayer(int8_t id);
+    bool clipToScreen(const CompositorLayer& layer, int16_t* x1, int16_t* y1, int16_t* x2, int16_t* y2) const;
+    void saveUnder(CompositorLayer& layer);
+    void restoreUnder(CompositorLayer& layer);
+    void blend(uint16_t* dst, int16_t dst_w, int16_t dst_h, int32_t dst_stride,
+               const Surface& src, int16_t x, int16_t y, const CompositeOptions& options);
+};
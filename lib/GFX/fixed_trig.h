@@ -0,0 +1,55 @@
+#pragma once
+#include <Arduino.h>
+
+// Fixed-point trigonometry
+// Angles are in tenths of a degree, 0 = 3 o'clock, increasing clockwise on
+// screen (y grows downwards). Results are Q14 (16384 = 1.0), interpolated
+// from a one-degree quarter-wave table.
+
+#define TRIG_ONE        16384
+#define TRIG_SHIFT      14
+
+static const int16_t sin_q14_table[91] = {
+        0,   286,   572,   857,  1143,  1428,  1713,  1997,  2280,  2563,
+     2845,  3126,  3406,  3686,  3964,  4240,  4516,  4790,  5063,  5334,
+     5604,  5872,  6138,  6402,  6664,  6924,  7182,  7438,  7692,  7943,
+     8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860, 10087, 10311,
+    10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+    12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+    14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+    15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+    16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+    16384
+};
+
+// sin of an angle in tenths of a degree (any sign)
+static inline int16_t isin10(int32_t angle) {
+    angle %= 3600;
+    if (angle < 0) angle += 3600;
+
+    // Fold into the first quadrant
+    bool negative = angle >= 1800;
+    if (negative) angle -= 1800;
+    if (angle > 900) angle = 1800 - angle;
+
+    int32_t deg = angle / 10;
+    int32_t frac = angle % 10;
+    int32_t value = sin_q14_table[deg];
+    if (frac) {
+        value += ((sin_q14_table[deg + 1] - value) * frac) / 10;
+    }
+    return negative ? -value : value;
+}
+
+static inline int16_t icos10(int32_t angle) {
+    return isin10(angle + 900);
+}
+
+// Whole-degree versions
+static inline int16_t isin(int32_t degrees) {
+    return isin10(degrees * 10);
+}
+
+static inline int16_t icos(int32_t degrees) {
+    return isin10(degrees * 10 + 900);
+}
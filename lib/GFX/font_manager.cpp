@@ -0,0 +1,18 @@
+#include "font_manager.h"
+#include "asset_bundle.h"
+
+bool FontManager::setFontAsset(uint16_t asset_id) {
+    if (!assets) return false;
+
+    const AAFont* aa_font = assets->getAAFont(asset_id);
+    if (aa_font) {
+        setFont(aa_font);
+        return true;
+    }
+    const GFXfont* gfx_font = assets->getGFXFont(asset_id);
+    if (gfx_font) {
+        setFont(gfx_font);
+        return true;
+    }
+    return false;
+}
@@ -19,6 +19,25 @@ typedef struct {
     uint8_t yAdvance;  // Newline distance (y axis)
 } GFXfont;
 
+// Anti-aliased 4-bpp font structures (generated by tools/fontconvert_aa.py)
+// Coverage is 0..15, two pixels per byte (left pixel in the high nibble), rows byte-padded
+typedef struct {
+    uint32_t bitmapOffset; // Offset into AAFont->bitmap (4-bpp fonts outgrow 64 KB quickly)
+    uint8_t width;         // Bitmap dimensions in pixels
+    uint8_t height;        // Bitmap dimensions in pixels
+    uint8_t xAdvance;      // Distance to advance cursor (x axis)
+    int8_t xOffset;        // X dist from cursor pos to UL corner
+    int8_t yOffset;        // Y dist from cursor pos to UL corner
+} AAGlyph;
+
+typedef struct {
+    uint8_t *bitmap;   // Glyph coverage maps, concatenated
+    AAGlyph *glyph;    // Glyph array
+    uint8_t first;     // ASCII extents (first char)
+    uint8_t last;      // ASCII extents (last char)
+    uint8_t yAdvance;  // Newline distance (y axis)
+} AAFont;
+
 // Font types
 enum FontType {
     FONT_BUILTIN = 0,
@@ -26,6 +45,7 @@ enum FontType {
     FONT_FREESANS_12PT,
     FONT_FREESANS_18PT,
     FONT_FREESANS_24PT,
+    FONT_ANTIALIASED,       // Any 4-bpp AAFont (set by pointer)
     // Add more fonts here as needed
     FONT_COUNT
 };
@@ -129,18 +149,23 @@ const uint8_t builtin_font_5x8[96][5] PROGMEM = {
     {0x08, 0x04, 0x08, 0x10, 0x08}, // '~' (126)
 };
 
+class AssetBundle;
+
 class FontManager {
 private:
     FontType current_font;
     uint8_t builtin_scale;
     const GFXfont* current_gfx_font;
+    const AAFont* current_aa_font;
+    const AssetBundle* assets;
     
 public:
-    FontManager() : current_font(FONT_BUILTIN), builtin_scale(1), current_gfx_font(nullptr) {}
+    FontManager() : current_font(FONT_BUILTIN), builtin_scale(1), current_gfx_font(nullptr), current_aa_font(nullptr), assets(nullptr) {}
     
     // Set font by type
     void setFont(FontType font) {
         current_font = font;
+        current_aa_font = nullptr;
         
         switch(font) {
             case FONT_BUILTIN:
@@ -159,6 +184,7 @@ public:
     
     // Set font by pointer (for any Adafruit font)
     void setFont(const GFXfont* font) {
+        current_aa_font = nullptr;
         if (font == nullptr) {
             current_font = FONT_BUILTIN;
             current_gfx_font = nullptr;
@@ -168,6 +194,22 @@ public:
         }
     }
     
+    // Set anti-aliased font by pointer
+    void setFont(const AAFont* font) {
+        current_gfx_font = nullptr;
+        if (font == nullptr) {
+            current_font = FONT_BUILTIN;
+            current_aa_font = nullptr;
+        } else {
+            current_font = FONT_ANTIALIASED;
+            current_aa_font = font;
+        }
+    }
+    
+    // Fonts from the asset bundle by id (false leaves the current font)
+    void setAssetBundle(const AssetBundle* bundle) { assets = bundle; }
+    bool setFontAsset(uint16_t asset_id);
+    
     // Set built-in font scale (1-8)
     void setBuiltinScale(uint8_t scale) {
         builtin_scale = (scale < 1) ? 1 : (scale > 8) ? 8 : scale;
@@ -177,13 +219,22 @@ public:
     FontType getCurrentFont() const { return current_font; }
     uint8_t getBuiltinScale() const { return builtin_scale; }
     const GFXfont* getCurrentGFXFont() const { return current_gfx_font; }
+    const AAFont* getCurrentAAFont() const { return current_aa_font; }
     bool isBuiltinFont() const { return current_font == FONT_BUILTIN; }
+    bool isAAFont() const { return current_aa_font != nullptr; }
     
     // Get character dimensions
     void getCharSize(char c, int16_t* width, int16_t* height) {
         if (current_font == FONT_BUILTIN) {
             *width = 5 * builtin_scale;
             *height = 8 * builtin_scale;
+        } else if (current_aa_font != nullptr) {
+            if (c < current_aa_font->first || c > current_aa_font->last) {
+                c = '?';
+            }
+            const AAGlyph* glyph = &current_aa_font->glyph[c - current_aa_font->first];
+            *width = glyph->xAdvance;
+            *height = current_aa_font->yAdvance;
         } else if (current_gfx_font != nullptr) {
             if (c < current_gfx_font->first || c > current_gfx_font->last) {
                 c = '?';
@@ -237,6 +288,7 @@ public:
             case FONT_FREESANS_12PT: return "FreeSans 12pt";
             case FONT_FREESANS_18PT: return "FreeSans 18pt";
             case FONT_FREESANS_24PT: return "FreeSans 24pt";
+            case FONT_ANTIALIASED: return "Anti-aliased";
             default: return "Unknown";
         }
     }
@@ -0,0 +1,304 @@
+#include "gfx_benchmark.h"
+#include "fixed_trig.h"
+#include "qoi565.h"
+#include "asset_ids.h"
+#include "esp_heap_caps.h"
+
+#define BENCH_ITERATIONS 20
+#define BENCH_TEXT_ROWS  16
+#define BENCH_LINES      72     // Fan of lines, one every 5 degrees
+#define BENCH_LINE_LEN   200
+#define BENCH_ZOOM_FRAMES 30    // Splash zoom from 1/30 to full size
+
+static const char* bench_text = "ENGINE OIL TEMPERATURE: 104.5 C";
+
+// Average time of one call in microseconds
+template <typename F>
+static uint32_t benchmarkUs(F fn) {
+    uint32_t start = micros();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        fn();
+    }
+    return (micros() - start) / BENCH_ITERATIONS;
+}
+
+static void report(const char* name, uint32_t us) {
+    Serial.printf("  %-34s %7lu us\n", name, (unsigned long)us);
+}
+
+static void drawTextBlock(Graphics& gfx) {
+    for (int row = 0; row < BENCH_TEXT_ROWS; row++) {
+        gfx.printAt(10, 30 + row * 28, bench_text);
+    }
+}
+
+// 1-bpp vs 4-bpp text at the same nominal size, on unknown and known backgrounds
+static void benchmarkText(Graphics& gfx) {
+    Serial.printf("Text (%d lines of %d chars):\n", BENCH_TEXT_ROWS, (int)strlen(bench_text));
+
+    gfx.fillScreen(COLOR_DARKGRAY);
+    gfx.useFreeSans9pt();
+    gfx.setTextColor(COLOR_WHITE);
+    report("FreeSans9pt 1-bpp", benchmarkUs([&]() { drawTextBlock(gfx); }));
+
+    gfx.setTextColor(COLOR_WHITE, COLOR_DARKGRAY);
+    report("FreeSans9pt 1-bpp, bg", benchmarkUs([&]() { drawTextBlock(gfx); }));
+
+    gfx.useFreeSans9ptAA();
+    gfx.setTextColor(COLOR_WHITE);
+    report("FreeSans9pt AA, blend to fb", benchmarkUs([&]() { drawTextBlock(gfx); }));
+
+    gfx.setTextColor(COLOR_WHITE, COLOR_DARKGRAY);
+    report("FreeSans9pt AA, pre-blended bg", benchmarkUs([&]() { drawTextBlock(gfx); }));
+
+    gfx.useFreeSans18pt7b();
+    gfx.setTextColor(COLOR_WHITE);
+    report("FreeSans18pt 1-bpp", benchmarkUs([&]() { drawTextBlock(gfx); }));
+
+    gfx.useBuiltinFont(2);
+    gfx.setTextColor(COLOR_WHITE);
+    report("Builtin 5x8 x2", benchmarkUs([&]() { drawTextBlock(gfx); }));
+}
+
+// Fan of lines at every angle around the screen centre
+template <typename F>
+static void drawLineFan(F line) {
+    int16_t cx = LCD_H_RES / 2;
+    int16_t cy = LCD_V_RES / 2;
+    for (int i = 0; i < BENCH_LINES; i++) {
+        int32_t angle = i * 3600 / BENCH_LINES;
+        line(cx, cy, cx + ((BENCH_LINE_LEN * icos10(angle)) >> TRIG_SHIFT),
+                     cy + ((BENCH_LINE_LEN * isin10(angle)) >> TRIG_SHIFT));
+    }
+}
+
+// Bresenham vs anti-aliased lines, to pick a style per widget
+static void benchmarkLines(Graphics& gfx) {
+    Serial.printf("Lines (%d x %d px):\n", BENCH_LINES, BENCH_LINE_LEN);
+
+    gfx.fillScreen(COLOR_DARKGRAY);
+    report("drawLine", benchmarkUs([&]() {
+        drawLineFan([&](int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+            gfx.drawLine(x0, y0, x1, y1, COLOR_WHITE);
+        });
+    }));
+    report("drawLine x3 (3 px needle)", benchmarkUs([&]() {
+        drawLineFan([&](int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+            bool steep = abs(y1 - y0) > abs(x1 - x0);
+            for (int8_t o = -1; o <= 1; o++) {
+                gfx.drawLine(x0 + (steep ? o : 0), y0 + (steep ? 0 : o),
+                             x1 + (steep ? o : 0), y1 + (steep ? 0 : o), COLOR_WHITE);
+            }
+        });
+    }));
+    for (uint8_t thickness = 1; thickness <= 3; thickness += 2) {
+        char name[40];
+        snprintf(name, sizeof(name), "drawLineAA, %u px", thickness);
+        report(name, benchmarkUs([&]() {
+            drawLineFan([&](int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+                gfx.drawLineAA(x0, y0, x1, y1, COLOR_WHITE, thickness);
+            });
+        }));
+    }
+}
+
+// Opaque PSRAM copies on the CPU vs the GDMA blit engine
+static void benchmarkBlit(Graphics& gfx, const char* name, int16_t x, int16_t w, int16_t h, const uint16_t* src) {
+    char label[48];
+    snprintf(label, sizeof(label), "%s, CPU", name);
+    report(label, benchmarkUs([&]() { gfx.drawRGB565(x, 0, w, h, src); }));
+
+    uint32_t issue = 0;
+    snprintf(label, sizeof(label), "%s, async + wait", name);
+    report(label, benchmarkUs([&]() {
+        uint32_t start = micros();
+        gfx.drawRGB565Async(x, 0, w, h, src);
+        issue += micros() - start;
+        gfx.waitForBlits();
+    }));
+    snprintf(label, sizeof(label), "%s, async issue only", name);
+    report(label, issue / BENCH_ITERATIONS);
+}
+
+static void benchmarkBlits(Graphics& gfx) {
+    uint16_t* src = (uint16_t*)heap_caps_aligned_alloc(BLIT_DMA_ALIGN, LCD_H_RES * LCD_V_RES * sizeof(uint16_t),
+                                                       MALLOC_CAP_SPIRAM);
+    if (!src) return;
+    memcpy(src, gfx.getFrameBuffer(), LCD_H_RES * LCD_V_RES * sizeof(uint16_t));
+
+    BlitEngine& engine = gfx.getBlitEngine();
+    Serial.printf("Blits (GDMA %s):\n", engine.isDMAReady() ? "ready" : "unavailable");
+    engine.resetStats();
+    benchmarkBlit(gfx, "Full screen", 0, LCD_H_RES, LCD_V_RES, src);
+    benchmarkBlit(gfx, "640x196 rows", 64, 640, 196, src);
+
+    const BlitStats& stats = engine.getStats();
+    Serial.printf("  %lu DMA copies (%lu KB), %lu CPU copies (%lu KB)\n",
+                  (unsigned long)stats.dma_copies, (unsigned long)(stats.dma_bytes / 1024),
+                  (unsigned long)stats.cpu_copies, (unsigned long)(stats.cpu_bytes / 1024));
+    heap_caps_free(src);
+}
+
+static void reportImage(Graphics& gfx, const char* name, const Image& image) {
+    char label[40];
+    snprintf(label, sizeof(label), "%s, %lu B", name, (unsigned long)image.header.data_size);
+    report(label, benchmarkUs([&]() { gfx.drawImage(75, 142, image); }));
+
+    // Half off the left edge: clipped columns are skipped, not drawn
+    snprintf(label, sizeof(label), "%s, left half clipped", name);
+    report(label, benchmarkUs([&]() { gfx.drawImage(-325, 142, image); }));
+}
+
+// Splash-style zoom around the screen centre: average time per frame
+static void reportZoom(Graphics& gfx, const char* name, const Image& image, bool bilinear) {
+    ImageDrawOptions options;
+    options.bilinear = bilinear;
+    uint16_t w = image.header.width;
+    uint16_t h = image.header.height;
+
+    uint32_t start = micros();
+    for (int frame = 1; frame <= BENCH_ZOOM_FRAMES; frame++) {
+        uint16_t zw = w * frame / BENCH_ZOOM_FRAMES;
+        uint16_t zh = h * frame / BENCH_ZOOM_FRAMES;
+        gfx.drawImageResized((LCD_H_RES - zw) / 2, (LCD_V_RES - zh) / 2, image, zw, zh, options);
+    }
+    report(name, (micros() - start) / BENCH_ZOOM_FRAMES);
+}
+
+// The logo as raw, RLE and QOI: storage size against decode speed
+static void benchmarkImages(Graphics& gfx) {
+    Image logo_image = gfx.getImageManager().getAsset(ASSET_LOGO);
+    if (!logo_image.data || logo_image.header.format != IMAGE_RGB565_QOI) {
+        Serial.println("Images: QOI logo asset not available - skipped");
+        return;
+    }
+
+    uint16_t w = logo_image.header.width;
+    uint16_t h = logo_image.header.height;
+    uint32_t pixels = (uint32_t)w * h;
+
+    uint16_t* raw = (uint16_t*)heap_caps_malloc(pixels * sizeof(uint16_t), MALLOC_CAP_SPIRAM);
+    uint8_t* rle = (uint8_t*)heap_caps_malloc(pixels * 3, MALLOC_CAP_SPIRAM);
+    if (!raw || !rle) {
+        heap_caps_free(raw);
+        heap_caps_free(rle);
+        return;
+    }
+
+    QOIDecoder decoder;
+    decoder.begin(logo_image.data, logo_image.header.data_size);
+    decoder.read(raw, pixels);
+    uint32_t rle_size = gfx.getImageManager().compressRGB565RLE(raw, w, h, rle, pixels * 3);
+
+    Serial.printf("Images (%ux%u logo):\n", w, h);
+    gfx.fillScreen(COLOR_BLACK);
+    reportImage(gfx, "Raw", Image(w, h, IMAGE_RGB565_RAW, (const uint8_t*)raw));
+    reportImage(gfx, "RLE", Image(w, h, IMAGE_RGB565_RLE, rle, rle_size));
+    reportImage(gfx, "QOI", logo_image);
+
+    // Indexed copies: the logo only has a handful of colours
+    uint16_t palette[16];
+    uint16_t colors = 0;
+    uint32_t row4 = imageIndexRowBytes(IMAGE_BITMAP_4BIT, w);
+    uint8_t* idx8 = rle;                  // Reuses the RLE buffer
+    uint8_t* idx4 = rle + pixels;
+    memset(idx4, 0, row4 * h);
+    for (uint32_t i = 0; i < pixels; i++) {
+        uint16_t c = 0;
+        while (c < colors && palette[c] != raw[i]) c++;
+        if (c == colors) {
+            if (colors == 16) break;
+            palette[colors++] = raw[i];
+        }
+        uint16_t col = i % w;
+        idx8[i] = c;
+        idx4[(i / w) * row4 + col / 2] |= (col & 1) ? c : c << 4;
+    }
+
+    if (colors < 16) {
+        reportImage(gfx, "4-bit indexed", Image(w, h, IMAGE_BITMAP_4BIT, idx4, palette, colors));
+        reportImage(gfx, "8-bit indexed", Image(w, h, IMAGE_BITMAP_8BIT, idx8, palette, colors));
+
+        // Recoloured at draw time, background index not drawn
+        uint16_t warning[16];
+        for (uint16_t i = 0; i < colors; i++) {
+            warning[i] = palette[i] & COLOR_RED;
+        }
+        ImageDrawOptions options;
+        options.palette = warning;
+        options.palette_size = colors;
+        options.transparent_index = 0;
+        Image icon(w, h, IMAGE_BITMAP_4BIT, idx4, palette, colors);
+        report("4-bit, swapped palette + key", benchmarkUs([&]() { gfx.drawImage(75, 142, icon, options); }));
+    }
+
+    // Scaling: fixed-point nearest and bilinear, from memory and from the compressed asset
+    Image raw_logo(w, h, IMAGE_RGB565_RAW, (const uint8_t*)raw);
+    ImageDrawOptions half;
+    half.bilinear = true;
+    report("Raw 50%, bilinear", benchmarkUs([&]() { gfx.drawImageResized(75, 142, raw_logo, w / 2, h / 2, half); }));
+    reportZoom(gfx, "Zoom frame, raw nearest", raw_logo, false);
+    reportZoom(gfx, "Zoom frame, raw bilinear", raw_logo, true);
+    reportZoom(gfx, "Zoom frame, QOI nearest", logo_image, false);
+    reportZoom(gfx, "Zoom frame, QOI bilinear", logo_image, true);
+
+    heap_caps_free(raw);
+    heap_caps_free(rle);
+}
+
+// Whole-frame post-pass (channel tables vs the direct table) against
+// correcting colours as they are drawn
+static void benchmarkColorCorrection(Graphics& gfx) {
+    ColorCorrection& cc = gfx.getColorCorrection();
+    ColorCorrectionMode mode = gfx.getColorCorrectionMode();
+    ColorProfile saved = cc.getProfile();
+    bool had_direct = cc.hasDirectLUT();
+
+    Serial.println("Colour correction:");
+    cc.setTemperature(-30);
+    gfx.setColorCorrectionMode(CORRECTION_POST_PASS);
+    cc.enableDirectLUT(false);
+    report("Post-pass, channel LUTs", benchmarkUs([&]() { gfx.applyColorCorrection(); }));
+
+    if (cc.enableDirectLUT()) {
+        uint32_t start = micros();
+        cc.correctColor(0);     // Builds the 64K-entry table
+        report("Direct LUT rebuild", micros() - start);
+        report("Post-pass, direct LUT", benchmarkUs([&]() { gfx.applyColorCorrection(); }));
+
+        // Day/night transitions rebuild in slices into a back table
+        ColorProfile night;
+        night.gamma[2] = 1.5f;
+        night.saturation = 0.8f;
+        cc.setProfile(night, true);
+        start = micros();
+        cc.buildStep();
+        report("Direct LUT incremental step", micros() - start);
+        while (!cc.buildStep()) {}
+    }
+
+    gfx.useFreeSans9pt();
+    gfx.setTextColor(COLOR_WHITE, COLOR_DARKGRAY);
+    gfx.setColorCorrectionMode(CORRECTION_AT_DRAW);
+    report("Text block, corrected at draw", benchmarkUs([&]() { drawTextBlock(gfx); }));
+
+    cc.enableDirectLUT(had_direct);
+    cc.setProfile(saved);
+    gfx.setColorCorrectionMode(mode);
+}
+
+void runGfxBenchmarks(Graphics& gfx) {
+    bool tiled = gfx.isTiledRenderingEnabled();
+    gfx.enableTiledRendering(false);
+
+    Serial.println("=== Graphics Benchmarks ===");
+    benchmarkText(gfx);
+    benchmarkLines(gfx);
+    benchmarkBlits(gfx);
+    benchmarkImages(gfx);
+    benchmarkColorCorrection(gfx);
+    Serial.println("===========================");
+
+    gfx.fillScreen(COLOR_BLACK);
+    gfx.enableTiledRendering(tiled);
+}
@@ -0,0 +1,8 @@
+#pragma once
+#include <Arduino.h>
+#include "graphics.h"
+
+// Rendering micro-benchmarks
+// Build with -DGFX_BENCHMARK to run them once at startup; results go to Serial.
+// Each benchmark draws into the frame buffer, so call before the UI is shown.
+void runGfxBenchmarks(Graphics& gfx);
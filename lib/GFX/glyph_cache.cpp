@@ -0,0 +1,217 @@
+#include "glyph_cache.h"
+#include "esp_heap_caps.h"
+
+GlyphCache::GlyphCache() :
+    entries(nullptr),
+    pool(nullptr),
+    pool_used(0),
+    entry_count(0),
+    hits(0),
+    misses(0) {
+}
+
+GlyphCache::~GlyphCache() {
+    heap_caps_free(entries);
+    heap_caps_free(pool);
+}
+
+bool GlyphCache::begin() {
+    if (entries) return true;
+
+    // Table is probed on every character, so keep it in internal SRAM
+    entries = (CachedGlyph*)heap_caps_calloc(GLYPH_CACHE_ENTRIES, sizeof(CachedGlyph),
+                                             MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    pool = (uint8_t*)heap_caps_malloc(GLYPH_CACHE_POOL_SIZE, MALLOC_CAP_SPIRAM);
+
+    if (!entries || !pool) {
+        heap_caps_free(entries);
+        heap_caps_free(pool);
+        entries = nullptr;
+        pool = nullptr;
+        return false;
+    }
+
+    clear();
+    return true;
+}
+
+const CachedGlyph* GlyphCache::getGFX(const GFXfont* font, char c) {
+    if (!entries || !font) return nullptr;
+
+    uint8_t code = (uint8_t)c;
+    if (code < font->first || code > font->last) code = '?';
+
+    CachedGlyph* entry = findSlot(font, code, 1);
+    if (!entry) {
+        misses++;
+        return nullptr;
+    }
+    if (entry->font) {
+        hits++;
+        return entry;
+    }
+
+    if (!expandGFX(entry, font, code)) {
+        misses++;
+        return nullptr;
+    }
+    return entry;
+}
+
+const CachedGlyph* GlyphCache::getBuiltin(char c, uint8_t scale) {
+    if (!entries) return nullptr;
+
+    uint8_t code = (uint8_t)c;
+    if (code < 32 || code > 126) return nullptr;
+
+    CachedGlyph* entry = findSlot(builtin_font_5x8, code, scale);
+    if (!entry) {
+        misses++;
+        return nullptr;
+    }
+    if (entry->font) {
+        hits++;
+        return entry;
+    }
+
+    if (!expandBuiltin(entry, code, scale)) {
+        misses++;
+        return nullptr;
+    }
+    return entry;
+}
+
+void GlyphCache::clear() {
+    if (entries) {
+        memset(entries, 0, sizeof(CachedGlyph) * GLYPH_CACHE_ENTRIES);
+    }
+    pool_used = 0;
+    entry_count = 0;
+    hits = 0;
+    misses = 0;
+}
+
+// Private implementation functions
+CachedGlyph* GlyphCache::findSlot(const void* font, uint8_t code, uint8_t scale) {
+    uint32_t key = (uint32_t)(uintptr_t)font;
+    uint32_t idx = ((key >> 2) ^ (code * 31u) ^ (scale * 131u)) & (GLYPH_CACHE_ENTRIES - 1);
+
+    // Linear probing; an empty slot (font == nullptr) is returned for insertion
+    for (uint16_t probe = 0; probe < GLYPH_CACHE_ENTRIES; probe++) {
+        CachedGlyph* entry = &entries[idx];
+        if (!entry->font) return entry;
+        if (entry->font == font && entry->code == code && entry->scale == scale) return entry;
+        idx = (idx + 1) & (GLYPH_CACHE_ENTRIES - 1);
+    }
+    return nullptr;
+}
+
+GlyphSpan* GlyphCache::allocateSpans(uint16_t count) {
+    uint32_t bytes = count * sizeof(GlyphSpan);
+    if (pool_used + bytes > GLYPH_CACHE_POOL_SIZE) return nullptr;
+
+    GlyphSpan* spans = (GlyphSpan*)(pool + pool_used);
+    pool_used += bytes;
+    return spans;
+}
+
+bool GlyphCache::expandGFX(CachedGlyph* entry, const GFXfont* font, uint8_t code) {
+    // Keep a few slots free so probing never degrades to a full scan
+    if (entry_count >= GLYPH_CACHE_ENTRIES - 8) return false;
+
+    const GFXglyph* glyph = &font->glyph[code - font->first];
+    const uint8_t* bitmap = font->bitmap + glyph->bitmapOffset;
+    uint8_t w = glyph->width;
+    uint8_t h = glyph->height;
+
+    // Pass 1: count runs, pass 2: store them
+    uint16_t count = 0;
+    GlyphSpan* spans = nullptr;
+    for (uint8_t pass = 0; pass < 2; pass++) {
+        uint32_t bit = 0;
+        uint16_t n = 0;
+        for (uint8_t yy = 0; yy < h; yy++) {
+            int16_t run_start = -1;
+            for (uint8_t xx = 0; xx <= w; xx++, bit++) {
+                bool set = (xx < w) && (bitmap[bit >> 3] & (0x80 >> (bit & 7)));
+                if (set && run_start < 0) {
+                    run_start = xx;
+                } else if (!set && run_start >= 0) {
+                    if (spans) spans[n] = { yy, (uint8_t)run_start, (uint8_t)(xx - run_start) };
+                    n++;
+                    run_start = -1;
+                }
+            }
+            bit--;  // The sentinel column above does not consume a bit
+        }
+
+        if (pass == 0) {
+            count = n;
+            spans = allocateSpans(count);
+            if (!spans && count > 0) return false;
+        }
+    }
+
+    entry->font = font;
+    entry->code = code;
+    entry->scale = 1;
+    entry->x_offset = glyph->xOffset;
+    entry->y_offset = glyph->yOffset;
+    entry->width = w;
+    entry->height = h;
+    entry->span_count = count;
+    entry->spans = spans;
+    entry_count++;
+    return true;
+}
+
+bool GlyphCache::expandBuiltin(CachedGlyph* entry, uint8_t code, uint8_t scale) {
+    if (entry_count >= GLYPH_CACHE_ENTRIES - 8) return false;
+
+    const uint8_t* columns = builtin_font_5x8[code - 32];
+
+    // Each source row expands to 'scale' identical rows of scaled runs,
+    // emitted one output row at a time so the list stays row-ordered
+    uint16_t count = 0;
+    GlyphSpan* spans = nullptr;
+    for (uint8_t pass = 0; pass < 2; pass++) {
+        uint16_t n = 0;
+        for (uint8_t row = 0; row < 8; row++) {
+            for (uint8_t sy = 0; sy < scale; sy++) {
+                int8_t run_start = -1;
+                for (uint8_t col = 0; col <= 5; col++) {
+                    bool set = (col < 5) && (columns[col] & (1 << row));
+                    if (set && run_start < 0) {
+                        run_start = col;
+                    } else if (!set && run_start >= 0) {
+                        if (spans) {
+                            spans[n] = { (uint8_t)(row * scale + sy), (uint8_t)(run_start * scale),
+                                         (uint8_t)((col - run_start) * scale) };
+                        }
+                        n++;
+                        run_start = -1;
+                    }
+                }
+            }
+        }
+
+        if (pass == 0) {
+            count = n;
+            spans = allocateSpans(count);
+            if (!spans && count > 0) return false;
+        }
+    }
+
+    // Same cell layout as Graphics::drawCharBuiltin(): one blank row of padding on top
+    entry->font = builtin_font_5x8;
+    entry->code = code;
+    entry->scale = scale;
+    entry->x_offset = 0;
+    entry->y_offset = scale;
+    entry->width = 5 * scale;
+    entry->height = 8 * scale;
+    entry->span_count = count;
+    entry->spans = spans;
+    entry_count++;
+    return true;
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include <Arduino.h>
+#include "font_manager.h"
+
+// Cache configuration
+#define GLYPH_CACHE_ENTRIES     512          // Hash table slots (power of two)
+#define GLYPH_CACHE_POOL_SIZE   (48 * 1024)  // Span storage in PSRAM
+
+// One horizontal run of set pixels, relative to the glyph's top-left corner
+struct GlyphSpan {
+    uint8_t y;
+    uint8_t x;
+    uint8_t len;
+};
+
+// Pre-expanded glyph for one (font, character, scale)
+struct CachedGlyph {
+    const void* font;         // GFXfont* or the built-in font table
+    uint8_t code;
+    uint8_t scale;
+    int8_t x_offset;          // Cursor to top-left of bounding box
+    int8_t y_offset;
+    uint8_t width;
+    uint8_t height;
+    uint16_t span_count;
+    const GlyphSpan* spans;
+};
+
+// Glyph run cache
+// Each glyph is unpacked once into a row-ordered span list kept in PSRAM,
+// so text drawing becomes a handful of clipped span fills per character
+// instead of a bit test and bounds check per pixel.
+class GlyphCache {
+private:
+    CachedGlyph* entries;
+    uint8_t* pool;
+    uint32_t pool_used;
+    uint16_t entry_count;
+
+    // Statistics
+    uint32_t hits;
+    uint32_t misses;
+
+public:
+    GlyphCache();
+    ~GlyphCache();
+
+    // Allocate hash table and span pool
+    bool begin();
+    bool isReady() const { return entries != nullptr; }
+
+    // Lookup (expands the glyph on first use, nullptr if it cannot be cached)
+    const CachedGlyph* getGFX(const GFXfont* font, char c);
+    const CachedGlyph* getBuiltin(char c, uint8_t scale);
+
+    // Drop all cached glyphs
+    void clear();
+
+    // Statistics
+    uint16_t getGlyphCount() const { return entry_count; }
+    uint32_t getPoolUsed() const { return pool_used; }
+    uint32_t getHits() const { return hits; }
+    uint32_t getMisses() const { return misses; }
+
+private:
+    CachedGlyph* findSlot(const void* font, uint8_t code, uint8_t scale);
+    GlyphSpan* allocateSpans(uint16_t count);
+    bool expandGFX(CachedGlyph* entry, const GFXfont* font, uint8_t code);
+    bool expandBuiltin(CachedGlyph* entry, uint8_t code, uint8_t scale);
+};
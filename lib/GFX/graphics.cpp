@@ -1,6 +1,9 @@
 #include "graphics.h"
 #include "FreeSans9pt7b.h"
 #include "FreeSans18pt7b.h"
+#include "FreeSans9pt7bAA.h"
+#include "color_blend.h"
+#include "fixed_trig.h"
 #include <algorithm>
 
 // Helper macros for max/min if not available
@@ -11,10 +14,104 @@
 #define min(a,b) ((a)<(b)?(a):(b))
 #endif
 
+// Fill n pixels, two at a time once the destination is word aligned
+static inline void fillSpan(uint16_t* dst, int32_t n, uint16_t color) {
+    if (n <= 0) return;
+    if ((uintptr_t)dst & 2) {
+        *dst++ = color;
+        n--;
+    }
+    uint32_t pair = color | ((uint32_t)color << 16);
+    uint32_t* dst32 = (uint32_t*)dst;
+    for (int32_t i = n >> 1; i > 0; i--) {
+        *dst32++ = pair;
+    }
+    if (n & 1) {
+        *(uint16_t*)dst32 = color;
+    }
+}
+
+// Cohen-Sutherland outcodes against the target
+#define OUT_LEFT    1
+#define OUT_RIGHT   2
+#define OUT_TOP     4
+#define OUT_BOTTOM  8
+
+static inline uint8_t outcode(int32_t x, int32_t y, int32_t w, int32_t h) {
+    uint8_t code = 0;
+    if (x < 0) code |= OUT_LEFT;
+    else if (x >= w) code |= OUT_RIGHT;
+    if (y < 0) code |= OUT_TOP;
+    else if (y >= h) code |= OUT_BOTTOM;
+    return code;
+}
+
+// drawLine() steps the major axis every iteration; after k steps the minor
+// axis has moved this far (closed form of its error term)
+static inline int32_t bresenhamMinor(int32_t k, int32_t major, int32_t minor) {
+    return (int32_t)((2 * (int64_t)k * minor + major - 1) / (2 * (int64_t)major));
+}
+
+// First step at which the minor offset reaches m
+static inline int32_t bresenhamFirstStep(int32_t m, int32_t major, int32_t minor) {
+    if (m <= 0) return 0;
+    int64_t num = 2 * (int64_t)major * m - major + 1;
+    return (int32_t)((num + 2 * minor - 1) / (2 * minor));
+}
+
+// Offsets n >= 0 for which c0 + dir * n stays inside [0, limit)
+static inline void axisRange(int32_t c0, int32_t dir, int32_t limit, int32_t* lo, int32_t* hi) {
+    if (dir > 0) {
+        *lo = -c0;
+        *hi = limit - 1 - c0;
+    } else {
+        *lo = c0 - (limit - 1);
+        *hi = c0;
+    }
+}
+
+// Horizontal run of x positions (empty when lo > hi)
+struct XSpan {
+    int32_t lo, hi;
+};
+
+#define XSPAN_MIN   (-32768)
+#define XSPAN_MAX   32767
+
+static inline int32_t floorDiv(int32_t a, int32_t b) {
+    int32_t q = a / b;
+    if ((a % b != 0) && ((a < 0) != (b < 0))) q--;
+    return q;
+}
+
+static inline int32_t ceilDiv(int32_t a, int32_t b) {
+    return -floorDiv(-a, b);
+}
+
+// Positions on row y (relative to the centre) on one side of direction (vx, vy):
+// clockwise of it when 'clockwise' is set, otherwise anticlockwise
+static XSpan halfPlaneSpan(int32_t vx, int32_t vy, int32_t y, bool clockwise) {
+    // Sign of the cross product v x p = vx * y - vy * x
+    int32_t c = vx * y;
+    if (vy == 0) {
+        bool all = clockwise ? (c >= 0) : (c <= 0);
+        return all ? XSpan{XSPAN_MIN, XSPAN_MAX} : XSpan{1, 0};
+    }
+    if ((vy > 0) == clockwise) {
+        return XSpan{XSPAN_MIN, floorDiv(c, vy)};
+    }
+    return XSpan{ceilDiv(c, vy), XSPAN_MAX};
+}
+
 // Constructor
 Graphics::Graphics() : 
     frame_buffer(nullptr),
     font_manager(nullptr),
+    target(nullptr),
+    target_w(LCD_H_RES),
+    target_h(LCD_V_RES),
+    target_stride(LCD_H_RES),
+    target_surface(nullptr),
     cursor_x(0),
     cursor_y(0),
     text_color(COLOR_WHITE),
@@ -32,6 +129,11 @@ bool Graphics::begin(uint16_t* fb, FontManager* fm) {
     if (!fb || !fm) return false;
     
     frame_buffer = fb;
+    target = fb;
+    target_w = LCD_H_RES;
+    target_h = LCD_V_RES;
+    target_stride = LCD_H_RES;
+    target_surface = nullptr;
     font_manager = fm;
     
     // Initialize image manager - ADD THIS
@@ -39,79 +141,305 @@ bool Graphics::begin(uint16_t* fb, FontManager* fm) {
         return false;
     }
     
+    // GDMA is optional - blits fall back to memcpy without it
+    blit_engine.begin();
+    image_manager.setBlitEngine(&blit_engine);
+    
+    // Glyph cache is optional - text falls back to bitmap unpacking without it
+    glyph_cache.begin();
+    aa_cache.begin();
+    
     return true;
 }
 
+// Render target
+bool Graphics::setTarget(Surface* surface) {
+    if (!surface || !surface->isReady()) return false;
+    
+    target_surface = surface;
+    target = surface->getPixels();
+    target_w = surface->getWidth();
+    target_h = surface->getHeight();
+    target_stride = surface->getStride();
+    image_manager.setTarget(target, target_w, target_h, target_stride);
+    return true;
+}
+
+void Graphics::resetTarget() {
+    target_surface = nullptr;
+    target = frame_buffer;
+    target_w = LCD_H_RES;
+    target_h = LCD_V_RES;
+    target_stride = LCD_H_RES;
+    image_manager.setTarget(target, target_w, target_h, target_stride);
+}
+
 // Basic drawing functions
 void Graphics::fillScreen(uint16_t color) {
-    for (int i = 0; i < LCD_H_RES * LCD_V_RES; i++) {
-        frame_buffer[i] = color;
+    color = drawColor(color);
+    if (recording()) {
+        tile_renderer.addFill(0, 0, target_w, target_h, color);
+        return;
+    }
+    markUntracked(0, 0, target_w, target_h);
+    
+    if (target_stride == target_w) {
+        fillSpan(target, target_w * target_h, color);
+        return;
+    }
+    uint16_t* row = target;
+    for (int16_t py = 0; py < target_h; py++, row += target_stride) {
+        fillSpan(row, target_w, color);
     }
 }
 
 void Graphics::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
-    for (int16_t py = y; py < y + h; py++) {
-        if (py >= 0 && py < LCD_V_RES) {
-            for (int16_t px = x; px < x + w; px++) {
-                if (px >= 0 && px < LCD_H_RES) {
-                    frame_buffer[py * LCD_H_RES + px] = color;
-                }
-            }
-        }
-    }
+    fillRectRaw(x, y, w, h, drawColor(color));
+}
+
+void Graphics::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    hLineRaw(x, y, w, drawColor(color));
+}
+
+void Graphics::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    vLineRaw(x, y, h, drawColor(color));
 }
 
 void Graphics::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    pixelRaw(x, y, drawColor(color));
+}
+
+// Primitives below take colours that are already corrected
+void Graphics::fillRectRaw(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (recording()) {
+        tile_renderer.addFill(x, y, w, h, color);
+        return;
+    }
+    
+    // Clip once, then fill whole spans
+    int16_t x1 = max(x, 0);
+    int16_t y1 = max(y, 0);
+    int16_t x2 = min(x + w, target_w);
+    int16_t y2 = min(y + h, target_h);
+    if (x1 >= x2 || y1 >= y2) return;
+    markUntracked(x1, y1, x2 - x1, y2 - y1);
+    
+    uint16_t* row = target + y1 * target_stride + x1;
+    for (int16_t py = y1; py < y2; py++, row += target_stride) {
+        fillSpan(row, x2 - x1, color);
+    }
+}
+
+void Graphics::hLineRaw(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    if (recording()) {
+        tile_renderer.addFill(x, y, w, 1, color);
+        return;
+    }
+    if (y < 0 || y >= target_h) return;
+    
+    int16_t x1 = max(x, 0);
+    int16_t x2 = min(x + w, target_w);
+    if (x1 >= x2) return;
+    markUntracked(x1, y, x2 - x1, 1);
+    
+    fillSpan(target + y * target_stride + x1, x2 - x1, color);
+}
+
+void Graphics::vLineRaw(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    if (recording()) {
+        tile_renderer.addFill(x, y, 1, h, color);
+        return;
+    }
+    if (x < 0 || x >= target_w) return;
+    
+    int16_t y1 = max(y, 0);
+    int16_t y2 = min(y + h, target_h);
+    if (y1 >= y2) return;
+    markUntracked(x, y1, 1, y2 - y1);
+    
+    uint16_t* dst = target + y1 * target_stride + x;
+    for (int16_t py = y1; py < y2; py++, dst += target_stride) {
+        *dst = color;
+    }
+}
+
+void Graphics::pixelRaw(int16_t x, int16_t y, uint16_t color) {
     if (isValidCoordinate(x, y)) {
-        frame_buffer[y * LCD_H_RES + x] = color;
+        target[y * target_stride + x] = color;
+        markUntracked(x, y, 1, 1);
     }
 }
 
 void Graphics::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
-    int16_t dx = abs(x1 - x0);
-    int16_t dy = abs(y1 - y0);
-    int16_t sx = (x0 < x1) ? 1 : -1;
-    int16_t sy = (y0 < y1) ? 1 : -1;
-    int16_t err = dx - dy;
-    
-    while (true) {
-        drawPixel(x0, y0, color);
+    color = drawColor(color);
+    
+    // Axis-aligned lines are spans
+    if (y0 == y1) {
+        hLineRaw(min(x0, x1), y0, abs(x1 - x0) + 1, color);
+        return;
+    }
+    if (x0 == x1) {
+        vLineRaw(x0, min(y0, y1), abs(y1 - y0) + 1, color);
+        return;
+    }
+    
+    // Clip against the screen up front so the loop below needs no checks
+    uint8_t code0 = outcode(x0, y0, target_w, target_h);
+    uint8_t code1 = outcode(x1, y1, target_w, target_h);
+    if (code0 & code1) return;
+    
+    int32_t dx = abs(x1 - x0);
+    int32_t dy = abs(y1 - y0);
+    int32_t sx = (x0 < x1) ? 1 : -1;
+    int32_t sy = (y0 < y1) ? 1 : -1;
+    bool x_major = dx >= dy;
+    int32_t major = x_major ? dx : dy;
+    int32_t minor = x_major ? dy : dx;
+    int32_t first = 0;
+    int32_t last = major;
+    
+    if (code0 | code1) {
+        // Clip the range of steps rather than the end points, so the visible
+        // pixels are exactly those of the unclipped line
+        int32_t lo, hi;
+        if (x_major) axisRange(x0, sx, target_w, &lo, &hi);
+        else         axisRange(y0, sy, target_h, &lo, &hi);
+        first = max(first, lo);
+        last = min(last, hi);
         
-        if (x0 == x1 && y0 == y1) break;
+        if (x_major) axisRange(y0, sy, target_h, &lo, &hi);
+        else         axisRange(x0, sx, target_w, &lo, &hi);
+        if (hi < 0) return;
+        first = max(first, bresenhamFirstStep(lo, major, minor));
+        last = min(last, bresenhamFirstStep(hi + 1, major, minor) - 1);
+        if (first > last) return;
+    }
+    
+    // Bresenham state at the first visible step
+    int32_t m = bresenhamMinor(first, major, minor);
+    int32_t px = x0 + sx * (x_major ? first : m);
+    int32_t py = y0 + sy * (x_major ? m : first);
+    int64_t x_steps = x_major ? first : m;
+    int64_t y_steps = x_major ? m : first;
+    int32_t err = (int32_t)(dx - dy - x_steps * dy + y_steps * dx);
+    
+    int32_t m_end = bresenhamMinor(last, major, minor);
+    int32_t ex = x0 + sx * (x_major ? last : m_end);
+    int32_t ey = y0 + sy * (x_major ? m_end : last);
+    markUntracked(min(px, ex), min(py, ey), abs(ex - px) + 1, abs(ey - py) + 1);
+    
+    int32_t step_y = sy * target_stride;
+    uint16_t* dst = target + py * target_stride + px;
+    
+    for (int32_t i = first; i <= last; i++) {
+        *dst = color;
         
-        int16_t e2 = 2 * err;
+        int32_t e2 = 2 * err;
         if (e2 > -dy) {
             err -= dy;
-            x0 += sx;
+            dst += sx;
         }
         if (e2 < dx) {
             err += dx;
-            y0 += sy;
+            dst += step_y;
+        }
+    }
+}
+
+void Graphics::drawLineAA(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color, uint8_t thickness) {
+    drawLineAAFixed(x0 * 256, y0 * 256, x1 * 256, y1 * 256, color, thickness);
+}
+
+void Graphics::drawLineAAFixed(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t color, uint8_t thickness) {
+    if (thickness == 0) return;
+    color = drawColor(color);
+    
+    // Walk the major axis; 'steep' lines swap x and y so the major axis is always "x"
+    bool steep = abs(y1 - y0) > abs(x1 - x0);
+    if (steep) {
+        std::swap(x0, y0);
+        std::swap(x1, y1);
+    }
+    if (x0 > x1) {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+    }
+    int32_t dx = x1 - x0;
+    int32_t dy = y1 - y0;
+    int32_t major_limit = steep ? target_h : target_w;
+    int32_t minor_limit = steep ? target_w : target_h;
+    
+    // Half of the span along the minor axis that gives the requested
+    // perpendicular thickness (16.16), and the minor step per major pixel
+    float length = sqrtf((float)dx * dx + (float)dy * dy);
+    int64_t half = dx ? (int64_t)(thickness * length / dx * 32768.0f) : ((int64_t)thickness << 15);
+    int64_t gradient = dx ? (int64_t)dy * 65536 / dx : 0;
+    
+    int32_t first = max((x0 + 128) >> 8, 0);
+    int32_t last = min((x1 + 128) >> 8, major_limit - 1);
+    if (first > last) return;
+    
+    // Minor-axis centre at the first column, shifted half a pixel so row r covers [r, r + 1)
+    int64_t center = (int64_t)y0 * 256 + ((gradient * ((int64_t)first * 256 - x0)) >> 8) + 32768;
+    
+    int64_t center_last = center + gradient * (last - first);
+    int32_t r_min = (int32_t)((min(center, center_last) - half) >> 16);
+    int32_t r_max = (int32_t)((max(center, center_last) + half) >> 16);
+    r_min = max(r_min, 0);
+    r_max = min(r_max, minor_limit - 1);
+    if (r_min > r_max) return;
+    if (steep) markUntracked(r_min, first, r_max - r_min + 1, last - first + 1);
+    else       markUntracked(first, r_min, last - first + 1, r_max - r_min + 1);
+    
+    for (int32_t major = first; major <= last; major++, center += gradient) {
+        int64_t top = center - half;
+        int64_t bottom = center + half;
+        int32_t r0 = max((int32_t)(top >> 16), 0);
+        int32_t r1 = min((int32_t)(bottom >> 16), minor_limit - 1);
+        
+        for (int32_t r = r0; r <= r1; r++) {
+            // Covered part of this pixel (16.16) as a 0..32 blend weight
+            int64_t cover = min(bottom, ((int64_t)r + 1) << 16) - max(top, (int64_t)r << 16);
+            uint32_t alpha = (uint32_t)(cover >> 11);
+            if (alpha == 0) continue;
+            
+            uint16_t* dst = steep ? &target[major * target_stride + r] : &target[r * target_stride + major];
+            *dst = (alpha >= 32) ? color : blendRGB565_32(color, *dst, alpha);
         }
     }
 }
 
 void Graphics::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
-    drawLine(x, y, x + w - 1, y, color);         // Top
-    drawLine(x, y + h - 1, x + w - 1, y + h - 1, color); // Bottom
-    drawLine(x, y, x, y + h - 1, color);         // Left
-    drawLine(x + w - 1, y, x + w - 1, y + h - 1, color); // Right
+    if (w <= 0 || h <= 0) return;
+    color = drawColor(color);
+    
+    hLineRaw(x, y, w, color);                      // Top
+    if (h > 1) {
+        hLineRaw(x, y + h - 1, w, color);          // Bottom
+    }
+    if (h > 2) {
+        vLineRaw(x, y + 1, h - 2, color);          // Left
+        if (w > 1) {
+            vLineRaw(x + w - 1, y + 1, h - 2, color); // Right
+        }
+    }
 }
 
 void Graphics::drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+    color = drawColor(color);
     int16_t x = r;
     int16_t y = 0;
     int16_t err = 0;
     
     while (x >= y) {
-        drawPixel(x0 + x, y0 + y, color);
-        drawPixel(x0 + y, y0 + x, color);
-        drawPixel(x0 - y, y0 + x, color);
-        drawPixel(x0 - x, y0 + y, color);
-        drawPixel(x0 - x, y0 - y, color);
-        drawPixel(x0 - y, y0 - x, color);
-        drawPixel(x0 + y, y0 - x, color);
-        drawPixel(x0 + x, y0 - y, color);
+        pixelRaw(x0 + x, y0 + y, color);
+        pixelRaw(x0 + y, y0 + x, color);
+        pixelRaw(x0 - y, y0 + x, color);
+        pixelRaw(x0 - x, y0 + y, color);
+        pixelRaw(x0 - x, y0 - y, color);
+        pixelRaw(x0 - y, y0 - x, color);
+        pixelRaw(x0 + y, y0 - x, color);
+        pixelRaw(x0 + x, y0 - y, color);
         
         if (err <= 0) {
             y += 1;
@@ -125,10 +453,91 @@ void Graphics::drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
 }
 
 void Graphics::fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
-    for (int16_t y = -r; y <= r; y++) {
-        for (int16_t x = -r; x <= r; x++) {
-            if (x * x + y * y <= r * r) {
-                drawPixel(x0 + x, y0 + y, color);
+    if (r < 0) return;
+    color = drawColor(color);
+    
+    // Track the edge incrementally and fill one span per row
+    int32_t r2 = (int32_t)r * r;
+    int32_t x = r;
+    for (int32_t dy = 0; dy <= r; dy++) {
+        while (x * x + dy * dy > r2) x--;
+        hLineRaw(x0 - x, y0 + dy, 2 * x + 1, color);
+        if (dy) {
+            hLineRaw(x0 - x, y0 - dy, 2 * x + 1, color);
+        }
+    }
+}
+
+void Graphics::fillArc(int16_t x0, int16_t y0, int16_t r_outer, int16_t r_inner,
+                       int16_t start_angle, int16_t end_angle, uint16_t color) {
+    if (r_inner < 0) r_inner = 0;
+    if (r_outer < 0 || r_inner > r_outer) return;
+    color = drawColor(color);
+    
+    int32_t sweep = end_angle - start_angle;
+    if (sweep <= 0) return;
+    bool full = sweep >= 360;
+    bool wide = sweep > 180;
+    
+    // Sector edges as Q14 direction vectors
+    int32_t sx = icos(start_angle);
+    int32_t sy = isin(start_angle);
+    int32_t ex = icos(end_angle);
+    int32_t ey = isin(end_angle);
+    
+    int32_t ro2 = (int32_t)r_outer * r_outer;
+    int32_t ri2 = (int32_t)r_inner * r_inner;
+    int32_t xo = r_outer;        // Last x inside the outer radius
+    int32_t xi = r_inner - 1;    // Last x inside the hole (-1 when the row misses it)
+    
+    for (int32_t dy = 0; dy <= r_outer; dy++) {
+        while (xo * xo + dy * dy > ro2) xo--;
+        while (xi >= 0 && xi * xi + dy * dy >= ri2) xi--;
+        
+        for (uint8_t side = 0; side < (dy ? 2 : 1); side++) {
+            int32_t y = side ? -dy : dy;
+            
+            // Ring: up to two runs either side of the hole
+            XSpan ring[2];
+            uint8_t ring_count = 0;
+            if (xi < 0) {
+                ring[ring_count++] = {-xo, xo};
+            } else {
+                ring[ring_count++] = {-xo, -xi - 1};
+                ring[ring_count++] = {xi + 1, xo};
+            }
+            
+            // Sector: clockwise of the start edge and anticlockwise of the end edge
+            // (both for up to 180 degrees, either beyond that)
+            XSpan sector[2];
+            uint8_t sector_count = 0;
+            if (full) {
+                sector[sector_count++] = {XSPAN_MIN, XSPAN_MAX};
+            } else {
+                XSpan a = halfPlaneSpan(sx, sy, y, true);
+                XSpan b = halfPlaneSpan(ex, ey, y, false);
+                if (!wide) {
+                    sector[sector_count++] = {max(a.lo, b.lo), min(a.hi, b.hi)};
+                } else if (a.lo > a.hi) {
+                    sector[sector_count++] = b;
+                } else if (b.lo > b.hi) {
+                    sector[sector_count++] = a;
+                } else if (a.lo <= b.hi + 1 && b.lo <= a.hi + 1) {
+                    sector[sector_count++] = {min(a.lo, b.lo), max(a.hi, b.hi)};
+                } else {
+                    sector[sector_count++] = a;
+                    sector[sector_count++] = b;
+                }
+            }
+            
+            for (uint8_t i = 0; i < ring_count; i++) {
+                for (uint8_t j = 0; j < sector_count; j++) {
+                    int32_t lo = max(ring[i].lo, sector[j].lo);
+                    int32_t hi = min(ring[i].hi, sector[j].hi);
+                    if (lo <= hi) {
+                        hLineRaw(x0 + lo, y0 + y, hi - lo + 1, color);
+                    }
+                }
             }
         }
     }
@@ -152,11 +561,17 @@ void Graphics::setTextColor(uint16_t fg_color, uint16_t bg_color) {
 }
 
 void Graphics::print(const char* str) {
+    // Correct the text colours once for the whole string
+    uint16_t fg = drawColor(text_color);
+    uint16_t bg = drawColor(text_bg_color);
+    
     while (*str) {
         if (*str == '\n') {
             cursor_x = 0;
             if (font_manager->isBuiltinFont()) {
                 cursor_y += 10 * font_manager->getBuiltinScale();
+            } else if (font_manager->isAAFont()) {
+                cursor_y += font_manager->getCurrentAAFont()->yAdvance;
             } else {
                 const GFXfont* font = font_manager->getCurrentGFXFont();
                 if (font) {
@@ -166,11 +581,16 @@ void Graphics::print(const char* str) {
                 }
             }
         } else {
-            drawChar(cursor_x, cursor_y, *str, text_color, text_bg_color, text_bg_enabled);
+            drawChar(cursor_x, cursor_y, *str, fg, bg, text_bg_enabled);
             
             // Advance cursor
             if (font_manager->isBuiltinFont()) {
                 cursor_x += 6 * font_manager->getBuiltinScale();
+            } else if (font_manager->isAAFont()) {
+                const AAFont* font = font_manager->getCurrentAAFont();
+                if (*str >= font->first && *str <= font->last) {
+                    cursor_x += font->glyph[*str - font->first].xAdvance;
+                }
             } else {
                 const GFXfont* font = font_manager->getCurrentGFXFont();
                 if (font && *str >= font->first && *str <= font->last) {
@@ -228,14 +648,26 @@ void Graphics::useFreeSans18pt7b() {
     font_manager->setFont(&FreeSans18pt7b);
 }
 
+void Graphics::useFreeSans9ptAA() {
+    font_manager->setFont(&FreeSans9pt7bAA);
+}
+
 void Graphics::setFont(const GFXfont* font) {
     font_manager->setFont(font);
 }
 
+void Graphics::setFont(const AAFont* font) {
+    font_manager->setFont(font);
+}
+
 void Graphics::setFont(FontType font_type) {
     font_manager->setFont(font_type);
 }
 
+bool Graphics::useFontAsset(uint16_t asset_id) {
+    return font_manager->setFontAsset(asset_id);
+}
+
 // Advanced text functions
 void Graphics::printLabel(int16_t x, int16_t y, const char* text) {
     useFreeSans9pt();
@@ -303,6 +735,8 @@ void Graphics::color565ToRGB(uint16_t color, uint8_t* r, uint8_t* g, uint8_t* b)
 void Graphics::drawChar(int16_t x, int16_t y, char c, uint16_t fg_color, uint16_t bg_color, bool draw_bg) {
     if (font_manager->isBuiltinFont()) {
         drawCharBuiltin(x, y, c, fg_color, bg_color, draw_bg, font_manager->getBuiltinScale());
+    } else if (font_manager->isAAFont()) {
+        drawCharAA(x, y, c, fg_color, bg_color, draw_bg);
     } else {
         drawCharGFX(x, y, c, fg_color, bg_color, draw_bg);
     }
@@ -319,7 +753,24 @@ void Graphics::drawCharBuiltin(int16_t x, int16_t y, char c, uint16_t fg_color,
     
     // Clear full background cell if enabled
     if (draw_bg) {
-        fillRect(x, y, char_width, char_height, bg_color);
+        fillRectRaw(x, y, char_width, char_height, bg_color);
+    }
+    
+    const CachedGlyph* glyph = glyph_cache.getBuiltin(c, scale);
+    
+    if (recording()) {
+        if (glyph) {
+            tile_renderer.addGlyphSpans(x, y, glyph, fg_color);
+        } else {
+            tile_renderer.addGlyphBuiltin(x, y, scale, char_data, fg_color);
+        }
+        return;
+    }
+    markUntracked(x, y, char_width, char_height);
+    
+    if (glyph) {
+        blitGlyph(glyph, x, y, fg_color);
+        return;
     }
     
     // Draw character pixels with proper centering
@@ -333,7 +784,7 @@ void Graphics::drawCharBuiltin(int16_t x, int16_t y, char c, uint16_t fg_color,
                         int16_t px = x + col * scale + sx;
                         int16_t py = y + scale + row * scale + sy;
                         if (isValidCoordinate(px, py)) {
-                            frame_buffer[py * LCD_H_RES + px] = fg_color;
+                            target[py * target_stride + px] = fg_color;
                         }
                     }
                 }
@@ -365,7 +816,24 @@ void Graphics::drawCharGFX(int16_t x, int16_t y, char c, uint16_t fg_color, uint
         int16_t bg_w = xa;
         int16_t bg_h = 20;
         
-        fillRect(bg_x, bg_y, bg_w, bg_h, bg_color);
+        fillRectRaw(bg_x, bg_y, bg_w, bg_h, bg_color);
+    }
+    
+    const CachedGlyph* cached = glyph_cache.getGFX(font, c);
+    
+    if (recording()) {
+        if (cached) {
+            tile_renderer.addGlyphSpans(x, y, cached, fg_color);
+        } else {
+            tile_renderer.addGlyphGFX(x + xo, y + yo, w, h, bitmap + bo, fg_color);
+        }
+        return;
+    }
+    markUntracked(x + xo, y + yo, w, h);
+    
+    if (cached) {
+        blitGlyph(cached, x, y, fg_color);
+        return;
     }
     
     // Draw character bitmap
@@ -381,7 +849,7 @@ void Graphics::drawCharGFX(int16_t x, int16_t y, char c, uint16_t fg_color, uint
             
             if (isValidCoordinate(px, py)) {
                 if (bits & 0x80) {
-                    frame_buffer[py * LCD_H_RES + px] = fg_color;
+                    target[py * target_stride + px] = fg_color;
                 }
             }
             bits <<= 1;
@@ -389,55 +857,264 @@ void Graphics::drawCharGFX(int16_t x, int16_t y, char c, uint16_t fg_color, uint
     }
 }
 
+void Graphics::drawCharAA(int16_t x, int16_t y, char c, uint16_t fg_color, uint16_t bg_color, bool draw_bg) {
+    const AAFont* font = font_manager->getCurrentAAFont();
+    if (!font) return;
+    
+    if (c < font->first || c > font->last) c = '?';
+    
+    const AAGlyph* glyph = &font->glyph[c - font->first];
+    const uint8_t* coverage = font->bitmap + glyph->bitmapOffset;
+    uint8_t w = glyph->width;
+    uint8_t h = glyph->height;
+    int8_t xo = glyph->xOffset;
+    int8_t yo = glyph->yOffset;
+    
+    // Background cell spans roughly ascender to descender
+    if (draw_bg) {
+        fillRectRaw(x, y - (font->yAdvance * 3) / 4, glyph->xAdvance, font->yAdvance, bg_color);
+    }
+    
+    if (recording()) {
+        tile_renderer.addGlyphAA(x + xo, y + yo, w, h, coverage, fg_color);
+        return;
+    }
+    markUntracked(x + xo, y + yo, w, h);
+    
+    // Known background: pre-blended runs; otherwise runs of blend weights
+    const BlendedGlyph* cached = draw_bg ? aa_cache.get(font, c, fg_color, bg_color)
+                                         : aa_cache.getCoverage(font, c, fg_color);
+    if (cached) {
+        blitBlendedGlyph(cached, x, y);
+        return;
+    }
+    
+    // Cache unavailable: decode coverage and blend against the frame buffer
+    int16_t gx = x + xo;
+    int16_t gy = y + yo;
+    int16_t x1 = max(gx, 0);
+    int16_t y1 = max(gy, 0);
+    int16_t x2 = min(gx + w, target_w);
+    int16_t y2 = min(gy + h, target_h);
+    uint16_t row_bytes = (w + 1) / 2;
+    
+    for (int16_t py = y1; py < y2; py++) {
+        const uint8_t* row = coverage + (py - gy) * row_bytes;
+        uint16_t* dst = target + py * target_stride + x1;
+        for (int16_t px = x1; px < x2; px++, dst++) {
+            int16_t xx = px - gx;
+            uint8_t cov = (row[xx >> 1] >> ((xx & 1) ? 0 : 4)) & 0x0F;
+            if (cov == 15) {
+                *dst = fg_color;
+            } else if (cov) {
+                *dst = blendRGB565_4bit(fg_color, *dst, cov);
+            }
+        }
+    }
+}
+
+// Draw a cached AA glyph: solid runs are fills, edge runs are copies or blends
+void Graphics::blitBlendedGlyph(const BlendedGlyph* glyph, int16_t x, int16_t y) {
+    int16_t gx = x + glyph->x_offset;
+    int16_t gy = y + glyph->y_offset;
+    if (gx >= target_w || gy >= target_h || gx + glyph->width <= 0 || gy + glyph->height <= 0) return;
+    
+    bool clipped = gx < 0 || gy < 0 || gx + glyph->width > target_w || gy + glyph->height > target_h;
+    const uint16_t* colors = glyph->colors;
+    const AARun* run = glyph->runs;
+    const AARun* end = run + glyph->run_count;
+    
+    for (; run < end; run++) {
+        const uint16_t* src = colors;
+        if (!run->solid) colors += run->len;
+        
+        int16_t py = gy + run->y;
+        int16_t x1 = gx + run->x;
+        int16_t x2 = x1 + run->len;
+        if (clipped) {
+            if (py < 0 || py >= target_h) continue;
+            if (x1 < 0) {
+                src -= x1;
+                x1 = 0;
+            }
+            x2 = min(x2, target_w);
+        }
+        
+        uint16_t* dst = target + py * target_stride + x1;
+        if (run->solid) {
+            for (int16_t px = x1; px < x2; px++) {
+                *dst++ = glyph->fg;
+            }
+        } else if (glyph->blended) {
+            if (x2 > x1) memcpy(dst, src, (x2 - x1) * sizeof(uint16_t));
+        } else {
+            for (int16_t px = x1; px < x2; px++, dst++) {
+                *dst = blendRGB565_32(glyph->fg, *dst, *src++);
+            }
+        }
+    }
+}
+
+// Draw a cached glyph as span fills; clipping is decided once per glyph
+void Graphics::blitGlyph(const CachedGlyph* glyph, int16_t x, int16_t y, uint16_t color) {
+    int16_t gx = x + glyph->x_offset;
+    int16_t gy = y + glyph->y_offset;
+    if (gx >= target_w || gy >= target_h || gx + glyph->width <= 0 || gy + glyph->height <= 0) return;
+    
+    const GlyphSpan* span = glyph->spans;
+    const GlyphSpan* end = span + glyph->span_count;
+    
+    if (gx >= 0 && gy >= 0 && gx + glyph->width <= target_w && gy + glyph->height <= target_h) {
+        // Fully visible - unchecked span writes
+        uint16_t* origin = target + gy * target_stride + gx;
+        for (; span < end; span++) {
+            uint16_t* dst = origin + span->y * target_stride + span->x;
+            for (uint8_t n = span->len; n > 0; n--) {
+                *dst++ = color;
+            }
+        }
+        return;
+    }
+    
+    // Partially visible - clip each span
+    for (; span < end; span++) {
+        int16_t py = gy + span->y;
+        if (py < 0 || py >= target_h) continue;
+        
+        int16_t x1 = max(gx + span->x, 0);
+        int16_t x2 = min(gx + span->x + span->len, target_w);
+        uint16_t* dst = target + py * target_stride + x1;
+        for (int16_t px = x1; px < x2; px++) {
+            *dst++ = color;
+        }
+    }
+}
+
 // Helper functions
 bool Graphics::isValidCoordinate(int16_t x, int16_t y) const {
-    return (x >= 0 && x < LCD_H_RES && y >= 0 && y < LCD_V_RES);
+    return (x >= 0 && x < target_w && y >= 0 && y < target_h);
 }
 
 void Graphics::setPixelUnsafe(int16_t x, int16_t y, uint16_t color) {
-    frame_buffer[y * LCD_H_RES + x] = color;
+    target[y * target_stride + x] = color;
 }
 
 // Image drawing functions
 void Graphics::drawImage(int16_t x, int16_t y, const Image& image) {
+    markUntracked(x, y, image.header.width, image.header.height);
     image_manager.drawImage(x, y, image);
 }
 
 void Graphics::drawImage(int16_t x, int16_t y, const Image& image, const ImageDrawOptions& options) {
+    markUntracked(x, y, (int16_t)(image.header.width * options.scale_x), (int16_t)(image.header.height * options.scale_y));
     image_manager.drawImage(x, y, image, options);
 }
 
+void Graphics::setAssetBundle(const AssetBundle* bundle) {
+    image_manager.setAssetBundle(bundle);
+    if (font_manager) font_manager->setAssetBundle(bundle);
+}
+
+void Graphics::drawAsset(int16_t x, int16_t y, uint16_t asset_id) {
+    drawImage(x, y, image_manager.getAsset(asset_id));
+}
+
+void Graphics::drawAsset(int16_t x, int16_t y, uint16_t asset_id, const ImageDrawOptions& options) {
+    drawImage(x, y, image_manager.getAsset(asset_id), options);
+}
+
 void Graphics::drawRGB565(int16_t x, int16_t y, uint16_t width, uint16_t height, const uint16_t* data) {
+    markUntracked(x, y, width, height);
     image_manager.drawRGB565(x, y, width, height, data);
 }
 
 void Graphics::drawRGB565(int16_t x, int16_t y, uint16_t width, uint16_t height, const uint16_t* data, uint16_t transparent_color) {
+    markUntracked(x, y, width, height);
     image_manager.drawRGB565(x, y, width, height, data, transparent_color);
 }
 
+bool Graphics::drawRGB565Async(int16_t x, int16_t y, uint16_t width, uint16_t height, const uint16_t* data,
+                               BlitCallback callback, void* arg) {
+    markUntracked(x, y, width, height);
+    return image_manager.drawRGB565Async(x, y, width, height, data, callback, arg);
+}
+
 void Graphics::drawBitmap(int16_t x, int16_t y, uint16_t width, uint16_t height, const uint8_t* bitmap, uint16_t fg_color, uint16_t bg_color) {
+    markUntracked(x, y, width, height);
     image_manager.drawBitmap(x, y, width, height, bitmap, fg_color, bg_color);
 }
 
 void Graphics::drawBitmap(int16_t x, int16_t y, uint16_t width, uint16_t height, const uint8_t* bitmap, uint16_t fg_color) {
+    markUntracked(x, y, width, height);
     image_manager.drawBitmap(x, y, width, height, bitmap, fg_color);
 }
 
 void Graphics::drawImageScaled(int16_t x, int16_t y, const Image& image, float scale_x, float scale_y) {
+    markUntracked(x, y, (int16_t)(image.header.width * scale_x), (int16_t)(image.header.height * scale_y));
     image_manager.drawImageScaled(x, y, image, scale_x, scale_y);
 }
 
+void Graphics::drawImageResized(int16_t x, int16_t y, const Image& image, uint16_t width, uint16_t height,
+                                const ImageDrawOptions& options) {
+    markUntracked(x, y, width, height);
+    image_manager.drawImageResized(x, y, image, width, height, options);
+}
+
+bool Graphics::loadImage(const Image& image, Image& out, bool psram) {
+    return image_manager.loadImage(image, out, psram);
+}
+
+void Graphics::releaseImage(Image& image) {
+    image_manager.releaseImage(image);
+}
+
+void Graphics::setColorCorrectionMode(ColorCorrectionMode mode) {
+    correction_mode = mode;
+    
+    // At draw time, palettes and bitmap colours are corrected as they are expanded
+    image_manager.setColorCorrection(mode == CORRECTION_AT_DRAW ? &color_correction : nullptr);
+}
+
 void Graphics::enableColorCorrection(bool enable) {
-    correction_enabled = enable;
+    setColorCorrectionMode(enable ? CORRECTION_POST_PASS : CORRECTION_OFF);
 }
 
 void Graphics::applyColorCorrection() {
-    if (correction_enabled && frame_buffer) {
+    if (correction_mode == CORRECTION_POST_PASS && frame_buffer) {
         color_correction.correctBuffer(frame_buffer, LCD_H_RES * LCD_V_RES);
+        markUntracked(0, 0, LCD_H_RES, LCD_V_RES);
     }
 }
 
 void Graphics::setDisplayTemperature(int8_t temp) {
     color_correction.setTemperature(temp);
-    enableColorCorrection(true);
+    if (correction_mode == CORRECTION_OFF) {
+        setColorCorrectionMode(CORRECTION_AT_DRAW);
+    }
+}
+
+// Tiled rendering
+bool Graphics::enableTiledRendering(bool enable) {
+    if (enable && !tile_renderer.begin(frame_buffer, LCD_H_RES, LCD_V_RES)) {
+        tiling_enabled = false;
+        return false;
+    }
+    
+    tiling_enabled = enable;
+    tile_renderer.invalidateAll();
+    return true;
+}
+
+void Graphics::beginFrame() {
+    if (tiling_enabled) {
+        tile_renderer.beginFrame();
+    }
+}
+
+void Graphics::endFrame() {
+    tile_renderer.endFrame();
+}
+
+void Graphics::invalidateTiles() {
+    tile_renderer.invalidateAll();
 }
\ No newline at end of file
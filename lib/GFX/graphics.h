@@ -3,6 +3,10 @@
 #include "font_manager.h"
 #include "image_manager.h"  // Add image support
 #include "color_correction.h"  // Add this include
+#include "tile_renderer.h"
+#include "glyph_cache.h"
+#include "aa_glyph_cache.h"
+#include "surface.h"
 
 
 // RGB565 color definitions
@@ -28,14 +32,29 @@ class Graphics {
 private:
     uint16_t* frame_buffer;
     FontManager* font_manager;
+    
+    // Where primitives draw: the frame buffer or an offscreen surface
+    uint16_t* target;
+    int16_t target_w, target_h;
+    int32_t target_stride;
+    Surface* target_surface;   // nullptr while drawing to the screen
     ImageManager image_manager;  // Add image manager
+    BlitEngine blit_engine;      // GDMA copies for large opaque blits
     
     // Text state
     int16_t cursor_x, cursor_y;
     uint16_t text_color, text_bg_color;
     bool text_bg_enabled;
     ColorCorrection color_correction;  // Add this line
-    bool correction_enabled = false;   // Add this line
+    ColorCorrectionMode correction_mode = CORRECTION_OFF;
+    
+    // Pre-expanded glyph spans for fast text
+    GlyphCache glyph_cache;
+    AAGlyphCache aa_cache;     // Pre-blended anti-aliased glyphs
+    
+    // Optional tiled rendering
+    TileRenderer tile_renderer;
+    bool tiling_enabled = false;
     
 public:
     // Constructor/Destructor
@@ -45,28 +64,89 @@ public:
     // Display initialization
     bool begin(uint16_t* fb, FontManager* fm);
     
-    void enableColorCorrection(bool enable = true);
+    // CORRECTION_AT_DRAW corrects fill/line/text colours once per call and
+    // indexed palettes per draw; RGB565 images should go through loadImage().
+    // CORRECTION_POST_PASS rewrites the whole frame in applyColorCorrection().
+    void setColorCorrectionMode(ColorCorrectionMode mode);
+    ColorCorrectionMode getColorCorrectionMode() const { return correction_mode; }
+    void enableColorCorrection(bool enable = true);   // Post-pass on/off
     ColorCorrection& getColorCorrection() { return color_correction; }
     void applyColorCorrection();
-    void setDisplayTemperature(int8_t temp);
+    void setDisplayTemperature(int8_t temp);          // Switches to draw-time correction if off
+
+    // A colour as the primitives draw it, for widgets that cache pixels and
+    // blit them raw; they re-render when the correction generation changes
+    uint16_t getDrawColor(uint16_t color) { return drawColor(color); }
+    uint32_t getCorrectionGeneration() const {
+        return correction_mode == CORRECTION_AT_DRAW ? color_correction.getGeneration() : 0;
+    }
+
+    // Offscreen rendering: all primitives, text and images draw into the
+    // surface until resetTarget(). Nothing is recorded into tiles meanwhile.
+    bool setTarget(Surface* surface);
+    void resetTarget();
+    bool isTargetScreen() const { return target_surface == nullptr; }
+    int16_t getTargetWidth() const { return target_w; }
+    int16_t getTargetHeight() const { return target_h; }
+    int32_t getTargetStride() const { return target_stride; }
+    uint16_t* getTargetPixels() { return target; }
+
+    // Tiled rendering (fillScreen/fillRect/text are recorded between beginFrame and endFrame;
+    // other primitives draw immediately and should be issued after endFrame)
+    bool enableTiledRendering(bool enable = true);
+    bool isTiledRenderingEnabled() const { return tiling_enabled; }
+    void beginFrame();
+    void endFrame();
+    void invalidateTiles();
+    const TileStats& getTileStats() const { return tile_renderer.getStats(); }
 
     // Basic drawing functions
     void fillScreen(uint16_t color);
     void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
     void drawPixel(int16_t x, int16_t y, uint16_t color);
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
     void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
     void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    
+    // Anti-aliased lines (blended into the frame buffer, drawn immediately).
+    // The Fixed variant takes coordinates in 1/256 pixel for sub-pixel motion.
+    void drawLineAA(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color, uint8_t thickness = 1);
+    void drawLineAAFixed(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t color, uint8_t thickness = 1);
     void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
     void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
     
+    // Annular sector between two radii (r_inner = 0 for a pie slice).
+    // Angles in degrees, 0 = 3 o'clock, clockwise; end must be after start.
+    void fillArc(int16_t x0, int16_t y0, int16_t r_outer, int16_t r_inner,
+                 int16_t start_angle, int16_t end_angle, uint16_t color);
+    
     // Image drawing functions - ADD THESE
     void drawImage(int16_t x, int16_t y, const Image& image);
     void drawImage(int16_t x, int16_t y, const Image& image, const ImageDrawOptions& options);
     void drawRGB565(int16_t x, int16_t y, uint16_t width, uint16_t height, const uint16_t* data);
     void drawRGB565(int16_t x, int16_t y, uint16_t width, uint16_t height, const uint16_t* data, uint16_t transparent_color);
+    
+    // Opaque blit that may run on GDMA while the CPU keeps drawing elsewhere.
+    // Don't touch the destination area (or end a frame over it) before the
+    // callback has fired or waitForBlits() returned.
+    bool drawRGB565Async(int16_t x, int16_t y, uint16_t width, uint16_t height, const uint16_t* data,
+                         BlitCallback callback = nullptr, void* arg = nullptr);
+    void waitForBlits() { blit_engine.wait(); }
     void drawBitmap(int16_t x, int16_t y, uint16_t width, uint16_t height, const uint8_t* bitmap, uint16_t fg_color, uint16_t bg_color);
     void drawBitmap(int16_t x, int16_t y, uint16_t width, uint16_t height, const uint8_t* bitmap, uint16_t fg_color);
     void drawImageScaled(int16_t x, int16_t y, const Image& image, float scale_x, float scale_y);
+    void drawImageResized(int16_t x, int16_t y, const Image& image, uint16_t width, uint16_t height,
+                          const ImageDrawOptions& options);
+    
+    // Decode (and colour-correct, at draw-time correction) an image into RAM once
+    bool loadImage(const Image& image, Image& out, bool psram = true);
+    void releaseImage(Image& image);
+    
+    // Assets by id from the flash bundle (call setAssetBundle after begin)
+    void setAssetBundle(const AssetBundle* bundle);
+    void drawAsset(int16_t x, int16_t y, uint16_t asset_id);
+    void drawAsset(int16_t x, int16_t y, uint16_t asset_id, const ImageDrawOptions& options);
     
     // Text functions
     void setCursor(int16_t x, int16_t y);
@@ -83,8 +163,11 @@ public:
     void useBuiltinFont(uint8_t scale = 1);
     void useFreeSans9pt();
     void useFreeSans18pt7b();
+    void useFreeSans9ptAA();
     void setFont(const GFXfont* font);
+    void setFont(const AAFont* font);
     void setFont(FontType font_type);
+    bool useFontAsset(uint16_t asset_id);
     
     // Advanced text functions
     void printLabel(int16_t x, int16_t y, const char* text);
@@ -106,19 +189,45 @@ public:
     uint16_t color565(uint8_t r, uint8_t g, uint8_t b);
     void color565ToRGB(uint16_t color, uint8_t* r, uint8_t* g, uint8_t* b);
     
+    // Font manager access
+    FontManager* getFontManager() { return font_manager; }
+    
+    // Glyph cache access
+    GlyphCache& getGlyphCache() { return glyph_cache; }
+    AAGlyphCache& getAAGlyphCache() { return aa_cache; }
+    
     // Image manager access
     ImageManager& getImageManager() { return image_manager; }
+    BlitEngine& getBlitEngine() { return blit_engine; }
     
     // Get frame buffer for direct access
     uint16_t* getFrameBuffer() { return frame_buffer; }
     
+    // Report pixels written straight into the frame buffer (keeps tiles in sync)
+    void markUntracked(int16_t x, int16_t y, int16_t w, int16_t h) {
+        if (tiling_enabled && !target_surface) tile_renderer.markDirty(x, y, w, h);
+    }
+    
 private:
     // Internal character drawing
     void drawChar(int16_t x, int16_t y, char c, uint16_t fg_color, uint16_t bg_color, bool draw_bg);
     void drawCharBuiltin(int16_t x, int16_t y, char c, uint16_t fg_color, uint16_t bg_color, bool draw_bg, uint8_t scale);
     void drawCharGFX(int16_t x, int16_t y, char c, uint16_t fg_color, uint16_t bg_color, bool draw_bg);
+    void drawCharAA(int16_t x, int16_t y, char c, uint16_t fg_color, uint16_t bg_color, bool draw_bg);
+    void blitGlyph(const CachedGlyph* glyph, int16_t x, int16_t y, uint16_t color);
+    void blitBlendedGlyph(const BlendedGlyph* glyph, int16_t x, int16_t y);
     
     // Helper functions
     bool isValidCoordinate(int16_t x, int16_t y) const;
     void setPixelUnsafe(int16_t x, int16_t y, uint16_t color);
+    
+    // Primitives for colours that are already corrected
+    void fillRectRaw(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void hLineRaw(int16_t x, int16_t y, int16_t w, uint16_t color);
+    void vLineRaw(int16_t x, int16_t y, int16_t h, uint16_t color);
+    void pixelRaw(int16_t x, int16_t y, uint16_t color);
+    uint16_t drawColor(uint16_t color) {
+        return correction_mode == CORRECTION_AT_DRAW ? color_correction.correctColor(color) : color;
+    }
+    bool recording() const { return !target_surface && tile_renderer.isRecording(); }
 };
\ No newline at end of file
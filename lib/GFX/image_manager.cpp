@@ -1,4 +1,9 @@
 #include "image_manager.h"
+#include "qoi565.h"
+#include "asset_bundle.h"
+#include "color_blend.h"
+#include "color_correction.h"
+#include "esp_heap_caps.h"
 #include <algorithm>
 
 // Helper macros
@@ -12,7 +17,15 @@
 ImageManager::ImageManager() : 
     frame_buffer(nullptr),
     screen_width(0),
-    screen_height(0) {
+    screen_height(0),
+    stride(0),
+    blitter(nullptr),
+    assets(nullptr),
+    correction(nullptr),
+    clip_x1(0),
+    clip_y1(0),
+    clip_x2(0),
+    clip_y2(0) {
 }
 
 ImageManager::~ImageManager() {
@@ -22,10 +35,30 @@ ImageManager::~ImageManager() {
 bool ImageManager::begin(uint16_t* fb, int16_t width, int16_t height) {
     if (!fb || width <= 0 || height <= 0) return false;
     
-    frame_buffer = fb;
+    setTarget(fb, width, height, width);
+    return true;
+}
+
+void ImageManager::setTarget(uint16_t* buffer, int16_t width, int16_t height, int32_t row_stride) {
+    frame_buffer = buffer;
     screen_width = width;
     screen_height = height;
-    return true;
+    stride = row_stride;
+    resetClip();
+}
+
+void ImageManager::setClip(int16_t x, int16_t y, int16_t w, int16_t h) {
+    clip_x1 = max(x, 0);
+    clip_y1 = max(y, 0);
+    clip_x2 = min(x + w, screen_width);
+    clip_y2 = min(y + h, screen_height);
+}
+
+void ImageManager::resetClip() {
+    clip_x1 = 0;
+    clip_y1 = 0;
+    clip_x2 = screen_width;
+    clip_y2 = screen_height;
 }
 
 // Basic image drawing
@@ -37,56 +70,127 @@ void ImageManager::drawImage(int16_t x, int16_t y, const Image& image) {
 void ImageManager::drawImage(int16_t x, int16_t y, const Image& image, const ImageDrawOptions& options) {
     if (!frame_buffer || !isValidImage(image)) return;
     
-    switch (image.header.format) {
-        case IMAGE_RGB565_RAW:
-            drawImageRGB565(x, y, image, options);
-            break;
-        case IMAGE_RGB565_RLE:
-            drawImageRLE(x, y, image, options);
-            break;
-        case IMAGE_BITMAP_1BIT:
-            drawImageBitmap1Bit(x, y, image, options);
-            break;
-        default:
-            // Unsupported format
-            break;
+    // Options clip is intersected with the current clip for this call only
+    int16_t saved_x1 = clip_x1, saved_y1 = clip_y1, saved_x2 = clip_x2, saved_y2 = clip_y2;
+    if (options.clip_w > 0 && options.clip_h > 0) {
+        clip_x1 = max(clip_x1, options.clip_x);
+        clip_y1 = max(clip_y1, options.clip_y);
+        clip_x2 = min(clip_x2, options.clip_x + options.clip_w);
+        clip_y2 = min(clip_y2, options.clip_y + options.clip_h);
+    }
+    bool scaled = options.scale_x != 1.0f || options.scale_y != 1.0f;
+    
+    if (scaled) {
+        if (options.scale_x > 0 && options.scale_y > 0) {
+            drawImageResized(x, y, image, (uint16_t)(image.header.width * options.scale_x),
+                             (uint16_t)(image.header.height * options.scale_y), options);
+        }
+    } else {
+        switch (image.header.format) {
+            case IMAGE_RGB565_RAW:
+                drawImageRGB565(x, y, image, options);
+                break;
+            case IMAGE_RGB565_RLE:
+                drawImageRLE(x, y, image, options);
+                break;
+            case IMAGE_RGB565_QOI:
+                drawImageQOI(x, y, image, options);
+                break;
+            case IMAGE_BITMAP_1BIT:
+            case IMAGE_BITMAP_4BIT:
+            case IMAGE_BITMAP_8BIT:
+                drawImageIndexed(x, y, image, options);
+                break;
+            default:
+                // Unsupported format
+                break;
+        }
     }
+    
+    clip_x1 = saved_x1;
+    clip_y1 = saved_y1;
+    clip_x2 = saved_x2;
+    clip_y2 = saved_y2;
+}
+
+Image ImageManager::getAsset(uint16_t asset_id) const {
+    return assets ? assets->getImage(asset_id) : Image(0, 0, IMAGE_RGB565_RAW, nullptr);
+}
+
+void ImageManager::drawAsset(int16_t x, int16_t y, uint16_t asset_id) {
+    ImageDrawOptions default_options;
+    drawAsset(x, y, asset_id, default_options);
+}
+
+void ImageManager::drawAsset(int16_t x, int16_t y, uint16_t asset_id, const ImageDrawOptions& options) {
+    drawImage(x, y, getAsset(asset_id), options);
 }
 
 // Raw RGB565 drawing
 void ImageManager::drawRGB565(int16_t x, int16_t y, uint16_t width, uint16_t height, const uint16_t* data) {
     if (!frame_buffer || !data) return;
     
-    for (uint16_t row = 0; row < height; row++) {
-        int16_t py = y + row;
-        if (py < 0 || py >= screen_height) continue;
-        
-        for (uint16_t col = 0; col < width; col++) {
-            int16_t px = x + col;
-            if (px < 0 || px >= screen_width) continue;
-            
-            uint16_t color = data[row * width + col];
-            frame_buffer[py * screen_width + px] = color;
-        }
+    // Clip once, then copy whole rows
+    int16_t x1 = max(x, clip_x1);
+    int16_t y1 = max(y, clip_y1);
+    int16_t x2 = min(x + (int16_t)width, clip_x2);
+    int16_t y2 = min(y + (int16_t)height, clip_y2);
+    if (x1 >= x2 || y1 >= y2) return;
+    
+    size_t row_bytes = (x2 - x1) * sizeof(uint16_t);
+    const uint16_t* src = data + (y1 - y) * width + (x1 - x);
+    uint16_t* dst = frame_buffer + y1 * stride + x1;
+    
+    for (int16_t py = y1; py < y2; py++) {
+        memcpy(dst, src, row_bytes);
+        src += width;
+        dst += stride;
+    }
+}
+
+bool ImageManager::drawRGB565Async(int16_t x, int16_t y, uint16_t width, uint16_t height, const uint16_t* data,
+                                   BlitCallback callback, void* arg) {
+    int16_t x1 = max(x, clip_x1);
+    int16_t y1 = max(y, clip_y1);
+    int16_t x2 = min(x + (int16_t)width, clip_x2);
+    int16_t y2 = min(y + (int16_t)height, clip_y2);
+    if (!frame_buffer || !data || x1 >= x2 || y1 >= y2) {
+        if (callback) callback(arg);
+        return false;
+    }
+    
+    const uint16_t* src = data + (y1 - y) * width + (x1 - x);
+    uint16_t* dst = frame_buffer + y1 * stride + x1;
+    if (blitter) {
+        return blitter->copyRect(dst, stride, src, width, x2 - x1, y2 - y1, callback, arg);
     }
+    
+    drawRGB565(x, y, width, height, data);
+    if (callback) callback(arg);
+    return false;
 }
 
 void ImageManager::drawRGB565(int16_t x, int16_t y, uint16_t width, uint16_t height, const uint16_t* data, uint16_t transparent_color) {
     if (!frame_buffer || !data) return;
     
-    for (uint16_t row = 0; row < height; row++) {
-        int16_t py = y + row;
-        if (py < 0 || py >= screen_height) continue;
-        
-        for (uint16_t col = 0; col < width; col++) {
-            int16_t px = x + col;
-            if (px < 0 || px >= screen_width) continue;
-            
-            uint16_t color = data[row * width + col];
-            if (color != transparent_color) {
-                frame_buffer[py * screen_width + px] = color;
-            }
+    // Clip once like the opaque path; only the key test is per pixel
+    int16_t x1 = max(x, clip_x1);
+    int16_t y1 = max(y, clip_y1);
+    int16_t x2 = min(x + (int16_t)width, clip_x2);
+    int16_t y2 = min(y + (int16_t)height, clip_y2);
+    if (x1 >= x2 || y1 >= y2) return;
+    
+    int16_t w = x2 - x1;
+    const uint16_t* src = data + (y1 - y) * width + (x1 - x);
+    uint16_t* dst = frame_buffer + y1 * stride + x1;
+    
+    for (int16_t py = y1; py < y2; py++) {
+        for (int16_t i = 0; i < w; i++) {
+            uint16_t color = src[i];
+            if (color != transparent_color) dst[i] = color;
         }
+        src += width;
+        dst += stride;
     }
 }
 
@@ -94,81 +198,93 @@ void ImageManager::drawRGB565(int16_t x, int16_t y, uint16_t width, uint16_t hei
 void ImageManager::drawBitmap(int16_t x, int16_t y, uint16_t width, uint16_t height, const uint8_t* bitmap, uint16_t fg_color, uint16_t bg_color) {
     if (!frame_buffer || !bitmap) return;
     
-    uint16_t bytes_per_row = (width + 7) / 8;
-    
-    for (uint16_t row = 0; row < height; row++) {
-        int16_t py = y + row;
-        if (py < 0 || py >= screen_height) continue;
-        
-        for (uint16_t col = 0; col < width; col++) {
-            int16_t px = x + col;
-            if (px < 0 || px >= screen_width) continue;
-            
-            uint16_t byte_idx = row * bytes_per_row + (col / 8);
-            uint8_t bit_idx = 7 - (col % 8);
-            uint8_t pixel = (bitmap[byte_idx] >> bit_idx) & 0x01;
-            
-            uint16_t color = pixel ? fg_color : bg_color;
-            frame_buffer[py * screen_width + px] = color;
-        }
+    uint16_t lut[2] = {bg_color, fg_color};
+    if (correction) {
+        lut[0] = correction->correctColor(bg_color);
+        lut[1] = correction->correctColor(fg_color);
     }
+    drawIndexed(x, y, width, height, bitmap, 1, lut, -1);
 }
 
 void ImageManager::drawBitmap(int16_t x, int16_t y, uint16_t width, uint16_t height, const uint8_t* bitmap, uint16_t fg_color) {
     if (!frame_buffer || !bitmap) return;
     
-    uint16_t bytes_per_row = (width + 7) / 8;
-    
-    for (uint16_t row = 0; row < height; row++) {
-        int16_t py = y + row;
-        if (py < 0 || py >= screen_height) continue;
-        
-        for (uint16_t col = 0; col < width; col++) {
-            int16_t px = x + col;
-            if (px < 0 || px >= screen_width) continue;
-            
-            uint16_t byte_idx = row * bytes_per_row + (col / 8);
-            uint8_t bit_idx = 7 - (col % 8);
-            uint8_t pixel = (bitmap[byte_idx] >> bit_idx) & 0x01;
-            
-            if (pixel) {  // Only draw foreground pixels (transparent background)
-                frame_buffer[py * screen_width + px] = fg_color;
-            }
-        }
-    }
+    uint16_t lut[2] = {0, correction ? correction->correctColor(fg_color) : fg_color};
+    drawIndexed(x, y, width, height, bitmap, 1, lut, 0);  // Transparent background
 }
 
-// Scaled drawing (simple nearest neighbor)
+// Scaled drawing (nearest neighbour)
 void ImageManager::drawImageScaled(int16_t x, int16_t y, const Image& image, float scale_x, float scale_y) {
-    if (!frame_buffer || !isValidImage(image) || scale_x <= 0 || scale_y <= 0) return;
+    if (scale_x <= 0 || scale_y <= 0) return;
     
-    if (image.header.format != IMAGE_RGB565_RAW) {
-        // For simplicity, only support RGB565 scaling for now
-        return;
+    ImageDrawOptions options;
+    drawImageResized(x, y, image, (uint16_t)(image.header.width * scale_x),
+                     (uint16_t)(image.header.height * scale_y), options);
+}
+
+// Decode once into RAM through the normal drawing path
+bool ImageManager::loadImage(const Image& image, Image& out, bool psram) {
+    if (!isValidImage(image)) return false;
+    
+    ImageFormat format = image.header.format;
+    if (imageIndexBits(format)) {
+        out = image;
+        return true;
     }
+    if (format != IMAGE_RGB565_RAW && format != IMAGE_RGB565_RLE && format != IMAGE_RGB565_QOI) return false;
     
-    const uint16_t* data = (const uint16_t*)image.data;
-    int16_t scaled_width = (int16_t)(image.header.width * scale_x);
-    int16_t scaled_height = (int16_t)(image.header.height * scale_y);
+    uint16_t w = image.header.width;
+    uint16_t h = image.header.height;
+    uint32_t pixels = (uint32_t)w * h;
+    uint32_t caps = psram ? MALLOC_CAP_SPIRAM : (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    uint16_t* buffer = (uint16_t*)heap_caps_malloc(pixels * sizeof(uint16_t), caps);
+    if (!buffer) return false;
     
-    for (int16_t row = 0; row < scaled_height; row++) {
-        int16_t py = y + row;
-        if (py < 0 || py >= screen_height) continue;
-        
-        int16_t src_row = (int16_t)(row / scale_y);
-        if (src_row >= image.header.height) src_row = image.header.height - 1;
-        
-        for (int16_t col = 0; col < scaled_width; col++) {
-            int16_t px = x + col;
-            if (px < 0 || px >= screen_width) continue;
-            
-            int16_t src_col = (int16_t)(col / scale_x);
-            if (src_col >= image.header.width) src_col = image.header.width - 1;
-            
-            uint16_t color = data[src_row * image.header.width + src_col];
-            frame_buffer[py * screen_width + px] = color;
+    // Opaque decode into the buffer, so keyed pixels keep the key colour
+    uint16_t* saved_fb = frame_buffer;
+    int16_t saved_w = screen_width, saved_h = screen_height;
+    int32_t saved_stride = stride;
+    int16_t saved_x1 = clip_x1, saved_y1 = clip_y1, saved_x2 = clip_x2, saved_y2 = clip_y2;
+    
+    Image opaque = image;
+    opaque.header.has_transparency = false;
+    setTarget(buffer, w, h, w);
+    drawImage(0, 0, opaque);
+    
+    frame_buffer = saved_fb;
+    screen_width = saved_w;
+    screen_height = saved_h;
+    stride = saved_stride;
+    clip_x1 = saved_x1;
+    clip_y1 = saved_y1;
+    clip_x2 = saved_x2;
+    clip_y2 = saved_y2;
+    
+    if (correction) {
+        if (image.header.has_transparency) {
+            // Leave the key alone and keep other pixels from landing on it
+            uint16_t key = image.header.transparent_color;
+            for (uint32_t i = 0; i < pixels; i++) {
+                if (buffer[i] == key) continue;
+                uint16_t c = correction->correctColor(buffer[i]);
+                buffer[i] = (c == key) ? (c ^ 0x0001) : c;
+            }
+        } else {
+            correction->correctBuffer(buffer, pixels);
         }
     }
+    
+    out = Image(w, h, IMAGE_RGB565_RAW, (const uint8_t*)buffer, (uint32_t)(pixels * sizeof(uint16_t)));
+    out.header.has_transparency = image.header.has_transparency;
+    out.header.transparent_color = image.header.transparent_color;
+    return true;
+}
+
+void ImageManager::releaseImage(Image& image) {
+    if (image.header.format == IMAGE_RGB565_RAW) {
+        heap_caps_free((void*)image.data);
+    }
+    image.data = nullptr;
 }
 
 // Utility functions
@@ -227,8 +343,8 @@ void ImageManager::drawRGB565RLE(int16_t x, int16_t y, uint16_t width, uint16_t
         data_idx += 2;
         
         for (uint8_t i = 0; i < run_length && pixels_drawn < total_pixels; i++) {
-            if (px >= 0 && px < screen_width && py >= 0 && py < screen_height) {
-                frame_buffer[py * screen_width + px] = color;
+            if (px >= clip_x1 && px < clip_x2 && py >= clip_y1 && py < clip_y2) {
+                frame_buffer[py * stride + px] = color;
             }
             
             px++;
@@ -241,15 +357,19 @@ void ImageManager::drawRGB565RLE(int16_t x, int16_t y, uint16_t width, uint16_t
     }
 }
 
+uint32_t ImageManager::compressRGB565QOI(const uint16_t* src, uint16_t width, uint16_t height, uint8_t* dst, uint32_t dst_size) {
+    return qoi565Encode(src, (uint32_t)width * height, dst, dst_size);
+}
+
 // Internal drawing helpers
 void ImageManager::drawPixelSafe(int16_t x, int16_t y, uint16_t color) {
     if (isValidCoordinate(x, y)) {
-        frame_buffer[y * screen_width + x] = color;
+        frame_buffer[y * stride + x] = color;
     }
 }
 
 bool ImageManager::isValidCoordinate(int16_t x, int16_t y) const {
-    return (x >= 0 && x < screen_width && y >= 0 && y < screen_height);
+    return (x >= clip_x1 && x < clip_x2 && y >= clip_y1 && y < clip_y2);
 }
 
 void ImageManager::drawImageRGB565(int16_t x, int16_t y, const Image& image, const ImageDrawOptions& options) {
@@ -265,19 +385,426 @@ void ImageManager::drawImageRGB565(int16_t x, int16_t y, const Image& image, con
     }
 }
 
-void ImageManager::drawImageBitmap1Bit(int16_t x, int16_t y, const Image& image, const ImageDrawOptions& options) {
-    // For 1-bit bitmaps, we need foreground and background colors
-    // These would need to be added to ImageDrawOptions or Image structure
-    uint16_t fg_color = 0xFFFF;  // White
-    uint16_t bg_color = 0x0000;  // Black
+void ImageManager::drawImageIndexed(int16_t x, int16_t y, const Image& image, const ImageDrawOptions& options) {
+    uint16_t lut[256];
+    int16_t key;
+    if (!buildIndexLUT(image, options, lut, key)) return;
     
-    if (options.use_transparency) {
-        drawBitmap(x, y, image.header.width, image.header.height, image.data, fg_color);
-    } else {
-        drawBitmap(x, y, image.header.width, image.header.height, image.data, fg_color, bg_color);
+    drawIndexed(x, y, image.header.width, image.header.height, image.data,
+                imageIndexBits(image.header.format), lut, key);
+}
+
+// Palette for an indexed image as a full LUT (out-of-range indices map to
+// entry 0), plus the transparent index or -1. False if there is no palette.
+bool ImageManager::buildIndexLUT(const Image& image, const ImageDrawOptions& options, uint16_t* lut, int16_t& key) const {
+    static const uint16_t mono_palette[2] = {0x0000, 0xFFFF};  // Black background, white foreground
+    
+    uint8_t bits = imageIndexBits(image.header.format);
+    const uint16_t* palette = options.palette ? options.palette : image.palette;
+    uint16_t palette_size = options.palette ? options.palette_size : image.palette_size;
+    if (!palette && bits == 1) {
+        palette = mono_palette;
+        palette_size = 2;
+    }
+    if (!bits || !palette || palette_size == 0) return false;
+    
+    uint16_t entries = 1 << bits;
+    for (uint16_t i = 0; i < entries; i++) {
+        lut[i] = palette[i < palette_size ? i : 0];
+    }
+    
+    key = options.transparent_index >= 0 ? options.transparent_index : image.transparent_index;
+    if (key < 0 && (options.use_transparency || image.header.has_transparency)) {
+        if (bits == 1) {
+            key = 0;  // Transparent background
+        } else {
+            uint16_t trans_color = image.header.has_transparency ?
+                                   image.header.transparent_color :
+                                   options.transparent_color;
+            for (uint16_t i = 0; i < entries && key < 0; i++) {
+                if (lut[i] == trans_color) key = i;
+            }
+        }
+    }
+    if (key >= entries) key = -1;
+    
+    // Keys are matched first, so correction can't move the transparent entry
+    if (correction) {
+        for (uint16_t i = 0; i < entries; i++) {
+            lut[i] = correction->correctColor(lut[i]);
+        }
     }
+    return true;
 }
 
 void ImageManager::drawImageRLE(int16_t x, int16_t y, const Image& image, const ImageDrawOptions& options) {
     drawRGB565RLE(x, y, image.header.width, image.header.height, image.data);
 }
+
+// Streams rows straight into the frame buffer: pixels left and right of the
+// clip are decoded and dropped, and decoding stops after the last visible row
+void ImageManager::drawImageQOI(int16_t x, int16_t y, const Image& image, const ImageDrawOptions& options) {
+    int32_t w = image.header.width;
+    int32_t h = image.header.height;
+    int32_t x1 = max((int32_t)x, (int32_t)clip_x1);
+    int32_t y1 = max((int32_t)y, (int32_t)clip_y1);
+    int32_t x2 = min((int32_t)x + w, (int32_t)clip_x2);
+    int32_t y2 = min((int32_t)y + h, (int32_t)clip_y2);
+    if (x1 >= x2 || y1 >= y2) return;
+    
+    uint32_t left = x1 - x;
+    uint32_t visible = x2 - x1;
+    uint32_t right = x + w - x2;
+    
+    bool keyed = options.use_transparency || image.header.has_transparency;
+    uint16_t trans_color = image.header.has_transparency ?
+                           image.header.transparent_color :
+                           options.transparent_color;
+    
+    QOIDecoder decoder;
+    decoder.begin(image.data, image.header.data_size);
+    decoder.skip((y1 - y) * w);
+    
+    for (int32_t py = y1; py < y2; py++) {
+        uint16_t* dst = frame_buffer + py * stride + x1;
+        decoder.skip(left);
+        
+        if (!keyed) {
+            decoder.read(dst, visible);
+        } else {
+            // Keyed images go through a small stack buffer
+            uint16_t chunk[64];
+            for (uint32_t done = 0; done < visible; ) {
+                uint32_t n = min(visible - done, (uint32_t)64);
+                decoder.read(chunk, n);
+                for (uint32_t i = 0; i < n; i++) {
+                    if (chunk[i] != trans_color) dst[done + i] = chunk[i];
+                }
+                done += n;
+            }
+        }
+        
+        decoder.skip(right);
+    }
+}
+
+// Indexed row blitters: src points at the first byte of the row, col is the
+// first visible column and n the visible width. Keyed variants skip one index.
+template <bool KEYED>
+static inline void putIndex(uint16_t* dst, uint8_t index, const uint16_t* lut, int16_t key) {
+    if (!KEYED || index != key) *dst = lut[index];
+}
+
+// 1-bit: eight pixels per byte
+template <bool KEYED>
+static void blitRow1(uint16_t* dst, const uint8_t* src, uint32_t col, uint32_t n, const uint16_t* lut, int16_t key) {
+    src += col >> 3;
+    for (uint8_t bit = col & 7; bit && n; n--) {
+        putIndex<KEYED>(dst++, (*src >> (7 - bit)) & 1, lut, key);
+        if (++bit == 8) {
+            bit = 0;
+            src++;
+        }
+    }
+    for (; n >= 8; n -= 8) {
+        uint8_t b = *src++;
+        putIndex<KEYED>(dst + 0, b >> 7, lut, key);
+        putIndex<KEYED>(dst + 1, (b >> 6) & 1, lut, key);
+        putIndex<KEYED>(dst + 2, (b >> 5) & 1, lut, key);
+        putIndex<KEYED>(dst + 3, (b >> 4) & 1, lut, key);
+        putIndex<KEYED>(dst + 4, (b >> 3) & 1, lut, key);
+        putIndex<KEYED>(dst + 5, (b >> 2) & 1, lut, key);
+        putIndex<KEYED>(dst + 6, (b >> 1) & 1, lut, key);
+        putIndex<KEYED>(dst + 7, b & 1, lut, key);
+        dst += 8;
+    }
+    for (uint8_t bit = 0; bit < n; bit++) {
+        putIndex<KEYED>(dst++, (*src >> (7 - bit)) & 1, lut, key);
+    }
+}
+
+// 4-bit: eight pixels from four bytes, then pairs
+template <bool KEYED>
+static void blitRow4(uint16_t* dst, const uint8_t* src, uint32_t col, uint32_t n, const uint16_t* lut, int16_t key) {
+    src += col >> 1;
+    if ((col & 1) && n) {
+        putIndex<KEYED>(dst++, *src++ & 0x0F, lut, key);
+        n--;
+    }
+    for (; n >= 8; n -= 8) {
+        uint8_t b0 = src[0], b1 = src[1], b2 = src[2], b3 = src[3];
+        putIndex<KEYED>(dst + 0, b0 >> 4, lut, key);
+        putIndex<KEYED>(dst + 1, b0 & 0x0F, lut, key);
+        putIndex<KEYED>(dst + 2, b1 >> 4, lut, key);
+        putIndex<KEYED>(dst + 3, b1 & 0x0F, lut, key);
+        putIndex<KEYED>(dst + 4, b2 >> 4, lut, key);
+        putIndex<KEYED>(dst + 5, b2 & 0x0F, lut, key);
+        putIndex<KEYED>(dst + 6, b3 >> 4, lut, key);
+        putIndex<KEYED>(dst + 7, b3 & 0x0F, lut, key);
+        src += 4;
+        dst += 8;
+    }
+    for (; n >= 2; n -= 2) {
+        uint8_t b = *src++;
+        putIndex<KEYED>(dst + 0, b >> 4, lut, key);
+        putIndex<KEYED>(dst + 1, b & 0x0F, lut, key);
+        dst += 2;
+    }
+    if (n) {
+        putIndex<KEYED>(dst, *src >> 4, lut, key);
+    }
+}
+
+// 8-bit: eight pixels per iteration
+template <bool KEYED>
+static void blitRow8(uint16_t* dst, const uint8_t* src, uint32_t col, uint32_t n, const uint16_t* lut, int16_t key) {
+    src += col;
+    for (; n >= 8; n -= 8) {
+        putIndex<KEYED>(dst + 0, src[0], lut, key);
+        putIndex<KEYED>(dst + 1, src[1], lut, key);
+        putIndex<KEYED>(dst + 2, src[2], lut, key);
+        putIndex<KEYED>(dst + 3, src[3], lut, key);
+        putIndex<KEYED>(dst + 4, src[4], lut, key);
+        putIndex<KEYED>(dst + 5, src[5], lut, key);
+        putIndex<KEYED>(dst + 6, src[6], lut, key);
+        putIndex<KEYED>(dst + 7, src[7], lut, key);
+        src += 8;
+        dst += 8;
+    }
+    while (n--) {
+        putIndex<KEYED>(dst++, *src++, lut, key);
+    }
+}
+
+typedef void (*IndexedRowBlitter)(uint16_t*, const uint8_t*, uint32_t, uint32_t, const uint16_t*, int16_t);
+
+// Clipped indexed blit; lut has an entry for every possible index
+void ImageManager::drawIndexed(int16_t x, int16_t y, uint16_t width, uint16_t height, const uint8_t* data,
+                               uint8_t bits, const uint16_t* lut, int16_t key) {
+    int32_t x1 = max((int32_t)x, (int32_t)clip_x1);
+    int32_t y1 = max((int32_t)y, (int32_t)clip_y1);
+    int32_t x2 = min((int32_t)x + width, (int32_t)clip_x2);
+    int32_t y2 = min((int32_t)y + height, (int32_t)clip_y2);
+    if (x1 >= x2 || y1 >= y2) return;
+    
+    bool keyed = key >= 0 && key < (1 << bits);
+    IndexedRowBlitter blit;
+    switch (bits) {
+        case 1:  blit = keyed ? blitRow1<true> : blitRow1<false>; break;
+        case 4:  blit = keyed ? blitRow4<true> : blitRow4<false>; break;
+        case 8:  blit = keyed ? blitRow8<true> : blitRow8<false>; break;
+        default: return;
+    }
+    
+    uint32_t row_bytes = ((uint32_t)width * bits + 7) / 8;
+    const uint8_t* src = data + (y1 - y) * row_bytes;
+    uint32_t col = x1 - x;
+    uint32_t visible = x2 - x1;
+    
+    for (int32_t py = y1; py < y2; py++) {
+        blit(frame_buffer + py * stride + x1, src, col, visible, lut, key);
+        src += row_bytes;
+    }
+}
+
+// Source rows for the scaler as RGB565. Raw rows are used in place; other
+// formats decode into a two-row cache (rows r and r + 1 never share a slot).
+// RLE and QOI are streams, so rows must be requested in increasing order.
+class ScaleRowSource {
+private:
+    const Image& image;
+    const uint16_t* lut;
+    uint16_t* cache[2];
+    int32_t cached[2];
+    
+    int32_t next_row;         // Row the stream decoder produces next
+    QOIDecoder qoi;
+    uint32_t rle_pos;
+    uint16_t rle_color;
+    uint16_t rle_run;
+    
+    void restart() {
+        next_row = 0;
+        qoi.begin(image.data, image.header.data_size);
+        rle_pos = 0;
+        rle_color = 0;
+        rle_run = 0;
+    }
+    
+    // Next n pixels of an RLE stream (nullptr: skip)
+    void readRLE(uint16_t* dst, uint32_t n) {
+        while (n) {
+            if (!rle_run) {
+                if (rle_pos + 3 > image.header.data_size) {
+                    rle_run = 0xFFFF;  // Truncated: repeat the last colour
+                    continue;
+                }
+                rle_run = image.data[rle_pos];
+                rle_color = (image.data[rle_pos + 1] << 8) | image.data[rle_pos + 2];
+                rle_pos += 3;
+                continue;
+            }
+            uint32_t k = min((uint32_t)rle_run, n);
+            if (dst) {
+                for (uint32_t i = 0; i < k; i++) {
+                    dst[i] = rle_color;
+                }
+                dst += k;
+            }
+            rle_run -= k;
+            n -= k;
+        }
+    }
+    
+public:
+    ScaleRowSource(const Image& img, const uint16_t* palette_lut, uint16_t* rows) :
+        image(img),
+        lut(palette_lut) {
+        cache[0] = rows;
+        cache[1] = rows ? rows + img.header.width : nullptr;
+        cached[0] = cached[1] = -1;
+        restart();
+    }
+    
+    const uint16_t* row(int32_t r) {
+        uint16_t w = image.header.width;
+        if (image.header.format == IMAGE_RGB565_RAW) {
+            return (const uint16_t*)image.data + r * w;
+        }
+        
+        uint8_t slot = r & 1;
+        if (cached[slot] == r) return cache[slot];
+        
+        uint16_t* dst = cache[slot];
+        switch (image.header.format) {
+            case IMAGE_BITMAP_1BIT:
+                blitRow1<false>(dst, image.data + r * imageIndexRowBytes(IMAGE_BITMAP_1BIT, w), 0, w, lut, -1);
+                break;
+            case IMAGE_BITMAP_4BIT:
+                blitRow4<false>(dst, image.data + r * imageIndexRowBytes(IMAGE_BITMAP_4BIT, w), 0, w, lut, -1);
+                break;
+            case IMAGE_BITMAP_8BIT:
+                blitRow8<false>(dst, image.data + r * w, 0, w, lut, -1);
+                break;
+            default:
+                if (r < next_row) restart();
+                if (image.header.format == IMAGE_RGB565_QOI) {
+                    qoi.skip((r - next_row) * w);
+                    qoi.read(dst, w);
+                } else {
+                    readRLE(nullptr, (r - next_row) * w);
+                    readRLE(dst, w);
+                }
+                next_row = r + 1;
+                break;
+        }
+        cached[slot] = r;
+        return dst;
+    }
+};
+
+// 16.16 fixed-point scaler. Source positions are sampled at pixel centres;
+// column positions are computed once per call into tables, rows step
+// incrementally. Bilinear filtering blends the 2x2 neighbourhood with
+// 5-bit weights; keyed images are always point sampled so the key colour
+// never bleeds into edges.
+void ImageManager::drawImageResized(int16_t x, int16_t y, const Image& image, uint16_t dst_width, uint16_t dst_height,
+                                    const ImageDrawOptions& options) {
+    if (!frame_buffer || !isValidImage(image) || dst_width == 0 || dst_height == 0) return;
+    
+    int32_t x1 = max((int32_t)x, (int32_t)clip_x1);
+    int32_t y1 = max((int32_t)y, (int32_t)clip_y1);
+    int32_t x2 = min((int32_t)x + dst_width, (int32_t)clip_x2);
+    int32_t y2 = min((int32_t)y + dst_height, (int32_t)clip_y2);
+    if (x1 >= x2 || y1 >= y2) return;
+    
+    // Indexed sources are keyed by the colour of their transparent entry
+    ImageFormat format = image.header.format;
+    uint16_t lut[256];
+    bool keyed = false;
+    uint16_t trans_color = 0;
+    if (imageIndexBits(format)) {
+        int16_t key;
+        if (!buildIndexLUT(image, options, lut, key)) return;
+        keyed = key >= 0;
+        trans_color = keyed ? lut[key] : 0;
+    } else if (format == IMAGE_RGB565_RAW || format == IMAGE_RGB565_RLE || format == IMAGE_RGB565_QOI) {
+        keyed = options.use_transparency || image.header.has_transparency;
+        trans_color = image.header.has_transparency ? image.header.transparent_color : options.transparent_color;
+    } else {
+        return;
+    }
+    bool filter = options.bilinear && !keyed;
+    
+    uint16_t src_w = image.header.width;
+    uint16_t src_h = image.header.height;
+    uint32_t step_x = ((uint32_t)src_w << 16) / dst_width;
+    uint32_t step_y = ((uint32_t)src_h << 16) / dst_height;
+    int64_t bias = filter ? 0x8000 : 0;     // Filter between the two nearest centres
+    
+    // Column tables for the visible span, plus the row cache for decoded formats
+    uint32_t visible = x2 - x1;
+    uint32_t cache_pixels = (format == IMAGE_RGB565_RAW) ? 0 : 2 * (uint32_t)src_w;
+    size_t bytes = visible * sizeof(uint16_t) + cache_pixels * sizeof(uint16_t) + visible;
+    uint8_t* scratch = (uint8_t*)heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!scratch) return;
+    uint16_t* col_index = (uint16_t*)scratch;
+    uint16_t* rows = cache_pixels ? col_index + visible : nullptr;
+    uint8_t* col_weight = scratch + (visible + cache_pixels) * sizeof(uint16_t);
+    
+    int64_t fx = (int64_t)(x1 - x) * step_x + step_x / 2 - bias;
+    for (uint32_t i = 0; i < visible; i++, fx += step_x) {
+        int64_t sx = fx > 0 ? fx : 0;
+        uint32_t ix = sx >> 16;
+        uint8_t weight = (sx >> 11) & 31;
+        if (ix >= (uint32_t)src_w - 1) {
+            ix = src_w - 1;
+            weight = 0;
+        }
+        col_index[i] = ix;
+        col_weight[i] = weight;
+    }
+    
+    ScaleRowSource source(image, lut, rows);
+    int64_t fy = (int64_t)(y1 - y) * step_y + step_y / 2 - bias;
+    uint16_t* dst = frame_buffer + y1 * stride + x1;
+    
+    for (int32_t py = y1; py < y2; py++, fy += step_y, dst += stride) {
+        int64_t sy = fy > 0 ? fy : 0;
+        uint32_t iy = sy >> 16;
+        uint8_t weight_y = (sy >> 11) & 31;
+        if (iy >= (uint32_t)src_h - 1) {
+            iy = src_h - 1;
+            weight_y = 0;
+        }
+        const uint16_t* top = source.row(iy);
+        
+        if (!filter) {
+            if (keyed) {
+                for (uint32_t i = 0; i < visible; i++) {
+                    uint16_t color = top[col_index[i]];
+                    if (color != trans_color) dst[i] = color;
+                }
+            } else {
+                for (uint32_t i = 0; i < visible; i++) {
+                    dst[i] = top[col_index[i]];
+                }
+            }
+            continue;
+        }
+        
+        const uint16_t* bottom = weight_y ? source.row(iy + 1) : nullptr;
+        for (uint32_t i = 0; i < visible; i++) {
+            uint16_t ix = col_index[i];
+            uint8_t wx = col_weight[i];
+            uint16_t color = wx ? blendRGB565_32(top[ix + 1], top[ix], wx) : top[ix];
+            if (bottom) {
+                uint16_t below = wx ? blendRGB565_32(bottom[ix + 1], bottom[ix], wx) : bottom[ix];
+                color = blendRGB565_32(below, color, weight_y);
+            }
+            dst[i] = color;
+        }
+    }
+    
+    heap_caps_free(scratch);
+}
@@ -1,12 +1,18 @@
 #pragma once
 #include <Arduino.h>
+#include "blit_engine.h"
+
+class AssetBundle;
+class ColorCorrection;
 
 // Image formats
 enum ImageFormat {
     IMAGE_RGB565_RAW = 0,    // Raw RGB565 data
     IMAGE_RGB565_RLE,        // Run-length encoded RGB565
-    IMAGE_BITMAP_1BIT,       // 1-bit monochrome bitmap
-    IMAGE_BITMAP_4BIT,       // 4-bit indexed bitmap
+    IMAGE_BITMAP_1BIT,       // 1-bit monochrome bitmap (palette: background, foreground)
+    IMAGE_BITMAP_4BIT,       // 4-bit indexed bitmap, high nibble first
+    IMAGE_RGB565_QOI,        // QOI-style compressed RGB565 (tools/qoi565.py)
+    IMAGE_BITMAP_8BIT,       // 8-bit indexed bitmap
     IMAGE_FORMAT_COUNT
 };
 
@@ -20,14 +26,32 @@ struct ImageHeader {
     bool has_transparency;
 } __attribute__((packed));
 
+// Bits per pixel of the indexed formats (0 for the others)
+static inline uint8_t imageIndexBits(ImageFormat fmt) {
+    switch (fmt) {
+        case IMAGE_BITMAP_1BIT: return 1;
+        case IMAGE_BITMAP_4BIT: return 4;
+        case IMAGE_BITMAP_8BIT: return 8;
+        default:                return 0;
+    }
+}
+
+// Indexed rows always start on a byte boundary
+static inline uint32_t imageIndexRowBytes(ImageFormat fmt, uint16_t width) {
+    return ((uint32_t)width * imageIndexBits(fmt) + 7) / 8;
+}
+
 // Image data structure
 struct Image {
     ImageHeader header;
     const uint8_t* data;     // Pointer to image data (PROGMEM or PSRAM)
+    const uint16_t* palette; // RGB565 colours for the indexed formats
+    uint16_t palette_size;
+    int16_t transparent_index; // Palette entry that is not drawn (-1 = none)
     
     // Constructor for PROGMEM images
     Image(uint16_t w, uint16_t h, ImageFormat fmt, const uint8_t* img_data, uint32_t size = 0) 
-        : data(img_data) {
+        : data(img_data), palette(nullptr), palette_size(0), transparent_index(-1) {
         header.width = w;
         header.height = h;
         header.format = fmt;
@@ -39,7 +63,7 @@ struct Image {
     // Constructor with transparency
     Image(uint16_t w, uint16_t h, ImageFormat fmt, const uint8_t* img_data, 
           uint16_t trans_color, uint32_t size = 0) 
-        : data(img_data) {
+        : data(img_data), palette(nullptr), palette_size(0), transparent_index(-1) {
         header.width = w;
         header.height = h;
         header.format = fmt;
@@ -47,6 +71,18 @@ struct Image {
         header.has_transparency = true;
         header.transparent_color = trans_color;
     }
+    
+    // Constructor for indexed images (1, 4 or 8-bit)
+    Image(uint16_t w, uint16_t h, ImageFormat fmt, const uint8_t* img_data,
+          const uint16_t* pal, uint16_t pal_size, int16_t trans_index = -1)
+        : data(img_data), palette(pal), palette_size(pal_size), transparent_index(trans_index) {
+        header.width = w;
+        header.height = h;
+        header.format = fmt;
+        header.data_size = imageIndexRowBytes(fmt, w) * h;
+        header.has_transparency = false;
+        header.transparent_color = 0;
+    }
 };
 
 // Image drawing options
@@ -59,6 +95,10 @@ struct ImageDrawOptions {
     int16_t clip_y = 0;
     int16_t clip_w = 0;      // 0 = no clipping
     int16_t clip_h = 0;
+    const uint16_t* palette = nullptr;  // Indexed images: replaces the image palette
+    uint16_t palette_size = 0;
+    int16_t transparent_index = -1;     // Indexed images: entry to skip (-1 = image default)
+    bool bilinear = false;              // Scaled drawing: filter instead of nearest neighbour
 };
 
 class ImageManager {
@@ -66,6 +106,13 @@ private:
     uint16_t* frame_buffer;
     int16_t screen_width;
     int16_t screen_height;
+    int32_t stride;          // Pixels per row of the target
+    BlitEngine* blitter;     // Optional, for asynchronous copies
+    const AssetBundle* assets; // Optional, for drawing by asset id
+    ColorCorrection* correction; // Optional, applied to palettes and bitmap colours
+    
+    // Drawing is limited to [clip_x1, clip_x2) x [clip_y1, clip_y2)
+    int16_t clip_x1, clip_y1, clip_x2, clip_y2;
     
 public:
     ImageManager();
@@ -74,20 +121,54 @@ public:
     // Initialize with graphics frame buffer
     bool begin(uint16_t* fb, int16_t width, int16_t height);
     
+    // Draw into another buffer (Graphics::setTarget); resets the clip
+    void setTarget(uint16_t* buffer, int16_t width, int16_t height, int32_t row_stride);
+    
+    // Clip rectangle for all drawing (ImageDrawOptions clips are applied on top)
+    void setClip(int16_t x, int16_t y, int16_t w, int16_t h);
+    void resetClip();
+    
+    // Engine used by drawRGB565Async (without one, copies are synchronous)
+    void setBlitEngine(BlitEngine* engine) { blitter = engine; }
+    
+    // Bundle that asset ids resolve against (see asset_bundle.h)
+    void setAssetBundle(const AssetBundle* bundle) { assets = bundle; }
+    
+    // Draw-time colour correction (nullptr = off). Indexed palettes and bitmap
+    // colours are corrected per draw; RGB565 pixels only by loadImage().
+    void setColorCorrection(ColorCorrection* cc) { correction = cc; }
+    
     // Basic image drawing
     void drawImage(int16_t x, int16_t y, const Image& image);
     void drawImage(int16_t x, int16_t y, const Image& image, const ImageDrawOptions& options);
     
+    // Images from the asset bundle by id (unknown ids draw nothing)
+    Image getAsset(uint16_t asset_id) const;
+    void drawAsset(int16_t x, int16_t y, uint16_t asset_id);
+    void drawAsset(int16_t x, int16_t y, uint16_t asset_id, const ImageDrawOptions& options);
+    
     // Raw RGB565 drawing (most common)
     void drawRGB565(int16_t x, int16_t y, uint16_t width, uint16_t height, const uint16_t* data);
     void drawRGB565(int16_t x, int16_t y, uint16_t width, uint16_t height, const uint16_t* data, uint16_t transparent_color);
     
+    // Opaque copy that may run on GDMA; the callback fires once the pixels
+    // have landed. Returns true if the copy is still in flight.
+    bool drawRGB565Async(int16_t x, int16_t y, uint16_t width, uint16_t height, const uint16_t* data,
+                         BlitCallback callback = nullptr, void* arg = nullptr);
+    
     // Bitmap drawing (1-bit monochrome)
     void drawBitmap(int16_t x, int16_t y, uint16_t width, uint16_t height, const uint8_t* bitmap, uint16_t fg_color, uint16_t bg_color);
     void drawBitmap(int16_t x, int16_t y, uint16_t width, uint16_t height, const uint8_t* bitmap, uint16_t fg_color); // Transparent background
     
-    // Scaled drawing
+    // Scaled drawing, any format (RLE and QOI decode the rows they need)
     void drawImageScaled(int16_t x, int16_t y, const Image& image, float scale_x, float scale_y);
+    void drawImageResized(int16_t x, int16_t y, const Image& image, uint16_t dst_width, uint16_t dst_height,
+                          const ImageDrawOptions& options);
+    
+    // Decode a raw, RLE or QOI image into a new RGB565 buffer, colour-corrected
+    // once, so later draws are plain copies. Indexed images are returned as-is.
+    bool loadImage(const Image& image, Image& out, bool psram = true);
+    void releaseImage(Image& image);   // Frees the pixels of a loaded RGB565 image
     
     // Utility functions
     uint32_t getImageMemorySize(const Image& image) const;
@@ -97,11 +178,18 @@ public:
     uint32_t compressRGB565RLE(const uint16_t* src, uint16_t width, uint16_t height, uint8_t* dst, uint32_t dst_size);
     void drawRGB565RLE(int16_t x, int16_t y, uint16_t width, uint16_t height, const uint8_t* rle_data);
     
+    // QOI-style compression (see qoi565.h); dst needs up to 3 bytes per pixel
+    uint32_t compressRGB565QOI(const uint16_t* src, uint16_t width, uint16_t height, uint8_t* dst, uint32_t dst_size);
+    
 private:
     // Internal drawing helpers
     void drawPixelSafe(int16_t x, int16_t y, uint16_t color);
     bool isValidCoordinate(int16_t x, int16_t y) const;
     void drawImageRGB565(int16_t x, int16_t y, const Image& image, const ImageDrawOptions& options);
-    void drawImageBitmap1Bit(int16_t x, int16_t y, const Image& image, const ImageDrawOptions& options);
+    void drawImageIndexed(int16_t x, int16_t y, const Image& image, const ImageDrawOptions& options);
+    bool buildIndexLUT(const Image& image, const ImageDrawOptions& options, uint16_t* lut, int16_t& key) const;
+    void drawIndexed(int16_t x, int16_t y, uint16_t width, uint16_t height, const uint8_t* data,
+                     uint8_t bits, const uint16_t* lut, int16_t key);
     void drawImageRLE(int16_t x, int16_t y, const Image& image, const ImageDrawOptions& options);
+    void drawImageQOI(int16_t x, int16_t y, const Image& image, const ImageDrawOptions& options);
 };
\ No newline at end of file
@@ -0,0 +1,164 @@
+#include "qoi565.h"
+
+// Helper macros
+#ifndef max
+#define max(a,b) ((a)>(b)?(a):(b))
+#endif
+#ifndef min
+#define min(a,b) ((a)<(b)?(a):(b))
+#endif
+
+// Signed channel difference with wrap-around
+static inline int32_t wrapDiff(int32_t d, uint8_t bits) {
+    int32_t half = 1 << (bits - 1);
+    return ((d + half) & ((1 << bits) - 1)) - half;
+}
+
+// Runs of the previous pixel: 1..62 as one byte, longer ones as 0xFF n
+static uint32_t emitRun(uint32_t run, uint8_t* dst, uint32_t pos, uint32_t dst_size) {
+    while (run > 0) {
+        uint32_t n;
+        if (run > QOI565_MAX_RUN) {
+            if (pos + 2 > dst_size) return 0;
+            n = min(run, (uint32_t)(63 + 255));
+            dst[pos++] = QOI565_OP_LONG_RUN;
+            dst[pos++] = n - 63;
+        } else {
+            if (pos + 1 > dst_size) return 0;
+            n = run;
+            dst[pos++] = QOI565_OP_RUN | (n - 1);
+        }
+        run -= n;
+    }
+    return pos;
+}
+
+uint32_t qoi565Encode(const uint16_t* src, uint32_t count, uint8_t* dst, uint32_t dst_size) {
+    if (!src || !dst) return 0;
+
+    uint16_t table[64] = {0};
+    uint16_t prev = 0;
+    uint32_t run = 0;
+    uint32_t pos = 0;
+
+    for (uint32_t i = 0; i < count; i++) {
+        uint16_t px = src[i];
+        if (px == prev) {
+            run++;
+            continue;
+        }
+        if (run) {
+            pos = emitRun(run, dst, pos, dst_size);
+            if (!pos) return 0;
+            run = 0;
+        }
+        if (pos + 3 > dst_size) return 0;
+
+        uint8_t h = qoi565Hash(px);
+        if (table[h] == px) {
+            dst[pos++] = QOI565_OP_INDEX | h;
+        } else {
+            table[h] = px;
+            int32_t dr = wrapDiff((int32_t)((px >> 11) & 31) - ((prev >> 11) & 31), 5);
+            int32_t dg = wrapDiff((int32_t)((px >> 5) & 63) - ((prev >> 5) & 63), 6);
+            int32_t db = wrapDiff((int32_t)(px & 31) - (prev & 31), 5);
+            int32_t half = ((dg + 64) >> 1) - 32;
+
+            if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1) {
+                dst[pos++] = QOI565_OP_DIFF | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2);
+            } else if (dr - half >= -8 && dr - half <= 7 && db - half >= -8 && db - half <= 7) {
+                dst[pos++] = QOI565_OP_LUMA | (dg + 32);
+                dst[pos++] = ((dr - half + 8) << 4) | (db - half + 8);
+            } else {
+                dst[pos++] = QOI565_OP_RAW;
+                dst[pos++] = px >> 8;
+                dst[pos++] = px & 0xFF;
+            }
+        }
+        prev = px;
+    }
+
+    if (run) {
+        pos = emitRun(run, dst, pos, dst_size);
+    }
+    return pos;
+}
+
+QOIDecoder::QOIDecoder() :
+    pos(nullptr),
+    end(nullptr),
+    prev(0),
+    run(0) {
+    memset(table, 0, sizeof(table));
+}
+
+void QOIDecoder::begin(const uint8_t* data, uint32_t size) {
+    pos = data;
+    end = data ? data + size : nullptr;
+    prev = 0;
+    run = 0;
+    memset(table, 0, sizeof(table));
+}
+
+void QOIDecoder::read(uint16_t* dst, uint32_t n) {
+    while (n) {
+        if (run) {
+            uint32_t k = min(run, n);
+            if (dst) {
+                for (uint32_t i = 0; i < k; i++) {
+                    dst[i] = prev;
+                }
+                dst += k;
+            }
+            run -= k;
+            n -= k;
+            continue;
+        }
+
+        // Truncated or corrupt stream: repeat the last pixel
+        if (pos >= end) {
+            run = n;
+            continue;
+        }
+
+        uint8_t op = *pos++;
+        uint16_t px;
+        if (op >= QOI565_OP_RUN) {
+            if (op == QOI565_OP_RAW) {
+                if (pos + 2 > end) {
+                    pos = end;
+                    continue;
+                }
+                px = (pos[0] << 8) | pos[1];
+                pos += 2;
+            } else if (op == QOI565_OP_LONG_RUN) {
+                run = (pos < end) ? *pos++ + 63 : 0;
+                continue;
+            } else {
+                run = (op & 0x3F) + 1;
+                continue;
+            }
+        } else if (op < QOI565_OP_DIFF) {
+            px = table[op];
+        } else if (op < QOI565_OP_LUMA) {
+            uint16_t r = (((prev >> 11) & 31) + ((op >> 4) & 3) - 2) & 31;
+            uint16_t g = (((prev >> 5) & 63) + ((op >> 2) & 3) - 2) & 63;
+            uint16_t b = ((prev & 31) + (op & 3) - 2) & 31;
+            px = (r << 11) | (g << 5) | b;
+        } else {
+            if (pos >= end) continue;
+            int32_t dg = (op & 0x3F) - 32;
+            int32_t half = ((dg + 64) >> 1) - 32;
+            uint8_t rb = *pos++;
+            uint16_t r = (((prev >> 11) & 31) + half + (rb >> 4) - 8) & 31;
+            uint16_t g = (((prev >> 5) & 63) + dg) & 63;
+            uint16_t b = ((prev & 31) + half + (rb & 15) - 8) & 31;
+            px = (r << 11) | (g << 5) | b;
+        }
+
+        table[qoi565Hash(px)] = px;
+        prev = px;
+        if (dst) *dst++ = px;
+        n--;
+    }
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <Arduino.h>
+
+// QOI-style lossless RGB565 stream (IMAGE_RGB565_QOI)
+// Byte-aligned ops over the pixels in row order: index into a 64-entry
+// table of recent colours, small channel deltas, runs and raw pixels. The
+// format is documented in tools/qoi565.py, which encodes assets offline.
+#define QOI565_OP_INDEX     0x00    // 00iiiiii
+#define QOI565_OP_DIFF      0x40    // 01rrggbb
+#define QOI565_OP_LUMA      0x80    // 10gggggg rrrrbbbb
+#define QOI565_OP_RUN       0xC0    // 11rrrrrr, 1..62
+#define QOI565_OP_RAW       0xFE    // hi lo
+#define QOI565_OP_LONG_RUN  0xFF    // n, 63..318
+#define QOI565_MAX_RUN      62
+
+static inline uint8_t qoi565Hash(uint16_t c) {
+    return (((c >> 11) & 31) * 3 + ((c >> 5) & 63) * 5 + (c & 31) * 7) & 63;
+}
+
+// Worst case encoded size (every pixel raw)
+static inline uint32_t qoi565MaxSize(uint32_t pixels) {
+    return pixels * 3;
+}
+
+// Encode count pixels; returns the stream size, or 0 if dst is too small
+uint32_t qoi565Encode(const uint16_t* src, uint32_t count, uint8_t* dst, uint32_t dst_size);
+
+// Streaming decoder: pixels come out in order, any number at a time, so a
+// clipped blit decodes straight into frame buffer spans and discards the rest
+class QOIDecoder {
+private:
+    const uint8_t* pos;
+    const uint8_t* end;
+    uint16_t prev;
+    uint32_t run;             // Pending repeats of prev
+    uint16_t table[64];
+
+public:
+    QOIDecoder();
+
+    void begin(const uint8_t* data, uint32_t size);
+
+    // Next n pixels into dst (a truncated stream repeats the last pixel)
+    void read(uint16_t* dst, uint32_t n);
+
+    // Decode and drop n pixels
+    void skip(uint32_t n) { read(nullptr, n); }
+};
@@ -0,0 +1,112 @@
+#include "surface.h"
+#include "esp_heap_caps.h"
+
+// Helper macros
+#ifndef max
+#define max(a,b) ((a)>(b)?(a):(b))
+#endif
+#ifndef min
+#define min(a,b) ((a)<(b)?(a):(b))
+#endif
+
+Surface::Surface() :
+    pixels(nullptr),
+    alpha(nullptr),
+    width(0),
+    height(0),
+    stride(0),
+    owned(false) {
+}
+
+Surface::~Surface() {
+    end();
+}
+
+bool Surface::begin(int16_t w, int16_t h, SurfaceMemory memory, bool with_alpha) {
+    end();
+    if (w <= 0 || h <= 0) return false;
+
+    uint32_t caps = (memory == SURFACE_SRAM) ? (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT) : MALLOC_CAP_SPIRAM;
+    pixels = (uint16_t*)heap_caps_malloc(w * h * sizeof(uint16_t), caps);
+    if (with_alpha) {
+        alpha = (uint8_t*)heap_caps_malloc(w * h, caps);
+    }
+    if (!pixels || (with_alpha && !alpha)) {
+        heap_caps_free(pixels);
+        heap_caps_free(alpha);
+        pixels = nullptr;
+        alpha = nullptr;
+        return false;
+    }
+
+    width = w;
+    height = h;
+    stride = w;
+    owned = true;
+    return true;
+}
+
+bool Surface::wrap(uint16_t* buffer, int16_t w, int16_t h, int32_t row_stride) {
+    end();
+    if (!buffer || w <= 0 || h <= 0) return false;
+    if (row_stride == 0) row_stride = w;
+    if (row_stride < w) return false;
+
+    pixels = buffer;
+    width = w;
+    height = h;
+    stride = row_stride;
+    owned = false;
+    return true;
+}
+
+void Surface::end() {
+    if (owned) {
+        heap_caps_free(pixels);
+        heap_caps_free(alpha);
+    }
+    pixels = nullptr;
+    alpha = nullptr;
+    width = 0;
+    height = 0;
+    stride = 0;
+    owned = false;
+}
+
+void Surface::clear(uint16_t color, uint8_t a) {
+    if (!pixels) return;
+
+    for (int16_t y = 0; y < height; y++) {
+        uint16_t* dst = row(y);
+        for (int16_t x = 0; x < width; x++) {
+            dst[x] = color;
+        }
+    }
+    if (alpha) {
+        memset(alpha, a, width * height);
+    }
+}
+
+void Surface::fillAlpha(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t a) {
+    if (!alpha) return;
+
+    int16_t x1 = max(x, 0);
+    int16_t y1 = max(y, 0);
+    int16_t x2 = min(x + w, width);
+    int16_t y2 = min(y + h, height);
+    for (int16_t py = y1; py < y2; py++) {
+        if (x2 > x1) memset(alpha + py * width + x1, a, x2 - x1);
+    }
+}
+
+void Surface::alphaFromColorKey(uint16_t key) {
+    if (!alpha) return;
+
+    for (int16_t y = 0; y < height; y++) {
+        const uint16_t* src = row(y);
+        uint8_t* dst = alpha + y * width;
+        for (int16_t x = 0; x < width; x++) {
+            dst[x] = (src[x] == key) ? 0 : 255;
+        }
+    }
+}
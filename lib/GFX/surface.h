@@ -0,0 +1,60 @@
+#pragma once
+#include <Arduino.h>
+
+// Where an owned surface is allocated
+enum SurfaceMemory {
+    SURFACE_PSRAM,      // Large sprites and overlays
+    SURFACE_SRAM        // Small, frequently blended surfaces
+};
+
+// RGB565 pixel buffer with its own stride
+// Graphics can draw into a surface instead of the frame buffer
+// (Graphics::setTarget) and the Compositor blends surfaces onto the screen.
+// An optional 8-bit alpha plane (0 = transparent, 255 = opaque, packed
+// width bytes per row) enables per-pixel alpha compositing.
+class Surface {
+private:
+    uint16_t* pixels;
+    uint8_t* alpha;
+    int16_t width;
+    int16_t height;
+    int32_t stride;          // Pixels per row
+    bool owned;
+
+public:
+    Surface();
+    ~Surface();
+
+    Surface(const Surface&) = delete;
+    Surface& operator=(const Surface&) = delete;
+
+    // Allocate a new surface
+    bool begin(int16_t w, int16_t h, SurfaceMemory memory = SURFACE_PSRAM, bool with_alpha = false);
+
+    // Use an existing buffer (not freed by the surface); stride 0 = width
+    bool wrap(uint16_t* buffer, int16_t w, int16_t h, int32_t row_stride = 0);
+
+    // Release the buffers
+    void end();
+
+    bool isReady() const { return pixels != nullptr; }
+    bool hasAlpha() const { return alpha != nullptr; }
+
+    // Access
+    uint16_t* getPixels() { return pixels; }
+    const uint16_t* getPixels() const { return pixels; }
+    uint8_t* getAlpha() { return alpha; }
+    const uint8_t* getAlpha() const { return alpha; }
+    uint16_t* row(int16_t y) { return pixels + y * stride; }
+    const uint16_t* row(int16_t y) const { return pixels + y * stride; }
+    int16_t getWidth() const { return width; }
+    int16_t getHeight() const { return height; }
+    int32_t getStride() const { return stride; }
+
+    // Fill every pixel (and the alpha plane, if present)
+    void clear(uint16_t color, uint8_t a = 255);
+
+    // Alpha plane helpers (no-ops without one)
+    void fillAlpha(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t a);
+    void alphaFromColorKey(uint16_t key);   // key-coloured pixels become transparent
+};
@@ -0,0 +1,400 @@
+#include "tile_renderer.h"
+#include "color_blend.h"
+#include "esp_heap_caps.h"
+
+// Helper macros
+#ifndef max
+#define max(a,b) ((a)>(b)?(a):(b))
+#endif
+#ifndef min
+#define min(a,b) ((a)<(b)?(a):(b))
+#endif
+
+// FNV-1a parameters for the per-tile hash
+#define TILE_HASH_SEED  2166136261u
+#define TILE_HASH_PRIME 16777619u
+
+TileRenderer::TileRenderer() :
+    frame_buffer(nullptr),
+    screen_width(0),
+    screen_height(0),
+    tiles_x(0),
+    tiles_y(0),
+    commands(nullptr),
+    command_count(0),
+    bin_entries(nullptr),
+    bin_start(nullptr),
+    bin_entry_count(0),
+    tile_hash(nullptr),
+    tile_valid(nullptr),
+    dirty_x1(0), dirty_y1(0), dirty_x2(-1), dirty_y2(-1),
+    recording(false) {
+    memset(&stats, 0, sizeof(stats));
+}
+
+TileRenderer::~TileRenderer() {
+    deallocate();
+}
+
+bool TileRenderer::begin(uint16_t* fb, int16_t width, int16_t height) {
+    if (!fb || width <= 0 || height <= 0) return false;
+    if (commands) return true;  // Already initialized
+
+    frame_buffer = fb;
+    screen_width = width;
+    screen_height = height;
+    tiles_x = (width + TILE_SIZE - 1) / TILE_SIZE;
+    tiles_y = (height + TILE_SIZE - 1) / TILE_SIZE;
+
+    // Command list and bins live in internal SRAM so rasterization never touches PSRAM
+    uint32_t caps = MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+    commands = (TileCommand*)heap_caps_malloc(sizeof(TileCommand) * TILE_MAX_COMMANDS, caps);
+    bin_entries = (uint16_t*)heap_caps_malloc(sizeof(uint16_t) * TILE_MAX_BIN_ENTRIES, caps);
+    bin_start = (uint16_t*)heap_caps_malloc(sizeof(uint16_t) * 2 * (tiles_y + 1), caps);
+    tile_hash = (uint32_t*)heap_caps_malloc(sizeof(uint32_t) * tiles_x * tiles_y, caps);
+    tile_valid = (uint8_t*)heap_caps_malloc(tiles_x * tiles_y, caps);
+
+    if (!commands || !bin_entries || !bin_start || !tile_hash || !tile_valid) {
+        deallocate();
+        return false;
+    }
+
+    invalidateAll();
+    return true;
+}
+
+// Frame control
+void TileRenderer::beginFrame() {
+    if (!commands) return;
+
+    memset(&stats, 0, sizeof(stats));
+    applyDirtyRegion();
+    command_count = 0;
+    bin_entry_count = 0;
+    recording = true;
+}
+
+void TileRenderer::endFrame() {
+    if (!recording) return;
+
+    flush();
+    recording = false;
+}
+
+// Command recording
+void TileRenderer::addFill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    // Fills can be clipped up front; glyphs keep their origin for bit addressing
+    int16_t x1 = max(x, 0);
+    int16_t y1 = max(y, 0);
+    int16_t x2 = min(x + w, screen_width);
+    int16_t y2 = min(y + h, screen_height);
+    if (x1 >= x2 || y1 >= y2) return;
+
+    TileCommand cmd = { x1, y1, (int16_t)(x2 - x1), (int16_t)(y2 - y1), color, TILE_CMD_FILL, 1, nullptr };
+    addCommand(cmd);
+}
+
+void TileRenderer::addGlyphGFX(int16_t x, int16_t y, uint8_t w, uint8_t h, const uint8_t* bitmap, uint16_t color) {
+    if (w == 0 || h == 0) return;
+
+    TileCommand cmd = { x, y, w, h, color, TILE_CMD_GLYPH_GFX, 1, bitmap };
+    addCommand(cmd);
+}
+
+void TileRenderer::addGlyphBuiltin(int16_t x, int16_t y, uint8_t scale, const uint8_t* columns, uint16_t color) {
+    // Same cell layout as Graphics::drawCharBuiltin(): one blank row of padding on top
+    TileCommand cmd = { x, (int16_t)(y + scale), (int16_t)(5 * scale), (int16_t)(8 * scale),
+                        color, TILE_CMD_GLYPH_BUILTIN, scale, columns };
+    addCommand(cmd);
+}
+
+void TileRenderer::addGlyphSpans(int16_t x, int16_t y, const CachedGlyph* glyph, uint16_t color) {
+    if (glyph->width == 0 || glyph->height == 0) return;
+
+    TileCommand cmd = { (int16_t)(x + glyph->x_offset), (int16_t)(y + glyph->y_offset),
+                        glyph->width, glyph->height, color, TILE_CMD_GLYPH_SPANS, glyph->scale, glyph };
+    addCommand(cmd);
+}
+
+void TileRenderer::addGlyphAA(int16_t x, int16_t y, uint8_t w, uint8_t h, const uint8_t* coverage, uint16_t color) {
+    if (w == 0 || h == 0) return;
+
+    TileCommand cmd = { x, y, w, h, color, TILE_CMD_GLYPH_AA, 1, coverage };
+    addCommand(cmd);
+}
+
+// Frame buffer changes made outside the tiled path
+void TileRenderer::markDirty(int16_t x, int16_t y, int16_t w, int16_t h) {
+    if (w <= 0 || h <= 0) return;
+
+    if (dirty_x1 > dirty_x2) {
+        dirty_x1 = x;
+        dirty_y1 = y;
+        dirty_x2 = x + w - 1;
+        dirty_y2 = y + h - 1;
+    } else {
+        dirty_x1 = min(dirty_x1, x);
+        dirty_y1 = min(dirty_y1, y);
+        dirty_x2 = max(dirty_x2, (int16_t)(x + w - 1));
+        dirty_y2 = max(dirty_y2, (int16_t)(y + h - 1));
+    }
+}
+
+void TileRenderer::invalidateAll() {
+    if (tile_valid) {
+        memset(tile_valid, 0, tiles_x * tiles_y);
+    }
+    dirty_x1 = 0;
+    dirty_x2 = -1;
+}
+
+// Private implementation functions
+bool TileRenderer::addCommand(const TileCommand& cmd) {
+    int16_t y1 = max(cmd.y, 0);
+    int16_t y2 = min(cmd.y + cmd.h, screen_height) - 1;
+    if (y1 > y2 || cmd.x >= screen_width || cmd.x + cmd.w <= 0) return false;
+
+    uint16_t rows = (y2 / TILE_SIZE) - (y1 / TILE_SIZE) + 1;
+
+    // Out of room: render what we have and start a new batch on top of it
+    if (command_count >= TILE_MAX_COMMANDS || bin_entry_count + rows > TILE_MAX_BIN_ENTRIES) {
+        flush();
+        stats.flushes++;
+    }
+
+    commands[command_count++] = cmd;
+    bin_entry_count += rows;
+    stats.commands++;
+    return true;
+}
+
+void TileRenderer::flush() {
+    if (command_count == 0) return;
+
+    // Counting sort of command indices into tile-row bins (draw order is preserved)
+    uint16_t* cursor = bin_start + tiles_y + 1;
+    memset(bin_start, 0, sizeof(uint16_t) * (tiles_y + 1));
+
+    for (uint16_t i = 0; i < command_count; i++) {
+        const TileCommand& cmd = commands[i];
+        int16_t r1 = max(cmd.y, 0) / TILE_SIZE;
+        int16_t r2 = (min(cmd.y + cmd.h, screen_height) - 1) / TILE_SIZE;
+        for (int16_t r = r1; r <= r2; r++) {
+            bin_start[r + 1]++;
+        }
+    }
+    for (int16_t r = 0; r < tiles_y; r++) {
+        bin_start[r + 1] += bin_start[r];
+        cursor[r] = bin_start[r];
+    }
+    for (uint16_t i = 0; i < command_count; i++) {
+        const TileCommand& cmd = commands[i];
+        int16_t r1 = max(cmd.y, 0) / TILE_SIZE;
+        int16_t r2 = (min(cmd.y + cmd.h, screen_height) - 1) / TILE_SIZE;
+        for (int16_t r = r1; r <= r2; r++) {
+            bin_entries[cursor[r]++] = i;
+        }
+    }
+
+    // Render each tile once
+    for (int16_t ty = 0; ty < tiles_y; ty++) {
+        const uint16_t* entries = bin_entries + bin_start[ty];
+        uint16_t entry_count = bin_start[ty + 1] - bin_start[ty];
+
+        for (int16_t tx = 0; tx < tiles_x; tx++) {
+            renderTile(tx, ty, entries, entry_count);
+        }
+    }
+
+    command_count = 0;
+    bin_entry_count = 0;
+}
+
+void TileRenderer::applyDirtyRegion() {
+    if (dirty_x1 > dirty_x2) return;
+
+    int16_t x1 = max(dirty_x1, 0) / TILE_SIZE;
+    int16_t y1 = max(dirty_y1, 0) / TILE_SIZE;
+    int16_t x2 = min(dirty_x2, screen_width - 1) / TILE_SIZE;
+    int16_t y2 = min(dirty_y2, screen_height - 1) / TILE_SIZE;
+
+    for (int16_t ty = y1; ty <= y2; ty++) {
+        for (int16_t tx = x1; tx <= x2; tx++) {
+            tile_valid[ty * tiles_x + tx] = 0;
+        }
+    }
+
+    dirty_x1 = 0;
+    dirty_x2 = -1;
+}
+
+void TileRenderer::renderTile(int16_t tx, int16_t ty, const uint16_t* entries, uint16_t entry_count) {
+    int16_t tile_x = tx * TILE_SIZE;
+    int16_t tile_y = ty * TILE_SIZE;
+    int16_t tile_w = min(TILE_SIZE, screen_width - tile_x);
+    int16_t tile_h = min(TILE_SIZE, screen_height - tile_y);
+
+    // Find the overlapping commands and the last opaque fill covering the whole tile
+    int32_t first = -1;
+    bool touched = false;
+    for (uint16_t i = 0; i < entry_count; i++) {
+        const TileCommand& cmd = commands[entries[i]];
+        if (cmd.x >= tile_x + tile_w || cmd.x + cmd.w <= tile_x) continue;
+
+        touched = true;
+        if (cmd.type == TILE_CMD_FILL &&
+            cmd.x <= tile_x && cmd.x + cmd.w >= tile_x + tile_w &&
+            cmd.y <= tile_y && cmd.y + cmd.h >= tile_y + tile_h) {
+            first = i;
+        }
+    }
+
+    if (!touched) {
+        stats.tiles_untouched++;
+        return;
+    }
+
+    // Without a covering fill the tile starts from the current frame buffer contents
+    uint16_t* fb_tile = frame_buffer + tile_y * screen_width + tile_x;
+    if (first < 0) {
+        for (int16_t row = 0; row < tile_h; row++) {
+            memcpy(&tile_buf[row * TILE_SIZE], fb_tile + row * screen_width, tile_w * sizeof(uint16_t));
+        }
+        first = 0;
+    }
+
+    for (uint16_t i = first; i < entry_count; i++) {
+        const TileCommand& cmd = commands[entries[i]];
+        if (cmd.x >= tile_x + tile_w || cmd.x + cmd.w <= tile_x) continue;
+        rasterize(cmd, tile_x, tile_y, tile_w, tile_h);
+    }
+    stats.tiles_rendered++;
+
+    // Skip the PSRAM write-back when the tile is unchanged
+    int16_t idx = ty * tiles_x + tx;
+    uint32_t hash = hashTile(tile_w, tile_h);
+    if (tile_valid[idx] && tile_hash[idx] == hash) {
+        stats.tiles_skipped++;
+        return;
+    }
+
+    for (int16_t row = 0; row < tile_h; row++) {
+        memcpy(fb_tile + row * screen_width, &tile_buf[row * TILE_SIZE], tile_w * sizeof(uint16_t));
+    }
+    tile_hash[idx] = hash;
+    tile_valid[idx] = 1;
+}
+
+void TileRenderer::rasterize(const TileCommand& cmd, int16_t tile_x, int16_t tile_y, int16_t tile_w, int16_t tile_h) {
+    // Intersect command with tile once; inner loops are unchecked
+    int16_t x1 = max(cmd.x, tile_x);
+    int16_t y1 = max(cmd.y, tile_y);
+    int16_t x2 = min(cmd.x + cmd.w, tile_x + tile_w);
+    int16_t y2 = min(cmd.y + cmd.h, tile_y + tile_h);
+    if (x1 >= x2 || y1 >= y2) return;
+
+    switch (cmd.type) {
+        case TILE_CMD_FILL:
+            for (int16_t py = y1; py < y2; py++) {
+                uint16_t* dst = &tile_buf[(py - tile_y) * TILE_SIZE + (x1 - tile_x)];
+                for (int16_t px = x1; px < x2; px++) {
+                    *dst++ = cmd.color;
+                }
+            }
+            break;
+
+        case TILE_CMD_GLYPH_GFX: {
+            const uint8_t* bitmap = (const uint8_t*)cmd.data;
+            for (int16_t py = y1; py < y2; py++) {
+                uint32_t bit = (uint32_t)(py - cmd.y) * cmd.w + (x1 - cmd.x);
+                uint16_t* dst = &tile_buf[(py - tile_y) * TILE_SIZE + (x1 - tile_x)];
+                for (int16_t px = x1; px < x2; px++, bit++, dst++) {
+                    if (bitmap[bit >> 3] & (0x80 >> (bit & 7))) {
+                        *dst = cmd.color;
+                    }
+                }
+            }
+            break;
+        }
+
+        case TILE_CMD_GLYPH_BUILTIN: {
+            const uint8_t* columns = (const uint8_t*)cmd.data;
+            for (int16_t py = y1; py < y2; py++) {
+                uint8_t mask = 1 << ((py - cmd.y) / cmd.scale);
+                uint16_t* dst = &tile_buf[(py - tile_y) * TILE_SIZE + (x1 - tile_x)];
+                for (int16_t px = x1; px < x2; px++, dst++) {
+                    if (columns[(px - cmd.x) / cmd.scale] & mask) {
+                        *dst = cmd.color;
+                    }
+                }
+            }
+            break;
+        }
+
+        case TILE_CMD_GLYPH_SPANS: {
+            // Spans are row-ordered, so stop once we pass the tile's bottom edge
+            const CachedGlyph* glyph = (const CachedGlyph*)cmd.data;
+            const GlyphSpan* span = glyph->spans;
+            const GlyphSpan* end = span + glyph->span_count;
+            for (; span < end; span++) {
+                int16_t py = cmd.y + span->y;
+                if (py < y1) continue;
+                if (py >= y2) break;
+
+                int16_t sx1 = max(cmd.x + span->x, x1);
+                int16_t sx2 = min(cmd.x + span->x + span->len, x2);
+                if (sx1 >= sx2) continue;
+                uint16_t* dst = &tile_buf[(py - tile_y) * TILE_SIZE + (sx1 - tile_x)];
+                for (int16_t px = sx1; px < sx2; px++) {
+                    *dst++ = cmd.color;
+                }
+            }
+            break;
+        }
+
+        case TILE_CMD_GLYPH_AA: {
+            // Blending against the SRAM tile is exact: everything below is already rendered
+            const uint8_t* coverage = (const uint8_t*)cmd.data;
+            uint16_t row_bytes = (cmd.w + 1) / 2;
+            for (int16_t py = y1; py < y2; py++) {
+                const uint8_t* row = coverage + (py - cmd.y) * row_bytes;
+                uint16_t* dst = &tile_buf[(py - tile_y) * TILE_SIZE + (x1 - tile_x)];
+                for (int16_t px = x1; px < x2; px++, dst++) {
+                    int16_t xx = px - cmd.x;
+                    uint8_t cov = (row[xx >> 1] >> ((xx & 1) ? 0 : 4)) & 0x0F;
+                    if (cov == 15) {
+                        *dst = cmd.color;
+                    } else if (cov) {
+                        *dst = blendRGB565_4bit(cmd.color, *dst, cov);
+                    }
+                }
+            }
+            break;
+        }
+    }
+}
+
+uint32_t TileRenderer::hashTile(int16_t tile_w, int16_t tile_h) const {
+    uint32_t hash = TILE_HASH_SEED;
+    for (int16_t row = 0; row < tile_h; row++) {
+        const uint16_t* src = &tile_buf[row * TILE_SIZE];
+        for (int16_t col = 0; col < tile_w; col++) {
+            hash = (hash ^ src[col]) * TILE_HASH_PRIME;
+        }
+    }
+    return hash;
+}
+
+void TileRenderer::deallocate() {
+    heap_caps_free(commands);
+    heap_caps_free(bin_entries);
+    heap_caps_free(bin_start);
+    heap_caps_free(tile_hash);
+    heap_caps_free(tile_valid);
+    commands = nullptr;
+    bin_entries = nullptr;
+    bin_start = nullptr;
+    tile_hash = nullptr;
+    tile_valid = nullptr;
+    recording = false;
+}
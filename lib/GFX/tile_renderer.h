@@ -0,0 +1,103 @@
+#pragma once
+#include <Arduino.h>
+#include "glyph_cache.h"
+
+// Tile configuration
+#define TILE_SIZE               32
+#define TILE_MAX_COMMANDS       768
+#define TILE_MAX_BIN_ENTRIES    (TILE_MAX_COMMANDS * 4)
+
+// Recorded draw command types
+enum TileCommandType : uint8_t {
+    TILE_CMD_FILL = 0,        // Solid rectangle
+    TILE_CMD_GLYPH_GFX,       // Adafruit 1-bpp glyph, rows packed MSB first
+    TILE_CMD_GLYPH_BUILTIN,   // Built-in 5x8 column font, scaled
+    TILE_CMD_GLYPH_SPANS,     // Pre-expanded glyph from the GlyphCache
+    TILE_CMD_GLYPH_AA         // 4-bpp coverage glyph, blended into the tile
+};
+
+// One recorded command (bounding box is in screen coordinates)
+struct TileCommand {
+    int16_t x, y, w, h;
+    uint16_t color;
+    uint8_t type;
+    uint8_t scale;            // Built-in glyph scale
+    const void* data;         // Glyph bitmap, 5x8 column data, CachedGlyph or coverage map
+};
+
+// Per-frame counters
+struct TileStats {
+    uint16_t commands;        // Commands recorded this frame
+    uint16_t tiles_rendered;  // Tiles rasterized from the command list
+    uint16_t tiles_skipped;   // Rendered tiles whose hash matched (no PSRAM write)
+    uint16_t tiles_untouched; // Tiles with no commands at all
+    uint16_t flushes;         // Early flushes caused by a full command list
+};
+
+// Tile-based renderer
+// Draw calls are recorded into a command list in internal SRAM and binned
+// by tile row. endFrame() renders every touched tile exactly once into a
+// small SRAM tile buffer, hashes it, and only writes it back to the PSRAM
+// frame buffer when the hash differs from what is already there.
+class TileRenderer {
+private:
+    uint16_t* frame_buffer;
+    int16_t screen_width;
+    int16_t screen_height;
+    int16_t tiles_x;
+    int16_t tiles_y;
+
+    // Command list and per-tile-row bins (internal SRAM)
+    TileCommand* commands;
+    uint16_t command_count;
+    uint16_t* bin_entries;
+    uint16_t* bin_start;
+    uint32_t bin_entry_count;
+
+    // Hash of what is currently in the frame buffer for each tile
+    uint32_t* tile_hash;
+    uint8_t* tile_valid;
+
+    // Area drawn outside the tiled path since the last frame
+    int16_t dirty_x1, dirty_y1, dirty_x2, dirty_y2;
+
+    uint16_t tile_buf[TILE_SIZE * TILE_SIZE];
+
+    bool recording;
+    TileStats stats;
+
+public:
+    TileRenderer();
+    ~TileRenderer();
+
+    // Initialize with the frame buffer
+    bool begin(uint16_t* fb, int16_t width, int16_t height);
+
+    // Frame control
+    void beginFrame();
+    void endFrame();
+    bool isRecording() const { return recording; }
+
+    // Command recording
+    void addFill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void addGlyphGFX(int16_t x, int16_t y, uint8_t w, uint8_t h, const uint8_t* bitmap, uint16_t color);
+    void addGlyphBuiltin(int16_t x, int16_t y, uint8_t scale, const uint8_t* columns, uint16_t color);
+    void addGlyphSpans(int16_t x, int16_t y, const CachedGlyph* glyph, uint16_t color);
+    void addGlyphAA(int16_t x, int16_t y, uint8_t w, uint8_t h, const uint8_t* coverage, uint16_t color);
+
+    // Frame buffer changes made outside the tiled path
+    void markDirty(int16_t x, int16_t y, int16_t w, int16_t h);
+    void invalidateAll();
+
+    // Statistics
+    const TileStats& getStats() const { return stats; }
+
+private:
+    bool addCommand(const TileCommand& cmd);
+    void flush();
+    void applyDirtyRegion();
+    void renderTile(int16_t tx, int16_t ty, const uint16_t* entries, uint16_t entry_count);
+    void rasterize(const TileCommand& cmd, int16_t tile_x, int16_t tile_y, int16_t tile_w, int16_t tile_h);
+    uint32_t hashTile(int16_t tile_w, int16_t tile_h) const;
+    void deallocate();
+};
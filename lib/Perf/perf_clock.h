@@ -0,0 +1,15 @@
+#pragma once
+#include <Arduino.h>
+
+// CPU cycle counter; wraps every ~17 s at 240 MHz, plenty for one scope
+static inline uint32_t perfCycles() {
+#ifdef ESP_PLATFORM
+    return ESP.getCycleCount();
+#else
+    return micros();    // Host builds count microseconds
+#endif
+}
+
+// Unique local names for the scope macros
+#define PERF_CONCAT_(a, b) a##b
+#define PERF_CONCAT(a, b) PERF_CONCAT_(a, b)
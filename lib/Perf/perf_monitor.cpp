@@ -0,0 +1,292 @@
+#include "perf_monitor.h"
+
+#ifdef ESP_PLATFORM
+#include "esp_heap_caps.h"
+#endif
+
+// Helper macros
+#ifndef max
+#define max(a,b) ((a)>(b)?(a):(b))
+#endif
+#ifndef min
+#define min(a,b) ((a)<(b)?(a):(b))
+#endif
+
+PerfMonitor::PerfMonitor() :
+    zone_count(0),
+    counter_count(0),
+    cycles_per_us(1),
+    window_start_ms(0),
+    frames(0),
+    fps(0.0f),
+    loop_start(0),
+    loop_busy_cycles(0),
+    loop_load(0),
+    top_task_count(0),
+#if PERF_TASK_STATS
+    prev_task_count(0),
+    prev_total_runtime(0),
+#endif
+    gfx(nullptr),
+    compositor(nullptr),
+    hud_layer(-1),
+    hud_enabled(false),
+    last_hud_ms(0) {
+    core_load[0] = core_load[1] = 0;
+}
+
+bool PerfMonitor::begin(Graphics* g, Compositor* c) {
+#ifdef ESP_PLATFORM
+    cycles_per_us = ESP.getCpuFreqMHz();
+#endif
+    window_start_ms = millis();
+
+    gfx = g;
+    compositor = c;
+    if (!gfx || !compositor) return false;
+    if (!hud.begin(PERF_HUD_W, PERF_HUD_H)) return false;
+
+    CompositeOptions options;
+    options.alpha = 208;
+    hud_layer = compositor->addLayer(&hud, PERF_HUD_X, PERF_HUD_Y, options);
+    return hud_layer >= 0;
+}
+
+int8_t PerfMonitor::addZone(const char* name) {
+    if (zone_count >= PERF_MAX_ZONES) return -1;
+    PerfZone& z = zones[zone_count];
+    z.name = name;
+    z.head = 0;
+    z.count = 0;
+    z.total = 0;
+    return zone_count++;
+}
+
+int8_t PerfMonitor::addCounter(const char* name) {
+    if (counter_count >= PERF_MAX_COUNTERS) return -1;
+    PerfCounter& c = counters[counter_count];
+    c.name = name;
+    c.count = 0;
+    c.window_start = 0;
+    c.rate = 0.0f;
+    return counter_count++;
+}
+
+void PerfMonitor::record(int8_t zone, uint32_t cycles) {
+    if (zone < 0 || zone >= zone_count) return;
+    PerfZone& z = zones[zone];
+    z.samples[z.head] = cycles;
+    z.head = (z.head + 1) % PERF_WINDOW;
+    if (z.count < PERF_WINDOW) z.count++;
+    z.total++;
+}
+
+void PerfMonitor::recordMicros(int8_t zone, uint32_t us) {
+    record(zone, us * cycles_per_us);
+}
+
+void PerfMonitor::update(uint32_t now_ms) {
+    uint32_t elapsed = now_ms - window_start_ms;
+    if (elapsed >= PERF_RATE_MS) {
+        fps = frames * 1000.0f / elapsed;
+        for (uint8_t i = 0; i < counter_count; i++) {
+            PerfCounter& c = counters[i];
+            c.rate = (c.count - c.window_start) * 1000.0f / elapsed;
+            c.window_start = c.count;
+        }
+        uint64_t window_cycles = (uint64_t)elapsed * 1000 * cycles_per_us;
+        loop_load = (uint8_t)min(loop_busy_cycles * 100 / window_cycles, (uint64_t)100);
+        sampleTasks(elapsed);
+
+        frames = 0;
+        loop_busy_cycles = 0;
+        window_start_ms = now_ms;
+    }
+
+    if (!hud_enabled || hud_layer < 0) return;
+    if (!compositor->isVisible(hud_layer)) {
+        renderHud();
+        compositor->show(hud_layer);
+        last_hud_ms = now_ms;
+    } else if (now_ms - last_hud_ms >= PERF_HUD_REFRESH_MS) {
+        renderHud();
+        compositor->refresh(hud_layer);
+        last_hud_ms = now_ms;
+    }
+}
+
+bool PerfMonitor::getStats(int8_t zone, PerfStats* out) const {
+    if (zone < 0 || zone >= zone_count || !zones[zone].count) return false;
+    const PerfZone& z = zones[zone];
+
+    // Sort a copy of the window (insertion sort: at most PERF_WINDOW entries)
+    uint32_t sorted[PERF_WINDOW];
+    uint64_t sum = 0;
+    for (uint8_t i = 0; i < z.count; i++) {
+        uint32_t v = z.samples[i];
+        sum += v;
+        int16_t j = i - 1;
+        while (j >= 0 && sorted[j] > v) {
+            sorted[j + 1] = sorted[j];
+            j--;
+        }
+        sorted[j + 1] = v;
+    }
+
+    uint8_t p99 = (z.count * 99 + 99) / 100 - 1;   // ceil(0.99 n) - 1
+    out->samples = z.total;
+    out->min_us = sorted[0] / cycles_per_us;
+    out->avg_us = (uint32_t)(sum / z.count / cycles_per_us);
+    out->max_us = sorted[z.count - 1] / cycles_per_us;
+    out->p99_us = sorted[p99] / cycles_per_us;
+    return true;
+}
+
+float PerfMonitor::getRate(int8_t counter) const {
+    if (counter < 0 || counter >= counter_count) return 0.0f;
+    return counters[counter].rate;
+}
+
+void PerfMonitor::printReport() const {
+    Serial.printf("Perf: %.1f FPS, loop load %u%%", fps, loop_load);
+#if PERF_TASK_STATS
+    Serial.printf(", CPU %u%% / %u%%", core_load[0], core_load[1]);
+#endif
+    Serial.println();
+
+    Serial.println("  zone            avg      p99      max      min  (us)  samples");
+    for (uint8_t i = 0; i < zone_count; i++) {
+        PerfStats s;
+        if (!getStats(i, &s)) continue;
+        Serial.printf("  %-12s %8lu %8lu %8lu %8lu  %lu\n", zones[i].name,
+                      (unsigned long)s.avg_us, (unsigned long)s.p99_us, (unsigned long)s.max_us,
+                      (unsigned long)s.min_us, (unsigned long)s.samples);
+    }
+    for (uint8_t i = 0; i < counter_count; i++) {
+        Serial.printf("  %-12s %6.1f/s (%lu)\n", counters[i].name, counters[i].rate, (unsigned long)counters[i].count);
+    }
+    for (uint8_t i = 0; i < top_task_count; i++) {
+        Serial.printf("  task %-15s %3u%%\n", top_tasks[i].name, top_tasks[i].load);
+    }
+#ifdef ESP_PLATFORM
+    Serial.printf("  heap %u free (min %u), PSRAM %u free\n",
+                  (unsigned)heap_caps_get_free_size(MALLOC_CAP_INTERNAL),
+                  (unsigned)heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL),
+                  (unsigned)heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+#endif
+}
+
+void PerfMonitor::setHudVisible(bool visible) {
+    hud_enabled = visible && hud_layer >= 0;
+    if (!hud_enabled) hideHud();
+}
+
+void PerfMonitor::hideHud() {
+    if (compositor && hud_layer >= 0) compositor->hide(hud_layer);
+}
+
+// Per-task run time since the last window, from the FreeRTOS counters
+void PerfMonitor::sampleTasks(uint32_t elapsed_ms) {
+#if PERF_TASK_STATS
+    TaskStatus_t status[PERF_MAX_TASKS];
+    uint32_t total_runtime = 0;
+    UBaseType_t n = uxTaskGetSystemState(status, PERF_MAX_TASKS, &total_runtime);
+    uint32_t window = total_runtime - prev_total_runtime;
+
+    top_task_count = 0;
+    if (prev_total_runtime && window) {
+        TaskHandle_t idle[2] = {xTaskGetIdleTaskHandleForCPU(0), xTaskGetIdleTaskHandleForCPU(portNUM_PROCESSORS - 1)};
+        for (UBaseType_t i = 0; i < n; i++) {
+            // Tasks created during the window count from zero
+            uint32_t prev = 0;
+            for (uint8_t p = 0; p < prev_task_count; p++) {
+                if (prev_tasks[p] == status[i].xHandle) prev = prev_runtime[p];
+            }
+            uint8_t load = (uint8_t)min((uint64_t)(status[i].ulRunTimeCounter - prev) * 100 / window, (uint64_t)100);
+
+            if (status[i].xHandle == idle[0]) { core_load[0] = 100 - load; continue; }
+            if (status[i].xHandle == idle[1]) { core_load[1] = 100 - load; continue; }
+
+            // Insert into the busiest few
+            uint8_t pos = top_task_count;
+            while (pos > 0 && top_tasks[pos - 1].load < load) pos--;
+            if (pos >= PERF_TOP_TASKS) continue;
+            for (uint8_t k = min(top_task_count, (uint8_t)(PERF_TOP_TASKS - 1)); k > pos; k--) {
+                top_tasks[k] = top_tasks[k - 1];
+            }
+            strncpy(top_tasks[pos].name, status[i].pcTaskName, sizeof(top_tasks[pos].name) - 1);
+            top_tasks[pos].name[sizeof(top_tasks[pos].name) - 1] = '\0';
+            top_tasks[pos].load = load;
+            if (top_task_count < PERF_TOP_TASKS) top_task_count++;
+        }
+    }
+
+    prev_task_count = min(n, (UBaseType_t)PERF_MAX_TASKS);
+    for (uint8_t i = 0; i < prev_task_count; i++) {
+        prev_tasks[i] = status[i].xHandle;
+        prev_runtime[i] = status[i].ulRunTimeCounter;
+    }
+    prev_total_runtime = total_runtime;
+#else
+    (void)elapsed_ms;
+#endif
+}
+
+void PerfMonitor::renderHud() {
+    char line[40];
+    int16_t y = 4;
+
+    gfx->setTarget(&hud);
+    gfx->fillScreen(COLOR_BLACK);
+    gfx->drawRect(0, 0, PERF_HUD_W, PERF_HUD_H, COLOR_GRAY);
+    gfx->useBuiltinFont(1);
+
+    gfx->setTextColor(COLOR_GREEN);
+    snprintf(line, sizeof(line), "FPS %.1f  loop %u%%", fps, loop_load);
+    gfx->printAt(4, y, line);
+    y += 10;
+#if PERF_TASK_STATS
+    snprintf(line, sizeof(line), "CPU %u%% %u%%", core_load[0], core_load[1]);
+    if (top_task_count) {
+        size_t len = strlen(line);
+        snprintf(line + len, sizeof(line) - len, "  %.8s %u%%", top_tasks[0].name, top_tasks[0].load);
+    }
+    gfx->printAt(4, y, line);
+    y += 10;
+#endif
+
+    // Zone breakdown, milliseconds
+    gfx->setTextColor(COLOR_GRAY);
+    gfx->printAt(4, y, "zone      avg   p99   max");
+    y += 10;
+    gfx->setTextColor(COLOR_WHITE);
+    for (uint8_t i = 0; i < zone_count && y <= PERF_HUD_H - 22; i++) {
+        PerfStats s;
+        if (!getStats(i, &s)) continue;
+        snprintf(line, sizeof(line), "%-7.7s%6.1f%6.1f%6.1f", zones[i].name,
+                 s.avg_us / 1000.0f, s.p99_us / 1000.0f, s.max_us / 1000.0f);
+        gfx->printAt(4, y, line);
+        y += 10;
+    }
+
+    // Counter rates, two per line
+    gfx->setTextColor(COLOR_CYAN);
+    for (uint8_t i = 0; i < counter_count && y <= PERF_HUD_H - 22; i += 2) {
+        int len = snprintf(line, sizeof(line), "%-5.5s%5.1f", counters[i].name, counters[i].rate);
+        if (i + 1 < counter_count) {
+            snprintf(line + len, sizeof(line) - len, "  %-5.5s%5.1f", counters[i + 1].name, counters[i + 1].rate);
+        }
+        gfx->printAt(4, y, line);
+        y += 10;
+    }
+
+#ifdef ESP_PLATFORM
+    gfx->setTextColor(COLOR_YELLOW);
+    snprintf(line, sizeof(line), "heap %uk  psram %uk",
+             (unsigned)(heap_caps_get_free_size(MALLOC_CAP_INTERNAL) / 1024),
+             (unsigned)(heap_caps_get_free_size(MALLOC_CAP_SPIRAM) / 1024));
+    gfx->printAt(4, PERF_HUD_H - 12, line);
+#endif
+
+    gfx->resetTarget();
+}
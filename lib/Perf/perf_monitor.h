@@ -0,0 +1,161 @@
+#pragma once
+#include <Arduino.h>
+#include "perf_clock.h"
+#include "graphics.h"
+#include "compositor.h"
+#include "surface.h"
+
+#ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#endif
+
+// Performance monitor configuration
+#define PERF_MAX_ZONES          10
+#define PERF_MAX_COUNTERS       10
+#define PERF_WINDOW             128     // Samples kept per zone for min/avg/max/p99
+#define PERF_RATE_MS            1000    // FPS, counter rates and CPU load window
+#define PERF_HUD_REFRESH_MS     500
+#define PERF_HUD_X              615     // Clear of the gauges, readouts and buttons
+#define PERF_HUD_Y              165
+#define PERF_HUD_W              180
+#define PERF_HUD_H              150
+#define PERF_MAX_TASKS          20      // Tasks sampled for CPU load
+#define PERF_TOP_TASKS          3       // Busiest tasks shown
+
+// Per-task CPU load needs FreeRTOS run-time stats in the sdkconfig;
+// without them only the loop task's own load is measured
+#if defined(ESP_PLATFORM) && (configUSE_TRACE_FACILITY == 1) && (configGENERATE_RUN_TIME_STATS == 1)
+#define PERF_TASK_STATS 1
+#else
+#define PERF_TASK_STATS 0
+#endif
+
+// Rolling samples of one timed zone, in cycles
+struct PerfZone {
+    const char* name;
+    uint32_t samples[PERF_WINDOW];
+    uint8_t head;
+    uint8_t count;
+    uint32_t total;          // Samples since begin()
+};
+
+// Event counter, reported as a rate
+struct PerfCounter {
+    const char* name;
+    uint32_t count;
+    uint32_t window_start;   // Count at the start of the rate window
+    float rate;              // Per second over the last window
+};
+
+// Zone statistics over the rolling window
+struct PerfStats {
+    uint32_t samples;
+    uint32_t min_us;
+    uint32_t avg_us;
+    uint32_t max_us;
+    uint32_t p99_us;
+};
+
+struct PerfTaskLoad {
+    char name[16];
+    uint8_t load;            // Percent of one core
+};
+
+// On-device instrumentation
+// Scoped timers (PERF_SCOPE) read the CPU cycle counter, so timing a zone
+// costs two register reads and a store. update() rolls the per-second
+// rates and redraws the HUD: a compositor layer showing FPS, the zone
+// breakdown, counter rates, free heap/PSRAM and CPU load.
+class PerfMonitor {
+private:
+    PerfZone zones[PERF_MAX_ZONES];
+    uint8_t zone_count;
+    PerfCounter counters[PERF_MAX_COUNTERS];
+    uint8_t counter_count;
+    uint32_t cycles_per_us;
+
+    // Rate window
+    uint32_t window_start_ms;
+    uint32_t frames;
+    float fps;
+    uint32_t loop_start;
+    uint64_t loop_busy_cycles;
+    uint8_t loop_load;
+
+    // Per-task and per-core load
+    uint8_t core_load[2];
+    PerfTaskLoad top_tasks[PERF_TOP_TASKS];
+    uint8_t top_task_count;
+#if PERF_TASK_STATS
+    TaskHandle_t prev_tasks[PERF_MAX_TASKS];
+    uint32_t prev_runtime[PERF_MAX_TASKS];
+    uint8_t prev_task_count;
+    uint32_t prev_total_runtime;
+#endif
+
+    // HUD
+    Graphics* gfx;
+    Compositor* compositor;
+    Surface hud;
+    int8_t hud_layer;
+    bool hud_enabled;
+    uint32_t last_hud_ms;
+
+public:
+    PerfMonitor();
+
+    // Allocates the HUD surface and layer (the HUD is optional)
+    bool begin(Graphics* g, Compositor* c);
+
+    // Registration; ids are -1 when full. Names must outlive the monitor.
+    int8_t addZone(const char* name);
+    int8_t addCounter(const char* name);
+
+    // Samples
+    void record(int8_t zone, uint32_t cycles);
+    void recordMicros(int8_t zone, uint32_t us);
+    void count(int8_t counter, uint32_t n = 1) {
+        if (counter >= 0 && counter < counter_count) counters[counter].count += n;
+    }
+    void frame() { frames++; }
+
+    // Bracket the busy part of loop() (not the delay) for the loop load
+    void loopStart() { loop_start = perfCycles(); }
+    void loopEnd() { loop_busy_cycles += perfCycles() - loop_start; }
+
+    // Once per loop: rolls the rate window and refreshes the HUD
+    void update(uint32_t now_ms);
+
+    // Results
+    bool getStats(int8_t zone, PerfStats* out) const;
+    float getFPS() const { return fps; }
+    float getRate(int8_t counter) const;
+    uint8_t getLoopLoad() const { return loop_load; }
+    uint8_t getCoreLoad(uint8_t core) const { return core < 2 ? core_load[core] : 0; }
+    void printReport() const;
+
+    // HUD
+    void setHudVisible(bool visible);
+    void toggleHud() { setHudVisible(!hud_enabled); }
+    bool isHudVisible() const { return hud_enabled; }
+    void hideHud();          // Before redrawing underneath; update() shows it again
+
+private:
+    void sampleTasks(uint32_t elapsed_ms);
+    void renderHud();
+};
+
+// Times the enclosing scope into a zone
+class PerfScope {
+private:
+    PerfMonitor& monitor;
+    int8_t zone;
+    uint32_t start;
+
+public:
+    PerfScope(PerfMonitor& m, int8_t z) : monitor(m), zone(z), start(perfCycles()) {}
+    ~PerfScope() { monitor.record(zone, perfCycles() - start); }
+};
+
+#define PERF_SCOPE(monitor, zone) PerfScope PERF_CONCAT(perf_scope_, __LINE__)(monitor, zone)
@@ -0,0 +1,172 @@
+#include "trace.h"
+
+#ifdef ESP_PLATFORM
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#endif
+
+Tracer tracer;
+
+Tracer::Tracer() :
+    cycles_per_us(1),
+    enabled(false) {
+    for (uint8_t c = 0; c < TRACE_MAX_CORES; c++) {
+        rings[c] = nullptr;
+        heads[c] = 0;
+    }
+}
+
+Tracer::~Tracer() {
+    for (uint8_t c = 0; c < TRACE_MAX_CORES; c++) {
+#ifdef ESP_PLATFORM
+        heap_caps_free(rings[c]);
+#else
+        free(rings[c]);
+#endif
+    }
+}
+
+bool Tracer::begin() {
+#ifdef ESP_PLATFORM
+    cycles_per_us = ESP.getCpuFreqMHz();
+#endif
+    for (uint8_t c = 0; c < TRACE_MAX_CORES; c++) {
+        if (rings[c]) continue;
+#ifdef ESP_PLATFORM
+        rings[c] = (TraceEvent*)heap_caps_malloc(TRACE_EVENTS_PER_CORE * sizeof(TraceEvent), MALLOC_CAP_SPIRAM);
+#else
+        rings[c] = (TraceEvent*)malloc(TRACE_EVENTS_PER_CORE * sizeof(TraceEvent));
+#endif
+        if (!rings[c]) return false;
+    }
+    clear();
+    return true;
+}
+
+void Tracer::clear() {
+    for (uint8_t c = 0; c < TRACE_MAX_CORES; c++) {
+        heads[c] = 0;
+    }
+}
+
+void Tracer::span(const char* name, uint32_t start_cycles) {
+    uint32_t dur = (perfCycles() - start_cycles) / cycles_per_us;
+    record(TRACE_SPAN, name, (uint32_t)now() - dur, dur);
+}
+
+void Tracer::instant(const char* name, int32_t value) {
+    record(TRACE_INSTANT, name, (uint32_t)now(), value);
+}
+
+void Tracer::counter(const char* name, int32_t value) {
+    record(TRACE_COUNTER, name, (uint32_t)now(), value);
+}
+
+uint32_t Tracer::getEventCount() const {
+    uint32_t count = 0;
+    for (uint8_t c = 0; c < TRACE_MAX_CORES; c++) {
+        count += heads[c] < TRACE_EVENTS_PER_CORE ? heads[c] : TRACE_EVENTS_PER_CORE;
+    }
+    return count;
+}
+
+void Tracer::record(TracePhase phase, const char* name, uint32_t ts_us, int32_t value) {
+#ifdef ESP_PLATFORM
+    uint8_t core = xPortGetCoreID();
+    void* task = xTaskGetCurrentTaskHandle();
+#else
+    uint8_t core = 0;
+    void* task = nullptr;
+#endif
+    if (core >= TRACE_MAX_CORES || !rings[core]) return;
+
+    // Reserve a slot; a preempting task or ISR on this core takes the next one
+    uint32_t slot = __atomic_fetch_add(&heads[core], 1, __ATOMIC_RELAXED) % TRACE_EVENTS_PER_CORE;
+    TraceEvent& e = rings[core][slot];
+    e.name = name;
+    e.ts_us = ts_us;
+    e.value = value;
+    e.task = task;
+    e.phase = phase;
+}
+
+uint64_t Tracer::now() {
+#ifdef ESP_PLATFORM
+    return esp_timer_get_time();
+#else
+    return micros();
+#endif
+}
+
+void Tracer::dump(Print& out) {
+    bool was_enabled = enabled;
+    enabled = false;
+
+    // Stored timestamps are 32-bit; rebuild them against the current time
+    // (valid for events less than ~71 minutes old)
+    uint64_t now64 = now();
+    uint32_t now32 = (uint32_t)now64;
+
+    out.print("{\"traceEvents\":[\n");
+    bool first = true;
+
+    // Processes (cores) and threads (tasks)
+    for (uint8_t c = 0; c < TRACE_MAX_CORES; c++) {
+        uint32_t head = heads[c];
+        if (!rings[c] || !head) continue;
+        out.printf("%s{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%u,\"args\":{\"name\":\"core %u\"}}",
+                   first ? "" : ",\n", c, c);
+        first = false;
+
+        void* threads[TRACE_MAX_THREADS];
+        uint8_t thread_count = 0;
+        uint32_t count = head < TRACE_EVENTS_PER_CORE ? head : TRACE_EVENTS_PER_CORE;
+        for (uint32_t i = head - count; i != head && thread_count < TRACE_MAX_THREADS; i++) {
+            void* task = rings[c][i % TRACE_EVENTS_PER_CORE].task;
+            bool known = false;
+            for (uint8_t t = 0; t < thread_count && !known; t++) {
+                known = threads[t] == task;
+            }
+            if (known) continue;
+            threads[thread_count++] = task;
+#ifdef ESP_PLATFORM
+            const char* task_name = task ? pcTaskGetName((TaskHandle_t)task) : "isr";
+#else
+            const char* task_name = "main";
+#endif
+            out.printf(",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":%lu,\"args\":{\"name\":\"%s\"}}",
+                       c, (unsigned long)(uintptr_t)task, task_name);
+        }
+    }
+
+    // Events, oldest first within each core
+    for (uint8_t c = 0; c < TRACE_MAX_CORES; c++) {
+        uint32_t head = heads[c];
+        if (!rings[c] || !head) continue;
+        uint32_t count = head < TRACE_EVENTS_PER_CORE ? head : TRACE_EVENTS_PER_CORE;
+        for (uint32_t i = head - count; i != head; i++) {
+            const TraceEvent& e = rings[c][i % TRACE_EVENTS_PER_CORE];
+            unsigned long long ts = now64 - (uint32_t)(now32 - e.ts_us);
+            unsigned long tid = (unsigned long)(uintptr_t)e.task;
+
+            out.printf(",\n{\"name\":\"%s\",\"ph\":\"%c\",\"pid\":%u,\"tid\":%lu,\"ts\":%llu",
+                       e.name, (char)e.phase, c, tid, ts);
+            switch (e.phase) {
+            case TRACE_SPAN:
+                out.printf(",\"dur\":%ld}", (long)e.value);
+                break;
+            case TRACE_INSTANT:
+                out.printf(",\"s\":\"t\",\"args\":{\"value\":%ld}}", (long)e.value);
+                break;
+            case TRACE_COUNTER:
+                out.printf(",\"args\":{\"value\":%ld}}", (long)e.value);
+                break;
+            }
+        }
+    }
+
+    out.print("\n],\"displayTimeUnit\":\"ms\"}\n");
+    enabled = was_enabled;
+}
@@ -0,0 +1,100 @@
+#pragma once
+#include <Arduino.h>
+#include "perf_clock.h"
+
+// Trace configuration (build with -DTRACE_ENABLED=0 to compile spans out)
+#ifndef TRACE_ENABLED
+#define TRACE_ENABLED 1
+#endif
+#define TRACE_EVENTS_PER_CORE   4096    // Ring size; the oldest events are overwritten
+#define TRACE_MAX_CORES         2
+#define TRACE_MAX_THREADS       16      // Distinct tasks named in a dump
+
+enum TracePhase : uint8_t {
+    TRACE_SPAN = 'X',        // Complete event: start and duration
+    TRACE_INSTANT = 'i',     // Point in time, with a value
+    TRACE_COUNTER = 'C'      // Counter track, with a value
+};
+
+struct TraceEvent {
+    const char* name;        // String literal (only the pointer is stored)
+    uint32_t ts_us;          // Low 32 bits of esp_timer time
+    int32_t value;           // Span duration (us) or instant/counter value
+    void* task;              // FreeRTOS task that recorded it
+    TracePhase phase;
+};
+
+// Span recorder with Chrome trace-event export
+// Each core writes its own ring, reserving slots with an atomic increment,
+// so tasks and ISRs never take a lock to record. dump() writes the rings
+// as JSON ({"traceEvents": [...]}) for chrome://tracing or Perfetto:
+// one process per core, one thread per task. Recording is paused while
+// dumping. Task names are looked up at dump time, so a task deleted
+// before the dump shows up by its id only.
+class Tracer {
+private:
+    TraceEvent* rings[TRACE_MAX_CORES];
+    uint32_t heads[TRACE_MAX_CORES];    // Total events reserved per core
+    uint32_t cycles_per_us;
+    volatile bool enabled;
+
+public:
+    Tracer();
+    ~Tracer();
+
+    Tracer(const Tracer&) = delete;
+    Tracer& operator=(const Tracer&) = delete;
+
+    // Allocate the rings (PSRAM); recording starts stopped
+    bool begin();
+
+    void start() { enabled = rings[0] != nullptr; }
+    void stop() { enabled = false; }
+    bool isEnabled() const { return enabled; }
+    void clear();
+
+    // Recording (callers check isEnabled() first; see the macros below)
+    void span(const char* name, uint32_t start_cycles);
+    void instant(const char* name, int32_t value = 0);
+    void counter(const char* name, int32_t value);
+
+    // Events currently held (up to the ring size per core)
+    uint32_t getEventCount() const;
+
+    // Chrome trace-event JSON of everything held
+    void dump(Print& out);
+
+private:
+    void record(TracePhase phase, const char* name, uint32_t ts_us, int32_t value);
+    static uint64_t now();
+};
+
+extern Tracer tracer;
+
+// Times the enclosing scope. The cycle counter is only read while tracing,
+// so a stopped tracer costs a flag load and a branch on entry and a branch
+// on exit. Spans that began before start() are not recorded.
+class TraceScope {
+private:
+    const char* name;
+    uint32_t start;
+    bool armed;
+
+public:
+    explicit TraceScope(const char* n) : name(n), start(0), armed(tracer.isEnabled()) {
+        if (armed) start = perfCycles();
+    }
+    ~TraceScope() {
+        if (armed && tracer.isEnabled()) tracer.span(name, start);
+    }
+};
+
+#if TRACE_ENABLED
+#define TRACE_SCOPE(name) TraceScope PERF_CONCAT(trace_scope_, __LINE__)(name)
+#define TRACE_INSTANT(name, value) do { if (tracer.isEnabled()) tracer.instant(name, value); } while (0)
+#define TRACE_COUNTER(name, value) do { if (tracer.isEnabled()) tracer.counter(name, value); } while (0)
+#else
+#define TRACE_SCOPE(name) do {} while (0)
+#define TRACE_INSTANT(name, value) do {} while (0)
+#define TRACE_COUNTER(name, value) do {} while (0)
+#endif
@@ -0,0 +1,222 @@
+#include "channel_stats.h"
+
+// Helper macros
+#ifndef max
+#define max(a,b) ((a)>(b)?(a):(b))
+#endif
+#ifndef min
+#define min(a,b) ((a)<(b)?(a):(b))
+#endif
+
+void StatsMoments::add(float value) {
+    if (!count) {
+        min = max = value;
+    } else {
+        if (value < min) min = value;
+        if (value > max) max = value;
+    }
+    count++;
+    float delta = value - mean;
+    mean += delta / count;
+    m2 += delta * (value - mean);
+}
+
+// Chan et al. pairwise combination
+void StatsMoments::merge(const StatsMoments& other) {
+    if (!other.count) return;
+    if (!count) {
+        *this = other;
+        return;
+    }
+    uint32_t n = count + other.count;
+    float delta = other.mean - mean;
+    mean += delta * other.count / n;
+    m2 += other.m2 + delta * delta * ((float)count * other.count / n);
+    if (other.min < min) min = other.min;
+    if (other.max > max) max = other.max;
+    count = n;
+}
+
+void StatsBands::merge(const StatsBands& other) {
+    for (uint8_t i = 0; i <= STATS_MAX_EDGES; i++) ms[i] += other.ms[i];
+}
+
+ChannelStats::ChannelStats() :
+    channel(0),
+    label(nullptr),
+    edge_count(0),
+    slot_ms(STATS_WINDOW_MS / STATS_WINDOW_SLOTS),
+    ewma_ms(STATS_EWMA_MS) {
+    reset();
+}
+
+void ChannelStats::begin(uint16_t id, const char* name, uint32_t window_ms, uint32_t ewma_time_ms) {
+    channel = id;
+    label = name;
+    edge_count = 0;
+    slot_ms = max(window_ms / STATS_WINDOW_SLOTS, (uint32_t)1);
+    ewma_ms = max(ewma_time_ms, (uint32_t)1);
+    reset();
+}
+
+bool ChannelStats::addEdge(float edge) {
+    if (edge_count >= STATS_MAX_EDGES) return false;
+    if (edge_count && edge <= edges[edge_count - 1]) return false;
+    edges[edge_count++] = edge;
+    return true;
+}
+
+void ChannelStats::reset() {
+    session.clear();
+    session_bands.clear();
+    for (uint8_t i = 0; i < STATS_WINDOW_SLOTS; i++) {
+        slots[i].index = 0;
+        slots[i].moments.clear();
+        slots[i].bands.clear();
+    }
+    has_last = false;
+    last_ms = 0;
+    last_value = 0;
+    ewma = 0;
+    rate = 0;
+}
+
+void ChannelStats::add(uint32_t time_ms, float value) {
+    StatsSlot& slot = slotAt(time_ms);
+    session.add(value);
+    slot.moments.add(value);
+
+    if (!has_last) {
+        ewma = value;
+    } else {
+        uint32_t dt = time_ms - last_ms;
+
+        // The previous value held until now
+        if (dt <= STATS_GAP_MS) {
+            uint8_t band = bandOf(last_value);
+            session_bands.ms[band] += dt;
+            slot.bands.ms[band] += dt;
+        }
+
+        // Irregular sampling: the weight follows the time since the last sample
+        if (dt) {
+            float alpha = 1.0f - expf(-(float)dt / ewma_ms);
+            ewma += alpha * (value - ewma);
+            rate += alpha * ((value - last_value) * 1000.0f / dt - rate);
+        }
+    }
+
+    has_last = true;
+    last_ms = time_ms;
+    last_value = value;
+}
+
+uint32_t ChannelStats::getTimeInBand(uint8_t band) const {
+    return band <= edge_count ? session_bands.ms[band] : 0;
+}
+
+uint32_t ChannelStats::getTimeAbove(float edge) const {
+    return timeAbove(session_bands, edge);
+}
+
+StatsMoments ChannelStats::getWindow(uint32_t now_ms) const {
+    StatsMoments window;
+    window.clear();
+    for (uint8_t i = 0; i < STATS_WINDOW_SLOTS; i++) {
+        if (isLive(slots[i], now_ms)) window.merge(slots[i].moments);
+    }
+    return window;
+}
+
+uint32_t ChannelStats::getWindowTimeAbove(float edge, uint32_t now_ms) const {
+    return timeAbove(windowBands(now_ms), edge);
+}
+
+void ChannelStats::printStats() const {
+    if (!session.count) return;
+    StatsMoments window = getWindow(millis());
+    Serial.printf("  %-14s %8.2f %8.2f %8.2f %8.2f  %8.2f %8.2f  %8.3f/s  %lu",
+                  label ? label : "?", session.min, session.mean, session.max, session.stddev(),
+                  window.count ? window.mean : 0.0f, window.count ? window.max : 0.0f,
+                  rate, (unsigned long)session.count);
+    for (uint8_t i = 0; i < edge_count; i++) {
+        Serial.printf("  >%g %lus", edges[i], (unsigned long)(getTimeAbove(edges[i]) / 1000));
+    }
+    Serial.println();
+}
+
+uint8_t ChannelStats::bandOf(float value) const {
+    uint8_t band = 0;
+    while (band < edge_count && value >= edges[band]) band++;
+    return band;
+}
+
+// Bands are counted from the one starting at edge (which must be one of the edges)
+uint32_t ChannelStats::timeAbove(const StatsBands& bands, float edge) const {
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < edge_count; i++) {
+        if (edges[i] >= edge) total += bands.ms[i + 1];
+    }
+    return total;
+}
+
+// Slot for time_ms, cleared if it last held an older slice
+StatsSlot& ChannelStats::slotAt(uint32_t time_ms) {
+    uint32_t index = time_ms / slot_ms;
+    StatsSlot& slot = slots[index % STATS_WINDOW_SLOTS];
+    if (slot.index != index) {
+        slot.index = index;
+        slot.moments.clear();
+        slot.bands.clear();
+    }
+    return slot;
+}
+
+StatsBands ChannelStats::windowBands(uint32_t now_ms) const {
+    StatsBands bands;
+    bands.clear();
+    for (uint8_t i = 0; i < STATS_WINDOW_SLOTS; i++) {
+        if (isLive(slots[i], now_ms)) bands.merge(slots[i].bands);
+    }
+    return bands;
+}
+
+ChannelStats* StatsEngine::addChannel(uint16_t channel, const char* name, uint32_t window_ms,
+                                      uint32_t ewma_time_ms) {
+    ChannelStats* existing = find(channel);
+    if (existing) return existing;
+    if (channel_count >= STATS_MAX_CHANNELS) return nullptr;
+    ChannelStats& c = channels[channel_count++];
+    c.begin(channel, name, window_ms, ewma_time_ms);
+    return &c;
+}
+
+ChannelStats* StatsEngine::find(uint16_t channel) {
+    for (uint8_t i = 0; i < channel_count; i++) {
+        if (channels[i].getChannel() == channel) return &channels[i];
+    }
+    return nullptr;
+}
+
+const ChannelStats* StatsEngine::find(uint16_t channel) const {
+    for (uint8_t i = 0; i < channel_count; i++) {
+        if (channels[i].getChannel() == channel) return &channels[i];
+    }
+    return nullptr;
+}
+
+void StatsEngine::add(uint16_t channel, uint32_t time_ms, float value) {
+    ChannelStats* c = find(channel);
+    if (c) c->add(time_ms, value);
+}
+
+void StatsEngine::reset() {
+    for (uint8_t i = 0; i < channel_count; i++) channels[i].reset();
+}
+
+void StatsEngine::printStats() const {
+    Serial.println("Stats: session, rolling window and rate per channel");
+    Serial.printf("  %-14s %8s %8s %8s %8s  %8s %8s  %10s  %s\n", "channel", "min", "mean", "max", "stddev",
+                  "win mean", "win max", "rate", "samples");
+    for (uint8_t i = 0; i < channel_count; i++) channels[i].printStats();
+}
@@ -0,0 +1,135 @@
+#pragma once
+#include <Arduino.h>
+
+// Streaming statistics configuration
+#define STATS_MAX_CHANNELS   24       // About 560 bytes each
+#define STATS_MAX_EDGES      3        // Band edges per channel (bands = edges + 1)
+#define STATS_WINDOW_SLOTS   12       // Rolling window resolution
+#define STATS_WINDOW_MS      300000   // Default rolling window
+#define STATS_EWMA_MS        5000     // Default EWMA time constant
+#define STATS_GAP_MS         10000    // Longer between samples isn't counted as time in a band
+
+// Count, extremes, mean and variance (Welford); two can be merged
+struct StatsMoments {
+    uint32_t count;
+    float min;
+    float max;
+    float mean;
+    float m2;                 // Sum of squared differences from the mean
+
+    void clear() { count = 0; min = max = mean = m2 = 0; }
+    void add(float value);
+    void merge(const StatsMoments& other);
+    float variance() const { return count > 1 ? m2 / (count - 1) : 0.0f; }
+    float stddev() const { return sqrtf(variance()); }
+};
+
+// Time spent in each band between a channel's edges
+struct StatsBands {
+    uint32_t ms[STATS_MAX_EDGES + 1];
+
+    void clear() { memset(ms, 0, sizeof(ms)); }
+    void merge(const StatsBands& other);
+};
+
+// One slice of the rolling window
+struct StatsSlot {
+    uint32_t index;           // time / slot length; slots of older slices are stale
+    StatsMoments moments;
+    StatsBands bands;
+};
+
+// Statistics of one channel, updated in O(1) per sample
+// Session figures cover everything since begin() or reset(). The rolling
+// window is a ring of slots, each holding the moments and band times of
+// its slice; reading it merges the live slots, so it moves in steps of
+// one slot. Time in a band is the time each sample was held for (gaps
+// longer than STATS_GAP_MS are left out, e.g. while disconnected).
+class ChannelStats {
+private:
+    uint16_t channel;
+    const char* label;
+    float edges[STATS_MAX_EDGES];
+    uint8_t edge_count;
+    uint32_t slot_ms;
+    uint32_t ewma_ms;
+
+    StatsMoments session;
+    StatsBands session_bands;
+    StatsSlot slots[STATS_WINDOW_SLOTS];
+
+    // Latest sample
+    bool has_last;
+    uint32_t last_ms;
+    float last_value;
+    float ewma;
+    float rate;               // Per second, smoothed like the EWMA
+
+public:
+    ChannelStats();
+
+    // window_ms is the rolling window length; ewma_time_ms the smoothing time constant
+    void begin(uint16_t id, const char* name, uint32_t window_ms = STATS_WINDOW_MS,
+               uint32_t ewma_time_ms = STATS_EWMA_MS);
+
+    // Band edges, ascending; band 0 is below the first edge
+    bool addEdge(float edge);
+
+    // Samples must arrive in time order
+    void add(uint32_t time_ms, float value);
+
+    // Start a new session (the rolling window restarts too)
+    void reset();
+
+    uint16_t getChannel() const { return channel; }
+    const char* getName() const { return label; }
+    bool hasData() const { return has_last; }
+    float getLast() const { return last_value; }
+    float getEwma() const { return ewma; }
+    float getRate() const { return rate; }
+
+    // Session
+    const StatsMoments& getSession() const { return session; }
+    uint32_t getTimeInBand(uint8_t band) const;
+    uint32_t getTimeAbove(float edge) const;
+
+    // Rolling window ending at now_ms
+    StatsMoments getWindow(uint32_t now_ms) const;
+    uint32_t getWindowTimeAbove(float edge, uint32_t now_ms) const;
+
+    void printStats() const;
+
+private:
+    uint8_t bandOf(float value) const;
+    uint32_t timeAbove(const StatsBands& bands, float edge) const;
+    StatsSlot& slotAt(uint32_t time_ms);
+    StatsBands windowBands(uint32_t now_ms) const;
+    bool isLive(const StatsSlot& slot, uint32_t now_ms) const {
+        return slot.moments.count && now_ms / slot_ms - slot.index < STATS_WINDOW_SLOTS;
+    }
+};
+
+// Statistics for every channel, looked up by channel id
+class StatsEngine {
+private:
+    ChannelStats channels[STATS_MAX_CHANNELS];
+    uint8_t channel_count;
+
+public:
+    StatsEngine() : channel_count(0) {}
+
+    // Add a channel (or return the existing one); nullptr when full.
+    // Names must outlive the engine.
+    ChannelStats* addChannel(uint16_t channel, const char* name, uint32_t window_ms = STATS_WINDOW_MS,
+                             uint32_t ewma_time_ms = STATS_EWMA_MS);
+    ChannelStats* find(uint16_t channel);
+    const ChannelStats* find(uint16_t channel) const;
+
+    // Samples of channels never added are ignored
+    void add(uint16_t channel, uint32_t time_ms, float value);
+
+    void reset();
+
+    uint8_t getChannelCount() const { return channel_count; }
+    void printStats() const;
+};
@@ -0,0 +1,138 @@
+#include "derived_channels.h"
+
+DerivedChannels::DerivedChannels() :
+    slot_count(0),
+    node_count(0),
+    sink(nullptr),
+    sink_arg(nullptr),
+    samples_in(0),
+    samples_out(0) {
+}
+
+void DerivedChannels::setSink(DerivedSink callback, void* arg) {
+    sink = callback;
+    sink_arg = arg;
+}
+
+bool DerivedChannels::setDefault(uint16_t channel, float value) {
+    int8_t s = addSlot(channel);
+    if (s < 0 || isNodeOutput(s)) return false;
+    slots[s].has_default = true;
+    if (!slots[s].valid) {
+        slots[s].value = value;
+        slots[s].time_ms = 0;
+        slots[s].valid = true;
+    }
+    return true;
+}
+
+bool DerivedChannels::addNode(uint16_t channel, const char* name, DerivedFunction function,
+                              const uint16_t* input_channels, uint8_t input_count, uint32_t max_skew_ms) {
+    if (node_count >= DERIVED_MAX_NODES || !function) return false;
+    if (!input_count || input_count > DERIVED_MAX_INPUTS || findSlot(channel) >= 0) return false;
+
+    DerivedNode& node = nodes[node_count];
+    node.input_mask = 0;
+    for (uint8_t i = 0; i < input_count; i++) {
+        if (input_channels[i] == channel) return false;
+        int8_t s = addSlot(input_channels[i]);
+        if (s < 0) return false;
+        node.inputs[i] = s;
+        node.input_mask |= 1UL << s;
+    }
+    int8_t out = addSlot(channel);
+    if (out < 0) return false;
+
+    node.output = out;
+    node.name = name;
+    node.function = function;
+    node.input_count = input_count;
+    node.max_skew_ms = max_skew_ms;
+    node.evaluations = 0;
+    node.stale = 0;
+    node_count++;
+    return true;
+}
+
+void DerivedChannels::add(uint16_t channel, uint32_t time_ms, float value) {
+    int8_t s = findSlot(channel);
+    if (s < 0 || isNodeOutput(s)) return;
+    slots[s].value = value;
+    slots[s].time_ms = time_ms;
+    slots[s].valid = true;
+    samples_in++;
+
+    // Declaration order is topological, so one pass reaches every dependent
+    uint32_t changed = 1UL << s;
+    for (uint8_t n = 0; n < node_count; n++) {
+        if (nodes[n].input_mask & changed) evaluate(nodes[n], time_ms, &changed);
+    }
+}
+
+bool DerivedChannels::getValue(uint16_t channel, float* value) const {
+    int8_t s = findSlot(channel);
+    if (s < 0 || !slots[s].valid) return false;
+    *value = slots[s].value;
+    return true;
+}
+
+void DerivedChannels::printStats() const {
+    Serial.printf("Derived: %lu samples in, %lu out\n", (unsigned long)samples_in, (unsigned long)samples_out);
+    for (uint8_t n = 0; n < node_count; n++) {
+        const DerivedSlot& out = slots[nodes[n].output];
+        Serial.printf("  %-14s 0x%03X %10.2f  %lu evaluated, %lu stale\n", nodes[n].name, out.channel,
+                      out.valid ? out.value : 0.0f, (unsigned long)nodes[n].evaluations,
+                      (unsigned long)nodes[n].stale);
+    }
+}
+
+int8_t DerivedChannels::findSlot(uint16_t channel) const {
+    for (uint8_t i = 0; i < slot_count; i++) {
+        if (slots[i].channel == channel) return i;
+    }
+    return -1;
+}
+
+int8_t DerivedChannels::addSlot(uint16_t channel) {
+    int8_t s = findSlot(channel);
+    if (s >= 0) return s;
+    if (slot_count >= DERIVED_MAX_SLOTS) return -1;
+    DerivedSlot& slot = slots[slot_count];
+    slot.channel = channel;
+    slot.value = 0;
+    slot.time_ms = 0;
+    slot.valid = false;
+    slot.has_default = false;
+    return slot_count++;
+}
+
+bool DerivedChannels::isNodeOutput(uint8_t slot) const {
+    for (uint8_t n = 0; n < node_count; n++) {
+        if (nodes[n].output == slot) return true;
+    }
+    return false;
+}
+
+void DerivedChannels::evaluate(DerivedNode& node, uint32_t time_ms, uint32_t* changed) {
+    float inputs[DERIVED_MAX_INPUTS];
+    for (uint8_t i = 0; i < node.input_count; i++) {
+        const DerivedSlot& in = slots[node.inputs[i]];
+        if (!in.valid || (!in.has_default && time_ms - in.time_ms > node.max_skew_ms)) {
+            node.stale++;
+            return;
+        }
+        inputs[i] = in.value;
+    }
+
+    node.evaluations++;
+    float value;
+    if (!node.function(inputs, &value)) return;
+
+    DerivedSlot& out = slots[node.output];
+    out.value = value;
+    out.time_ms = time_ms;
+    out.valid = true;
+    *changed |= 1UL << node.output;
+    samples_out++;
+    if (sink) sink(out.channel, time_ms, value, sink_arg);
+}
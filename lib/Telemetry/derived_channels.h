@@ -0,0 +1,97 @@
+#pragma once
+#include <Arduino.h>
+
+// Derived channel configuration
+#define DERIVED_MAX_NODES    8
+#define DERIVED_MAX_INPUTS   3
+#define DERIVED_MAX_SLOTS    32       // Input and output channels together (one bit each)
+#define DERIVED_CHANNEL_BASE 0x100    // Ids above the one-byte OBD PIDs
+
+// Computes a node's value from its inputs (in declaration order);
+// false when there is no meaningful value (e.g. economy while stopped)
+typedef bool (*DerivedFunction)(const float* inputs, float* output);
+
+// Receives every computed sample
+typedef void (*DerivedSink)(uint16_t channel, uint32_t time_ms, float value, void* arg);
+
+// Latest sample of a channel
+struct DerivedSlot {
+    uint16_t channel;
+    float value;
+    uint32_t time_ms;
+    bool valid;
+    bool has_default;         // Slow channel: never stale, default until first sample
+};
+
+struct DerivedNode {
+    uint8_t output;           // Slot
+    const char* name;
+    DerivedFunction function;
+    uint8_t inputs[DERIVED_MAX_INPUTS];
+    uint8_t input_count;
+    uint32_t input_mask;      // Bit per input slot
+    uint32_t max_skew_ms;     // Oldest an input may be next to the newest
+    uint32_t evaluations;
+    uint32_t stale;           // Evaluations skipped for a missing or old input
+};
+
+// Dataflow graph of channels computed from other channels
+// Each node names its input channels, raw PIDs or earlier nodes, so the
+// declaration order is a valid evaluation order and cycles can't be built.
+// A new sample marks its channel changed; one pass in order recomputes
+// only the nodes with a changed input, and each result marks its own
+// channel changed for the nodes after it.
+//
+// Inputs arrive at different rates, so each keeps its latest sample and a
+// node is evaluated at the time of the sample that triggered it. Held
+// inputs older than the node's max skew make it skip (no result rather
+// than one built from old data); channels given a default never go stale.
+class DerivedChannels {
+private:
+    DerivedSlot slots[DERIVED_MAX_SLOTS];
+    uint8_t slot_count;
+    DerivedNode nodes[DERIVED_MAX_NODES];
+    uint8_t node_count;
+
+    DerivedSink sink;
+    void* sink_arg;
+
+    // Statistics
+    uint32_t samples_in;
+    uint32_t samples_out;
+
+public:
+    DerivedChannels();
+
+    // Where computed samples go (e.g. the telemetry logger)
+    void setSink(DerivedSink callback, void* arg = nullptr);
+
+    // Value of a slowly changing input until it is first sampled (e.g. baro)
+    bool setDefault(uint16_t channel, float value);
+
+    // Add a node computing channel from inputs; the output channel must be new
+    // and the inputs raw channels or earlier nodes. Names must outlive the graph.
+    bool addNode(uint16_t channel, const char* name, DerivedFunction function,
+                 const uint16_t* input_channels, uint8_t input_count, uint32_t max_skew_ms);
+
+    // Feed a raw sample; channels no node reads are ignored
+    void add(uint16_t channel, uint32_t time_ms, float value);
+
+    // Latest value of any channel in the graph
+    bool getValue(uint16_t channel, float* value) const;
+
+    uint8_t getNodeCount() const { return node_count; }
+    uint16_t getNodeChannel(uint8_t node) const { return slots[nodes[node].output].channel; }
+    const char* getNodeName(uint8_t node) const { return nodes[node].name; }
+
+    // Statistics
+    uint32_t getSamplesIn() const { return samples_in; }
+    uint32_t getSamplesOut() const { return samples_out; }
+    void printStats() const;
+
+private:
+    int8_t findSlot(uint16_t channel) const;
+    int8_t addSlot(uint16_t channel);
+    bool isNodeOutput(uint8_t slot) const;
+    void evaluate(DerivedNode& node, uint32_t time_ms, uint32_t* changed);
+};
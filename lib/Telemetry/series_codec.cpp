@@ -0,0 +1,209 @@
+#include "series_codec.h"
+
+static uint32_t floatBits(float v) {
+    uint32_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    return bits;
+}
+
+// Control bits and payload size of a delta-of-delta
+static uint8_t timestampCost(int32_t dod) {
+    if (dod == 0) return 1;
+    if (dod >= -64 && dod <= 63) return 2 + 7;
+    if (dod >= -256 && dod <= 255) return 3 + 9;
+    if (dod >= -2048 && dod <= 2047) return 4 + 12;
+    return 4 + 32;
+}
+
+SeriesEncoder::SeriesEncoder() :
+    block(nullptr),
+    size(0),
+    bit_pos(0),
+    count(0),
+    first_ms(0),
+    last_ms(0),
+    last_delta(0),
+    last_value(0),
+    leading(0),
+    trailing(0) {
+}
+
+void SeriesEncoder::begin(uint8_t* data, uint16_t block_size) {
+    block = data;
+    size = block_size;
+    bit_pos = SERIES_HEADER_SIZE * 8;
+    count = 0;
+    last_delta = 0;
+    leading = 0xFF;          // No window yet
+    trailing = 0;
+    memset(block, 0, size);
+}
+
+bool SeriesEncoder::append(uint32_t time_ms, float value) {
+    if (!block || size < SERIES_HEADER_SIZE) return false;
+    uint32_t v = floatBits(value);
+
+    if (count == 0) {
+        memcpy(block, &time_ms, 4);
+        memcpy(block + 4, &v, 4);
+        first_ms = last_ms = time_ms;
+        last_value = v;
+        count = 1;
+        return true;
+    }
+
+    int32_t delta = (int32_t)(time_ms - last_ms);
+    int32_t dod = (int32_t)((uint32_t)delta - (uint32_t)last_delta);
+    uint32_t x = v ^ last_value;
+
+    // Size it before writing anything
+    uint8_t lz = 0, tz = 0;
+    bool reuse = false;
+    uint32_t bits = timestampCost(dod);
+    if (x == 0) {
+        bits += 1;
+    } else {
+        lz = __builtin_clz(x);
+        tz = __builtin_ctz(x);
+        reuse = leading != 0xFF && lz >= leading && tz >= trailing;
+        bits += reuse ? 2 + (32 - leading - trailing) : 2 + 5 + 5 + (32 - lz - tz);
+    }
+    if (bit_pos + bits > (uint32_t)size * 8) return false;
+
+    if (dod == 0) {
+        writeBits(0, 1);
+    } else if (dod >= -64 && dod <= 63) {
+        writeBits(0b10, 2);
+        writeBits((uint32_t)dod & 0x7F, 7);
+    } else if (dod >= -256 && dod <= 255) {
+        writeBits(0b110, 3);
+        writeBits((uint32_t)dod & 0x1FF, 9);
+    } else if (dod >= -2048 && dod <= 2047) {
+        writeBits(0b1110, 4);
+        writeBits((uint32_t)dod & 0xFFF, 12);
+    } else {
+        writeBits(0b1111, 4);
+        writeBits((uint32_t)dod, 32);
+    }
+
+    if (x == 0) {
+        writeBits(0, 1);
+    } else if (reuse) {
+        writeBits(0b10, 2);
+        writeBits(x >> trailing, 32 - leading - trailing);
+    } else {
+        writeBits(0b11, 2);
+        writeBits(lz, 5);
+        writeBits(32 - lz - tz - 1, 5);
+        writeBits(x >> tz, 32 - lz - tz);
+        leading = lz;
+        trailing = tz;
+    }
+
+    last_ms = time_ms;
+    last_delta = delta;
+    last_value = v;
+    count++;
+    return true;
+}
+
+void SeriesEncoder::writeBits(uint32_t bits, uint8_t n) {
+    while (n) {
+        uint8_t free_bits = 8 - (bit_pos & 7);
+        uint8_t take = n < free_bits ? n : free_bits;
+        uint8_t chunk = (uint8_t)((bits >> (n - take)) & ((1u << take) - 1));
+        block[bit_pos >> 3] |= chunk << (free_bits - take);
+        bit_pos += take;
+        n -= take;
+    }
+}
+
+SeriesDecoder::SeriesDecoder() :
+    block(nullptr),
+    size(0),
+    bit_pos(0),
+    remaining(0),
+    first(true),
+    time_ms(0),
+    delta(0),
+    value(0),
+    leading(0),
+    trailing(0) {
+}
+
+void SeriesDecoder::begin(const uint8_t* data, uint16_t block_size, uint16_t count) {
+    block = data;
+    size = block_size;
+    bit_pos = SERIES_HEADER_SIZE * 8;
+    remaining = (data && block_size >= SERIES_HEADER_SIZE) ? count : 0;
+    first = true;
+    delta = 0;
+    leading = 0;
+    trailing = 0;
+}
+
+bool SeriesDecoder::next(uint32_t* out_ms, float* out_value) {
+    if (!remaining) return false;
+
+    if (first) {
+        memcpy(&time_ms, block, 4);
+        memcpy(&value, block + 4, 4);
+        first = false;
+    } else {
+        // Timestamp: count the leading 1s of the prefix (at most 4)
+        uint32_t bit;
+        uint8_t ones = 0;
+        while (ones < 4) {
+            if (!readBits(1, &bit)) return false;
+            if (!bit) break;
+            ones++;
+        }
+        static const uint8_t payload[] = {0, 7, 9, 12, 32};
+        int32_t dod = 0;
+        if (ones) {
+            uint32_t raw;
+            uint8_t n = payload[ones];
+            if (!readBits(n, &raw)) return false;
+            dod = n < 32 ? (int32_t)(raw << (32 - n)) >> (32 - n) : (int32_t)raw;
+        }
+        delta = (int32_t)((uint32_t)delta + (uint32_t)dod);
+        time_ms += (uint32_t)delta;
+
+        // Value
+        if (!readBits(1, &bit)) return false;
+        if (bit) {
+            uint32_t mode, x;
+            if (!readBits(1, &mode)) return false;
+            if (mode) {
+                uint32_t lz, len;
+                if (!readBits(5, &lz) || !readBits(5, &len)) return false;
+                len += 1;
+                if (lz + len > 32) return false;
+                leading = lz;
+                trailing = 32 - lz - len;
+            }
+            if (!readBits(32 - leading - trailing, &x)) return false;
+            value ^= x << trailing;
+        }
+    }
+
+    remaining--;
+    *out_ms = time_ms;
+    memcpy(out_value, &value, sizeof(value));
+    return true;
+}
+
+bool SeriesDecoder::readBits(uint8_t n, uint32_t* bits) {
+    if (bit_pos + n > (uint32_t)size * 8) return false;
+    uint32_t result = 0;
+    while (n) {
+        uint8_t avail = 8 - (bit_pos & 7);
+        uint8_t take = n < avail ? n : avail;
+        uint8_t byte = block[bit_pos >> 3];
+        result = (result << take) | ((byte >> (avail - take)) & ((1u << take) - 1));
+        bit_pos += take;
+        n -= take;
+    }
+    *bits = result;
+    return true;
+}
@@ -0,0 +1,80 @@
+#pragma once
+#include <Arduino.h>
+
+// Compressed time series for one channel (mirrored in tools/tlog_codec.py)
+// A block starts with the first sample in full, then a bit stream (MSB
+// first) with one timestamp and one value code per further sample:
+//
+//   timestamp: delta-of-delta in ms (the delta before the second sample is 0)
+//     0                     same interval as before
+//     10  + 7 bits          -64..63
+//     110 + 9 bits          -256..255
+//     1110 + 12 bits        -2048..2047
+//     1111 + 32 bits        anything else
+//   value: XOR with the previous float (Gorilla)
+//     0                     same value
+//     10  + bits            non-zero bits fit the previous leading/trailing window
+//     11  + 5 bits leading zeros, 5 bits length - 1, then the bits
+//
+// Samples arriving at a steady rate with unchanged values cost 2 bits;
+// sensor jitter of a few ms costs 10-12 bits for the timestamp.
+
+#define SERIES_HEADER_SIZE  8            // First timestamp and value
+
+// Appends samples to a fixed-size block until it is full
+class SeriesEncoder {
+private:
+    uint8_t* block;
+    uint16_t size;
+    uint32_t bit_pos;
+    uint16_t count;
+    uint32_t first_ms;
+    uint32_t last_ms;
+    int32_t last_delta;
+    uint32_t last_value;
+    uint8_t leading;             // Window of the last XOR that was stored
+    uint8_t trailing;
+
+public:
+    SeriesEncoder();
+
+    // Start an empty block (cleared to zero)
+    void begin(uint8_t* data, uint16_t block_size);
+
+    // False if the sample does not fit; the block is unchanged
+    bool append(uint32_t time_ms, float value);
+
+    uint16_t getCount() const { return count; }
+    uint16_t getBytes() const { return count ? (bit_pos + 7) / 8 : 0; }
+    uint32_t getFirstTime() const { return first_ms; }
+    uint32_t getLastTime() const { return last_ms; }
+
+private:
+    void writeBits(uint32_t bits, uint8_t n);
+};
+
+// Reads back a block written by SeriesEncoder
+class SeriesDecoder {
+private:
+    const uint8_t* block;
+    uint16_t size;
+    uint32_t bit_pos;
+    uint16_t remaining;
+    bool first;
+    uint32_t time_ms;
+    int32_t delta;
+    uint32_t value;
+    uint8_t leading;
+    uint8_t trailing;
+
+public:
+    SeriesDecoder();
+
+    void begin(const uint8_t* data, uint16_t block_size, uint16_t count);
+
+    // False after the last sample (or on a corrupt block)
+    bool next(uint32_t* out_ms, float* out_value);
+
+private:
+    bool readBits(uint8_t n, uint32_t* bits);
+};
@@ -0,0 +1,532 @@
+#include "telemetry_logger.h"
+
+// Helper macros
+#ifndef max
+#define max(a,b) ((a)>(b)?(a):(b))
+#endif
+#ifndef min
+#define min(a,b) ((a)<(b)?(a):(b))
+#endif
+
+#define TELEMETRY_FLUSH_CHANNEL 0xFFFF   // Queued by flush() to ask the task to write
+#define TELEMETRY_STOP_CHANNEL  0xFFFE   // Queued by end(): write everything and exit
+#define TELEMETRY_STOP_WAIT_MS  5000     // A sector erase plus a block per channel fits easily
+
+static bool validHeader(const TelemetrySectorHeader& h) {
+    return h.magic == TELEMETRY_MAGIC && h.version == TELEMETRY_VERSION &&
+           h.block_size == TELEMETRY_BLOCK_SIZE / 16;
+}
+
+static bool validEntry(const TelemetryBlockEntry& e) {
+    return e.channel < TELEMETRY_STOP_CHANNEL && e.count && e.bytes <= TELEMETRY_BLOCK_SIZE &&
+           e.check == telemetryCheck(e);
+}
+
+TelemetryLogger::TelemetryLogger() :
+#ifdef ESP_PLATFORM
+    partition(nullptr),
+    queue(nullptr),
+    flash_lock(nullptr),
+    task(nullptr),
+    task_running(false),
+#endif
+    memory(nullptr),
+    sector_count(0),
+    ready(false),
+    head_sector(0),
+    head_blocks(0),
+    sequence(0),
+    session(0),
+    open_count(0),
+    flush_requested(false),
+    channel_count(0),
+    samples_written(0),
+    blocks_written(0),
+    dropped(0),
+    sectors_erased(0),
+    write_errors(0) {
+}
+
+TelemetryLogger::~TelemetryLogger() {
+    end();
+}
+
+bool TelemetryLogger::begin(const char* partition_label) {
+#ifdef ESP_PLATFORM
+    end();
+
+    partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                         (esp_partition_subtype_t)TELEMETRY_PARTITION_SUBTYPE,
+                                         partition_label);
+    if (!partition) {
+        Serial.printf("Telemetry partition '%s' not found\n", partition_label);
+        return false;
+    }
+    sector_count = partition->size / TELEMETRY_SECTOR_SIZE;
+
+    queue = xQueueCreate(TELEMETRY_QUEUE_LENGTH, sizeof(TelemetrySample));
+    flash_lock = xSemaphoreCreateMutex();
+    if (!queue || !flash_lock || sector_count < 2 || !mount()) {
+        end();
+        return false;
+    }
+    task_running = true;
+    if (xTaskCreatePinnedToCore(taskEntry, "telemetry", TELEMETRY_TASK_STACK, this,
+                                TELEMETRY_TASK_PRIORITY, &task, TELEMETRY_TASK_CORE) != pdPASS) {
+        task = nullptr;
+        task_running = false;
+        end();
+        return false;
+    }
+    ready = true;
+    return true;
+#else
+    (void)partition_label;
+    return false;
+#endif
+}
+
+bool TelemetryLogger::begin(uint8_t* data, uint32_t size) {
+    end();
+    if (!data || size < 2 * TELEMETRY_SECTOR_SIZE) return false;
+
+    memory = data;
+    sector_count = size / TELEMETRY_SECTOR_SIZE;
+    if (!mount()) {
+        end();
+        return false;
+    }
+    ready = true;
+    return true;
+}
+
+void TelemetryLogger::end() {
+#ifdef ESP_PLATFORM
+    if (task) {
+        // The task writes the open blocks and exits between flash operations,
+        // so no sector is left half written and the lock is free
+        ready = false;
+        TelemetrySample marker;
+        memset(&marker, 0xFF, sizeof(marker));
+        marker.channel = TELEMETRY_STOP_CHANNEL;
+        xQueueSend(queue, &marker, portMAX_DELAY);
+        for (uint32_t waited = 0; task_running && waited < TELEMETRY_STOP_WAIT_MS; waited += 10) {
+            vTaskDelay(pdMS_TO_TICKS(10));
+        }
+        if (task_running) {
+            // Still using the queue and lock: leak them rather than pull them away
+            Serial.println("Telemetry task did not stop");
+            queue = nullptr;
+            flash_lock = nullptr;
+        }
+        task = nullptr;
+    }
+#endif
+    if (ready) flush();
+    ready = false;
+#ifdef ESP_PLATFORM
+    if (queue) vQueueDelete(queue);
+    if (flash_lock) vSemaphoreDelete(flash_lock);
+    task = nullptr;
+    queue = nullptr;
+    flash_lock = nullptr;
+    partition = nullptr;
+#endif
+    memory = nullptr;
+    sector_count = 0;
+    open_count = 0;
+}
+
+bool TelemetryLogger::log(uint16_t channel, float value, uint32_t time_ms) {
+    if (!ready || channel >= TELEMETRY_STOP_CHANNEL) return false;
+
+    TelemetrySample s;
+    s.time_ms = time_ms;
+    s.value = value;
+    s.channel = channel;
+
+#ifdef ESP_PLATFORM
+    if (task) {
+        if (xQueueSend(queue, &s, 0) == pdTRUE) return true;
+        dropped++;
+        return false;
+    }
+#endif
+    lock();
+    add(s);
+    unlock();
+    return true;
+}
+
+void TelemetryLogger::flush() {
+#ifdef ESP_PLATFORM
+    if (task) {
+        // Queued behind the pending samples; the task clears the flag once written
+        TelemetrySample marker;
+        memset(&marker, 0xFF, sizeof(marker));
+        flush_requested = true;
+        if (xQueueSend(queue, &marker, pdMS_TO_TICKS(100)) != pdTRUE) return;
+        for (uint8_t i = 0; i < 50 && flush_requested; i++) {
+            vTaskDelay(pdMS_TO_TICKS(2));
+        }
+        return;
+    }
+#endif
+    lock();
+    for (uint8_t i = 0; i < open_count; i++) {
+        writeBlock(open_blocks[i]);
+    }
+    unlock();
+}
+
+uint16_t TelemetryLogger::query(uint16_t channel, uint32_t from_ms, uint32_t to_ms,
+                                TelemetrySample* out, uint16_t max_samples) {
+    if (!ready || !out || !max_samples) return 0;
+
+    TelemetrySectorHeader h;
+    TelemetryBlockEntry entries[TELEMETRY_BLOCKS_PER_SECTOR];
+    uint8_t block[TELEMETRY_BLOCK_SIZE];
+    lock();
+
+    // Walk back from the head to the first sector of this session that has
+    // the channel's samples from before from_ms (blocks of one channel are
+    // written in time order)
+    uint16_t start = head_sector;
+    for (uint16_t i = 0; i < sector_count; i++) {
+        uint16_t sector = (head_sector + sector_count - i) % sector_count;
+        if (!readSector(sector, 0, &h, sizeof(h)) || !validHeader(h) || h.session != session) break;
+        start = sector;
+        if (!readSector(sector, sizeof(h), entries, sizeof(entries))) break;
+        bool reached = false;
+        for (uint8_t b = 0; b < TELEMETRY_BLOCKS_PER_SECTOR && !reached; b++) {
+            reached = entries[b].channel == channel && validEntry(entries[b]) && entries[b].first_ms <= from_ms;
+        }
+        if (reached) break;
+    }
+
+    // Then forward, decoding only the blocks that overlap the range
+    uint16_t n = 0;
+    for (uint16_t sector = start; n < max_samples; sector = (sector + 1) % sector_count) {
+        if (readSector(sector, 0, &h, sizeof(h)) && validHeader(h) && h.session == session &&
+            readSector(sector, sizeof(h), entries, sizeof(entries))) {
+            for (uint8_t b = 0; b < TELEMETRY_BLOCKS_PER_SECTOR && n < max_samples; b++) {
+                const TelemetryBlockEntry& e = entries[b];
+                if (e.channel != channel || !validEntry(e) || e.last_ms < from_ms || e.first_ms > to_ms) continue;
+                if (!readSector(sector, TELEMETRY_INDEX_SIZE + b * TELEMETRY_BLOCK_SIZE, block, e.bytes)) continue;
+
+                SeriesDecoder decoder;
+                decoder.begin(block, e.bytes, e.count);
+                TelemetrySample s;
+                s.channel = channel;
+                while (n < max_samples && decoder.next(&s.time_ms, &s.value)) {
+                    if (s.time_ms >= from_ms && s.time_ms <= to_ms) out[n++] = s;
+                }
+            }
+        }
+        if (sector == head_sector) break;
+    }
+
+    if (n < max_samples) n += queryOpen(channel, from_ms, to_ms, out + n, max_samples - n);
+    unlock();
+    return n;
+}
+
+bool TelemetryLogger::setChannelName(uint16_t channel, const char* name) {
+    for (uint8_t i = 0; i < channel_count; i++) {
+        if (channels[i].id == channel) {
+            channels[i].name = name;
+            return true;
+        }
+    }
+    if (channel_count >= TELEMETRY_MAX_CHANNELS) return false;
+    channels[channel_count].id = channel;
+    channels[channel_count].name = name;
+    channel_count++;
+    return true;
+}
+
+void TelemetryLogger::dump(Print& out) {
+    if (!ready) return;
+    flush();
+
+    out.printf("TLOG %u %u %u %u\n", TELEMETRY_VERSION, TELEMETRY_SECTOR_SIZE, sector_count, session);
+    for (uint8_t i = 0; i < channel_count; i++) {
+        out.printf("C %u %s\n", channels[i].id, channels[i].name);
+    }
+
+    // Oldest first: the sector after the head has been written longest ago.
+    // Each sector is read under the lock, so it never shows a half-written block.
+    static const char hex[] = "0123456789abcdef";
+    uint8_t chunk[256];
+    char line[2 * sizeof(chunk) + 1];
+    uint16_t head = head_sector;
+    uint16_t written = 0;
+    for (uint16_t i = 1; i <= sector_count; i++) {
+        uint16_t sector = (head + i) % sector_count;
+        lock();
+        TelemetrySectorHeader h;
+        if (readSector(sector, 0, &h, sizeof(h)) && validHeader(h)) {
+            out.print("S ");
+            for (uint32_t offset = 0; offset < TELEMETRY_SECTOR_SIZE; offset += sizeof(chunk)) {
+                if (!readSector(sector, offset, chunk, sizeof(chunk))) memset(chunk, 0xFF, sizeof(chunk));
+                for (uint16_t b = 0; b < sizeof(chunk); b++) {
+                    line[2 * b] = hex[chunk[b] >> 4];
+                    line[2 * b + 1] = hex[chunk[b] & 0x0F];
+                }
+                line[sizeof(line) - 1] = '\0';
+                out.print(line);
+            }
+            out.print("\n");
+            written++;
+        }
+        unlock();
+    }
+    out.printf("TLOG END %u\n", written);
+}
+
+bool TelemetryLogger::erase() {
+    if (!ready) return false;
+
+    lock();
+    bool ok = true;
+#ifdef ESP_PLATFORM
+    if (partition) {
+        // One range erase lets the driver use 64 KB block erases
+        ok = esp_partition_erase_range(partition, 0, (uint32_t)sector_count * TELEMETRY_SECTOR_SIZE) == ESP_OK;
+        sectors_erased += sector_count;
+    }
+#endif
+    if (memory) {
+        memset(memory, 0xFF, (uint32_t)sector_count * TELEMETRY_SECTOR_SIZE);
+        sectors_erased += sector_count;
+    }
+    session++;
+    ok = ok && startSector(0);
+    unlock();
+    return ok;
+}
+
+void TelemetryLogger::printStats() const {
+    uint32_t bytes = blocks_written * (TELEMETRY_BLOCK_SIZE + sizeof(TelemetryBlockEntry));
+    Serial.printf("Telemetry: session %u, %lu samples in %lu blocks (%.2f bytes/sample, ring %lu KB), "
+                  "%lu dropped, %lu sectors erased",
+                  session, (unsigned long)samples_written, (unsigned long)blocks_written,
+                  samples_written ? (float)bytes / samples_written : 0.0f, (unsigned long)(getCapacity() / 1024),
+                  (unsigned long)dropped, (unsigned long)sectors_erased);
+    if (write_errors) Serial.printf(", %lu write errors", (unsigned long)write_errors);
+    Serial.println();
+}
+
+// Resume after the newest sector in the ring, in a new session
+bool TelemetryLogger::mount() {
+    bool found = false;
+    uint16_t newest = 0;
+    uint32_t newest_sequence = 0;
+    uint16_t newest_session = 0;
+    for (uint16_t s = 0; s < sector_count; s++) {
+        TelemetrySectorHeader h;
+        if (!readSector(s, 0, &h, sizeof(h)) || !validHeader(h)) continue;
+        if (!found || h.sequence > newest_sequence) {
+            found = true;
+            newest = s;
+            newest_sequence = h.sequence;
+            newest_session = h.session;
+        }
+    }
+
+    sequence = found ? newest_sequence : 0;
+    session = found ? newest_session + 1 : 1;
+    return startSector(found ? (newest + 1) % sector_count : 0);
+}
+
+// Erase a sector and make it the head (the oldest data in the ring is lost)
+bool TelemetryLogger::startSector(uint16_t sector) {
+    TelemetrySectorHeader h;
+    h.magic = TELEMETRY_MAGIC;
+    h.sequence = sequence + 1;
+    h.session = session;
+    h.version = TELEMETRY_VERSION;
+    h.block_size = TELEMETRY_BLOCK_SIZE / 16;
+    h.reserved = 0xFFFFFFFF;
+
+    head_sector = sector;
+    head_blocks = 0;
+    if (!eraseSector(sector) || !writeSector(sector, 0, &h, sizeof(h))) {
+        // Leave the head full so the next block moves on to another sector
+        head_blocks = TELEMETRY_BLOCKS_PER_SECTOR;
+        return false;
+    }
+    sequence = h.sequence;
+    return true;
+}
+
+// Callers hold the lock
+void TelemetryLogger::add(const TelemetrySample& s) {
+    TelemetryOpenBlock* b = nullptr;
+    for (uint8_t i = 0; i < open_count && !b; i++) {
+        if (open_blocks[i].channel == s.channel) b = &open_blocks[i];
+    }
+    if (!b) {
+        if (open_count >= TELEMETRY_MAX_CHANNELS) {
+            dropped++;
+            return;
+        }
+        b = &open_blocks[open_count++];
+        b->channel = s.channel;
+        b->encoder.begin(b->data, sizeof(b->data));
+    }
+
+    if (!b->encoder.getCount()) b->opened_ms = millis();
+    if (b->encoder.append(s.time_ms, s.value)) return;
+
+    // Full: write it and start the next block with this sample
+    writeBlock(*b);
+    b->opened_ms = millis();
+    b->encoder.append(s.time_ms, s.value);
+}
+
+// Callers hold the lock
+void TelemetryLogger::writeBlock(TelemetryOpenBlock& b) {
+    if (!b.encoder.getCount()) return;
+
+    for (uint16_t tries = 0; head_blocks >= TELEMETRY_BLOCKS_PER_SECTOR && tries < sector_count; tries++) {
+        if (!startSector((head_sector + 1) % sector_count)) write_errors++;
+    }
+    if (head_blocks >= TELEMETRY_BLOCKS_PER_SECTOR) {
+        dropped += b.encoder.getCount();
+        b.encoder.begin(b.data, sizeof(b.data));
+        return;
+    }
+
+    TelemetryBlockEntry e;
+    e.channel = b.channel;
+    e.count = b.encoder.getCount();
+    e.first_ms = b.encoder.getFirstTime();
+    e.last_ms = b.encoder.getLastTime();
+    e.bytes = b.encoder.getBytes();
+    e.check = telemetryCheck(e);
+
+    // A failed write may have programmed part of the slot, so it is skipped either way
+    uint16_t slot = head_blocks++;
+    if (writeSector(head_sector, TELEMETRY_INDEX_SIZE + slot * TELEMETRY_BLOCK_SIZE, b.data, e.bytes) &&
+        writeSector(head_sector, sizeof(TelemetrySectorHeader) + slot * sizeof(e), &e, sizeof(e))) {
+        samples_written += e.count;
+        blocks_written++;
+    } else {
+        write_errors++;
+    }
+    b.encoder.begin(b.data, sizeof(b.data));
+}
+
+void TelemetryLogger::writeExpired(uint32_t now_ms) {
+    lock();
+    for (uint8_t i = 0; i < open_count; i++) {
+        TelemetryOpenBlock& b = open_blocks[i];
+        if (b.encoder.getCount() && now_ms - b.opened_ms >= TELEMETRY_BLOCK_MAX_MS) writeBlock(b);
+    }
+    unlock();
+}
+
+// Callers hold the lock
+uint16_t TelemetryLogger::queryOpen(uint16_t channel, uint32_t from_ms, uint32_t to_ms,
+                                    TelemetrySample* out, uint16_t max_samples) {
+    uint16_t n = 0;
+    for (uint8_t i = 0; i < open_count; i++) {
+        TelemetryOpenBlock& b = open_blocks[i];
+        if (b.channel != channel || !b.encoder.getCount()) continue;
+
+        SeriesDecoder decoder;
+        decoder.begin(b.data, sizeof(b.data), b.encoder.getCount());
+        TelemetrySample s;
+        s.channel = channel;
+        while (n < max_samples && decoder.next(&s.time_ms, &s.value)) {
+            if (s.time_ms >= from_ms && s.time_ms <= to_ms) out[n++] = s;
+        }
+    }
+    return n;
+}
+
+bool TelemetryLogger::readSector(uint16_t sector, uint32_t offset, void* dst, uint32_t len) {
+    uint32_t address = (uint32_t)sector * TELEMETRY_SECTOR_SIZE + offset;
+#ifdef ESP_PLATFORM
+    if (partition) return esp_partition_read(partition, address, dst, len) == ESP_OK;
+#endif
+    if (!memory) return false;
+    memcpy(dst, memory + address, len);
+    return true;
+}
+
+bool TelemetryLogger::writeSector(uint16_t sector, uint32_t offset, const void* src, uint32_t len) {
+    uint32_t address = (uint32_t)sector * TELEMETRY_SECTOR_SIZE + offset;
+#ifdef ESP_PLATFORM
+    if (partition) return esp_partition_write(partition, address, src, len) == ESP_OK;
+#endif
+    if (!memory) return false;
+    // NOR flash only clears bits
+    const uint8_t* bytes = (const uint8_t*)src;
+    for (uint32_t i = 0; i < len; i++) {
+        memory[address + i] &= bytes[i];
+    }
+    return true;
+}
+
+bool TelemetryLogger::eraseSector(uint16_t sector) {
+    uint32_t address = (uint32_t)sector * TELEMETRY_SECTOR_SIZE;
+    sectors_erased++;
+#ifdef ESP_PLATFORM
+    if (partition) return esp_partition_erase_range(partition, address, TELEMETRY_SECTOR_SIZE) == ESP_OK;
+#endif
+    if (!memory) return false;
+    memset(memory + address, 0xFF, TELEMETRY_SECTOR_SIZE);
+    return true;
+}
+
+void TelemetryLogger::lock() {
+#ifdef ESP_PLATFORM
+    if (flash_lock) xSemaphoreTake(flash_lock, portMAX_DELAY);
+#endif
+}
+
+void TelemetryLogger::unlock() {
+#ifdef ESP_PLATFORM
+    if (flash_lock) xSemaphoreGive(flash_lock);
+#endif
+}
+
+#ifdef ESP_PLATFORM
+void TelemetryLogger::taskEntry(void* arg) {
+    ((TelemetryLogger*)arg)->run();
+}
+
+// Feeds queued samples to the open blocks; a partly filled block is
+// written once its first sample is TELEMETRY_BLOCK_MAX_MS old
+void TelemetryLogger::run() {
+    uint32_t last_poll = millis();
+    for (;;) {
+        TelemetrySample s;
+        if (xQueueReceive(queue, &s, pdMS_TO_TICKS(TELEMETRY_POLL_MS)) == pdTRUE) {
+            lock();
+            if (s.channel == TELEMETRY_FLUSH_CHANNEL || s.channel == TELEMETRY_STOP_CHANNEL) {
+                for (uint8_t i = 0; i < open_count; i++) {
+                    writeBlock(open_blocks[i]);
+                }
+                flush_requested = false;
+                if (s.channel == TELEMETRY_STOP_CHANNEL) {
+                    unlock();
+                    task_running = false;
+                    vTaskDelete(nullptr);
+                }
+            } else {
+                add(s);
+            }
+            unlock();
+        }
+
+        uint32_t now = millis();
+        if (now - last_poll >= TELEMETRY_POLL_MS) {
+            writeExpired(now);
+            last_poll = now;
+        }
+    }
+}
+#endif
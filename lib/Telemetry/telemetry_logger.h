@@ -0,0 +1,197 @@
+#pragma once
+#include <Arduino.h>
+#include "series_codec.h"
+
+#ifdef ESP_PLATFORM
+#include "esp_partition.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#endif
+
+// Telemetry log in its own flash partition (read back with tools/tlog2csv.py)
+// The partition is a ring of 4 KB sectors filled in order; the sector after
+// the head is erased only when the head reaches it, so every sector is
+// erased once per lap of the ring and wear is spread evenly. Each boot
+// starts a new session in a fresh sector.
+//
+// Samples are stored per channel in fixed-size compressed blocks
+// (series_codec.h). Each sector starts with an index of its blocks, so a
+// range query reads the indexes and decodes only the blocks it needs.
+//
+// Sector layout (little-endian):
+//   TelemetrySectorHeader
+//   TelemetryBlockEntry[TELEMETRY_BLOCKS_PER_SECTOR]    unwritten entries are 0xFF
+//   padding to TELEMETRY_INDEX_SIZE
+//   block[TELEMETRY_BLOCKS_PER_SECTOR]                  TELEMETRY_BLOCK_SIZE each
+
+#define TELEMETRY_MAGIC             0x474C5454   // "TTLG"
+#define TELEMETRY_VERSION           2
+#define TELEMETRY_PARTITION_LABEL   "telemetry"
+#define TELEMETRY_PARTITION_SUBTYPE 0x41         // After the asset bundle's 0x40
+#define TELEMETRY_SECTOR_SIZE       4096
+#define TELEMETRY_INDEX_SIZE        512
+#define TELEMETRY_BLOCK_SIZE        128          // Never crosses a 256-byte flash page
+#define TELEMETRY_BLOCKS_PER_SECTOR ((TELEMETRY_SECTOR_SIZE - TELEMETRY_INDEX_SIZE) / TELEMETRY_BLOCK_SIZE)
+#define TELEMETRY_BLOCK_MAX_MS      60000        // Longest a sample waits in RAM
+#define TELEMETRY_POLL_MS           1000         // Writer task checks block ages this often
+#define TELEMETRY_QUEUE_LENGTH      256          // Samples buffered for the writer task
+#define TELEMETRY_MAX_CHANNELS      32           // Channels logged (and named in a dump)
+#define TELEMETRY_TASK_STACK        4096
+#define TELEMETRY_TASK_PRIORITY     1
+#define TELEMETRY_TASK_CORE         0            // Away from the loop task (core 1)
+
+struct TelemetrySectorHeader {
+    uint32_t magic;
+    uint32_t sequence;        // Increases by one per sector written, never wraps in practice
+    uint16_t session;         // Boot count; sample times restart at each session
+    uint8_t version;
+    uint8_t block_size;       // In units of 16 bytes
+    uint32_t reserved;
+};
+
+// Written after its block, so a block cut short by a power loss is never indexed
+struct TelemetryBlockEntry {
+    uint16_t channel;         // OBD PID (mode 01) or derived channel id; 0xFFFF = unwritten
+    uint16_t count;           // Samples in the block
+    uint32_t first_ms;        // millis() of the first and last samples
+    uint32_t last_ms;
+    uint16_t bytes;           // Used bytes of the block
+    uint16_t check;           // telemetryCheck()
+};
+
+struct TelemetrySample {
+    uint32_t time_ms;
+    float value;
+    uint16_t channel;
+};
+
+static_assert(sizeof(TelemetrySectorHeader) == 16, "sector header layout must match tools/tlog_codec.py");
+static_assert(sizeof(TelemetryBlockEntry) == 16, "block entry layout must match tools/tlog_codec.py");
+static_assert(sizeof(TelemetrySectorHeader) + TELEMETRY_BLOCKS_PER_SECTOR * sizeof(TelemetryBlockEntry) <= TELEMETRY_INDEX_SIZE,
+              "block index must fit in front of the blocks");
+
+inline uint16_t telemetryCheck(const TelemetryBlockEntry& e) {
+    uint32_t x = e.first_ms ^ e.last_ms ^ ((uint32_t)e.count << 16 | e.channel) ^ e.bytes ^ 0xA55Au;
+    return (uint16_t)(x ^ (x >> 16));
+}
+
+struct TelemetryChannel {
+    uint16_t id;
+    const char* name;
+};
+
+// Block being filled for one channel
+struct TelemetryOpenBlock {
+    uint16_t channel;
+    uint32_t opened_ms;       // millis() when its first sample arrived
+    SeriesEncoder encoder;
+    uint8_t data[TELEMETRY_BLOCK_SIZE];
+};
+
+// Non-blocking sample logger
+// log() only queues the sample; a low-priority task on core 0 appends it
+// to its channel's open block and writes the block once it is full (or a
+// minute old), so the OBD and render loops never wait on flash. A full
+// queue drops samples (counted) rather than blocking. Each write or erase
+// still pauses the flash cache while it runs, which is why a write is a
+// single block.
+class TelemetryLogger {
+private:
+#ifdef ESP_PLATFORM
+    const esp_partition_t* partition;
+    QueueHandle_t queue;
+    SemaphoreHandle_t flash_lock;
+    TaskHandle_t task;
+    volatile bool task_running;   // Cleared by the task as it exits
+#endif
+    uint8_t* memory;          // RAM-backed log instead of the partition
+    uint16_t sector_count;
+    bool ready;
+
+    // Head of the ring
+    uint16_t head_sector;
+    uint16_t head_blocks;     // Blocks already in flash
+    uint32_t sequence;        // Of the head sector
+    uint16_t session;
+
+    TelemetryOpenBlock open_blocks[TELEMETRY_MAX_CHANNELS];
+    uint8_t open_count;
+    volatile bool flush_requested;
+
+    TelemetryChannel channels[TELEMETRY_MAX_CHANNELS];
+    uint8_t channel_count;
+
+    // Statistics
+    uint32_t samples_written;
+    uint32_t blocks_written;
+    volatile uint32_t dropped;
+    uint32_t sectors_erased;
+    uint32_t write_errors;
+
+public:
+    TelemetryLogger();
+    ~TelemetryLogger();
+
+    TelemetryLogger(const TelemetryLogger&) = delete;
+    TelemetryLogger& operator=(const TelemetryLogger&) = delete;
+
+    // Find the partition, resume after the newest sector and start the writer task
+    bool begin(const char* partition_label = TELEMETRY_PARTITION_LABEL);
+
+    // Log into memory instead (whole sectors; contents are kept like flash).
+    // There is no writer task: blocks are written as they fill, or by flush().
+    bool begin(uint8_t* data, uint32_t size);
+
+    // Stops the writer task once it has written the open blocks
+    void end();
+
+    // Queue a sample (any task); false if it was dropped
+    bool log(uint16_t channel, float value, uint32_t time_ms);
+    bool log(uint16_t channel, float value) { return log(channel, value, millis()); }
+
+    // Write every open block, full or not
+    void flush();
+
+    // Samples of one channel from this session with from_ms <= time <= to_ms,
+    // oldest first, including those not yet written. Returns the number
+    // stored; stops when out is full.
+    uint16_t query(uint16_t channel, uint32_t from_ms, uint32_t to_ms, TelemetrySample* out, uint16_t max_samples);
+
+    // Name a channel for dump(); names must outlive the logger
+    bool setChannelName(uint16_t channel, const char* name);
+
+    // Hex dump of every written sector, oldest first, for tools/tlog2csv.py
+    void dump(Print& out);
+
+    // Erase the whole log and start a new session
+    bool erase();
+
+    bool isReady() const { return ready; }
+    uint16_t getSession() const { return session; }
+    uint32_t getCapacity() const { return (uint32_t)sector_count * TELEMETRY_SECTOR_SIZE; }
+    uint32_t getSamplesWritten() const { return samples_written; }
+    uint32_t getBlocksWritten() const { return blocks_written; }
+    uint32_t getDropped() const { return dropped; }
+    uint32_t getSectorsErased() const { return sectors_erased; }
+    uint32_t getWriteErrors() const { return write_errors; }
+    void printStats() const;
+
+private:
+    bool mount();
+    bool startSector(uint16_t sector);
+    void add(const TelemetrySample& s);
+    void writeBlock(TelemetryOpenBlock& b);
+    void writeExpired(uint32_t now_ms);
+    uint16_t queryOpen(uint16_t channel, uint32_t from_ms, uint32_t to_ms, TelemetrySample* out, uint16_t max_samples);
+    bool readSector(uint16_t sector, uint32_t offset, void* dst, uint32_t len);
+    bool writeSector(uint16_t sector, uint32_t offset, const void* src, uint32_t len);
+    bool eraseSector(uint16_t sector);
+    void lock();
+    void unlock();
+#ifdef ESP_PLATFORM
+    static void taskEntry(void* arg);
+    void run();
+#endif
+};
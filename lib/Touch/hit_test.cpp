@@ -0,0 +1,143 @@
+// hit_test.cpp - Spatial index of touch targets
+#include <Arduino.h>
+#include "hit_test.h"
+
+// Helper macros
+#ifndef max
+#define max(a,b) ((a)>(b)?(a):(b))
+#endif
+#ifndef min
+#define min(a,b) ((a)<(b)?(a):(b))
+#endif
+
+HitTestIndex::HitTestIndex() :
+  target_count(0),
+  extra_margin(0),
+  lookups(0),
+  candidates_checked(0) {
+  memset(cells, 0, sizeof(cells));
+}
+
+void HitTestIndex::clear() {
+  target_count = 0;
+  memset(cells, 0, sizeof(cells));
+}
+
+int8_t HitTestIndex::add(int16_t x, int16_t y, int16_t w, int16_t h, HitCallback callback, void* arg,
+                         int8_t z, uint8_t margin) {
+  if (target_count >= HIT_MAX_TARGETS || w <= 0 || h <= 0) return -1;
+
+  int8_t id = target_count++;
+  HitTarget& t = targets[id];
+  t.x = x;
+  t.y = y;
+  t.w = w;
+  t.h = h;
+  t.margin = margin;
+  t.z = z;
+  t.enabled = true;
+  t.callback = callback;
+  t.arg = arg;
+  mark(id, true);
+  return id;
+}
+
+bool HitTestIndex::setEnabled(int8_t id, bool enabled) {
+  if (id < 0 || id >= target_count) return false;
+  if (targets[id].enabled != enabled) {
+    targets[id].enabled = enabled;
+    mark(id, enabled);
+  }
+  return true;
+}
+
+bool HitTestIndex::setBounds(int8_t id, int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (id < 0 || id >= target_count || w <= 0 || h <= 0) return false;
+  HitTarget& t = targets[id];
+  if (t.enabled) mark(id, false);
+  t.x = x;
+  t.y = y;
+  t.w = w;
+  t.h = h;
+  if (t.enabled) mark(id, true);
+  return true;
+}
+
+void HitTestIndex::setExtraMargin(uint8_t margin) {
+  if (margin == extra_margin) return;
+  extra_margin = margin;
+  rebuild();
+}
+
+int8_t HitTestIndex::hitTest(int16_t x, int16_t y) {
+  if (x < 0 || y < 0 || x >= HIT_SCREEN_W || y >= HIT_SCREEN_H) return -1;
+  lookups++;
+
+  int8_t best = -1;
+  int8_t best_z = 0;
+  int16_t best_dist = 0;     // 0 = inside the drawn bounds
+  uint32_t mask = cells[y / HIT_CELL_SIZE][x / HIT_CELL_SIZE];
+  while (mask) {
+    int8_t id = __builtin_ctz(mask);
+    mask &= mask - 1;
+    candidates_checked++;
+
+    const HitTarget& t = targets[id];
+    int16_t x1, y1, x2, y2;
+    touchArea(t, &x1, &y1, &x2, &y2);
+    if (x < x1 || x > x2 || y < y1 || y > y2) continue;
+
+    // Distance outside the drawn bounds
+    int16_t dx = x < t.x ? t.x - x : (x >= t.x + t.w ? x - (t.x + t.w - 1) : 0);
+    int16_t dy = y < t.y ? t.y - y : (y >= t.y + t.h ? y - (t.y + t.h - 1) : 0);
+    int16_t dist = max(dx, dy);
+
+    // Later targets win ties, like later drawing
+    if (best < 0 || t.z > best_z || (t.z == best_z && dist <= best_dist)) {
+      best = id;
+      best_z = t.z;
+      best_dist = dist;
+    }
+  }
+  return best;
+}
+
+bool HitTestIndex::dispatch(int16_t x, int16_t y) {
+  int8_t id = hitTest(x, y);
+  if (id < 0) return false;
+
+  // The callback may clear() and rebuild the index (e.g. a screen change)
+  HitCallback callback = targets[id].callback;
+  void* arg = targets[id].arg;
+  if (callback) callback(id, arg);
+  return true;
+}
+
+void HitTestIndex::touchArea(const HitTarget& t, int16_t* x1, int16_t* y1, int16_t* x2, int16_t* y2) const {
+  int16_t m = t.margin + extra_margin;
+  *x1 = max(t.x - m, 0);
+  *y1 = max(t.y - m, 0);
+  *x2 = min(t.x + t.w - 1 + m, HIT_SCREEN_W - 1);
+  *y2 = min(t.y + t.h - 1 + m, HIT_SCREEN_H - 1);
+}
+
+void HitTestIndex::mark(int8_t id, bool set) {
+  int16_t x1, y1, x2, y2;
+  touchArea(targets[id], &x1, &y1, &x2, &y2);
+  if (x1 > x2 || y1 > y2) return;   // Entirely off screen
+
+  uint32_t bit = 1UL << id;
+  for (int16_t row = y1 / HIT_CELL_SIZE; row <= y2 / HIT_CELL_SIZE; row++) {
+    for (int16_t col = x1 / HIT_CELL_SIZE; col <= x2 / HIT_CELL_SIZE; col++) {
+      if (set) cells[row][col] |= bit;
+      else     cells[row][col] &= ~bit;
+    }
+  }
+}
+
+void HitTestIndex::rebuild() {
+  memset(cells, 0, sizeof(cells));
+  for (uint8_t i = 0; i < target_count; i++) {
+    if (targets[i].enabled) mark(i, true);
+  }
+}
@@ -0,0 +1,77 @@
+// hit_test.h - Spatial index of touch targets
+#include <Arduino.h>
+
+#ifndef HIT_TEST_H
+#define HIT_TEST_H
+
+// Hit-test configuration
+#define HIT_MAX_TARGETS     32      // One bit per target in each grid cell
+#define HIT_SCREEN_W        800
+#define HIT_SCREEN_H        480
+#define HIT_CELL_SIZE       40
+#define HIT_GRID_COLS       ((HIT_SCREEN_W + HIT_CELL_SIZE - 1) / HIT_CELL_SIZE)
+#define HIT_GRID_ROWS       ((HIT_SCREEN_H + HIT_CELL_SIZE - 1) / HIT_CELL_SIZE)
+#define HIT_DRIVING_MARGIN  16      // Extra pixels around every target while moving
+
+typedef void (*HitCallback)(int8_t id, void* arg);
+
+struct HitTarget {
+  int16_t x, y, w, h;      // Drawn bounds
+  uint8_t margin;          // Touch area beyond the bounds
+  int8_t z;                // Higher wins where targets overlap
+  bool enabled;
+  HitCallback callback;
+  void* arg;
+};
+
+// Touch targets registered by the draw code as it lays out a screen
+// Each grid cell holds a bit mask of the targets whose touch area covers
+// it, so a lookup reads one cell and checks at most the targets in it,
+// however many are on screen. Where touch areas overlap, the highest z
+// wins, then a target the point is actually inside, then the nearest one,
+// so enlarged margins never steal a touch from a neighbouring button.
+class HitTestIndex {
+private:
+  HitTarget targets[HIT_MAX_TARGETS];
+  uint8_t target_count;
+  uint8_t extra_margin;
+  uint32_t cells[HIT_GRID_ROWS][HIT_GRID_COLS];
+
+  // Statistics
+  uint32_t lookups;
+  uint32_t candidates_checked;
+
+public:
+  HitTestIndex();
+
+  // Forget every target (call before redrawing the layout)
+  void clear();
+
+  // Register a target; returns its id, or -1 when full
+  int8_t add(int16_t x, int16_t y, int16_t w, int16_t h, HitCallback callback, void* arg = nullptr,
+             int8_t z = 0, uint8_t margin = 0);
+  bool setEnabled(int8_t id, bool enabled);
+  bool setBounds(int8_t id, int16_t x, int16_t y, int16_t w, int16_t h);
+  uint8_t getTargetCount() const { return target_count; }
+
+  // Margin added to every target, e.g. HIT_DRIVING_MARGIN while moving
+  void setExtraMargin(uint8_t margin);
+  uint8_t getExtraMargin() const { return extra_margin; }
+
+  // Topmost target at a point, or -1
+  int8_t hitTest(int16_t x, int16_t y);
+
+  // Run the callback of the target at a point; false on a miss
+  bool dispatch(int16_t x, int16_t y);
+
+  // Statistics
+  uint32_t getLookups() const { return lookups; }
+  uint32_t getCandidatesChecked() const { return candidates_checked; }
+
+private:
+  void touchArea(const HitTarget& t, int16_t* x1, int16_t* y1, int16_t* x2, int16_t* y2) const;
+  void mark(int8_t id, bool set);
+  void rebuild();
+};
+
+#endif // HIT_TEST_H
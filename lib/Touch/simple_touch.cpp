@@ -3,11 +3,12 @@
 #include "simple_touch.h"
 
 int touch_last_x = 0, touch_last_y = 0;
+uint8_t touch_i2c_addr = GT911_ADDR1;
 
 TAMC_GT911 ts = TAMC_GT911(TOUCH_GT911_SDA, TOUCH_GT911_SCL, TOUCH_GT911_INT, TOUCH_GT911_RST, 
                            max(TOUCH_MAP_X1, TOUCH_MAP_X2), max(TOUCH_MAP_Y1, TOUCH_MAP_Y2));
 
-void touch_init()
+bool touch_init()
 {
   Wire.begin(TOUCH_GT911_SDA, TOUCH_GT911_SCL);
 
@@ -23,6 +24,7 @@ void touch_init()
       Serial.print("GT911 touch controller found at 0x");
       Serial.println(addr, HEX);
       ts.begin(addr);
+      touch_i2c_addr = addr;
       done = true;
     }
   }
@@ -32,6 +34,7 @@ void touch_init()
   }
 
   ts.setRotation(TOUCH_GT911_ROTATION);
+  return done;
 }
 
 bool touch_touched()
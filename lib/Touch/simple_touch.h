@@ -20,8 +20,9 @@
 extern int touch_last_x, touch_last_y;
 
 extern TAMC_GT911 ts;
+extern uint8_t touch_i2c_addr;   // Address the controller answered on
 
-void touch_init();
+bool touch_init();
 bool touch_touched();
 
 #endif // SIMPLE_TOUCH_H
\ No newline at end of file
@@ -0,0 +1,313 @@
+// touch_service.cpp - Interrupt-driven GT911 touch input with gesture recognition
+#include <Arduino.h>
+#include "touch_service.h"
+
+#define GT911_REG_STATUS 0x814E   // Bit 7: new report, low nibble: contacts
+
+// Helper macros
+#ifndef max
+#define max(a,b) ((a)>(b)?(a):(b))
+#endif
+#ifndef min
+#define min(a,b) ((a)<(b)?(a):(b))
+#endif
+
+TouchService::TouchService() :
+  active_count(0),
+#ifdef ESP_PLATFORM
+  task(nullptr),
+  queue(nullptr),
+#else
+  ring_head(0),
+  ring_count(0),
+#endif
+  use_interrupt(false),
+  irq_us(0),
+  last_report_ms(0) {
+  memset(contacts, 0, sizeof(contacts));
+  memset(&stats, 0, sizeof(stats));
+}
+
+TouchService::~TouchService() {
+#ifdef ESP_PLATFORM
+  if (use_interrupt) detachInterrupt(TOUCH_GT911_INT);
+  if (task) vTaskDelete(task);
+  if (queue) vQueueDelete(queue);
+#endif
+}
+
+bool TouchService::begin() {
+  if (!touch_init()) return false;
+
+#ifdef ESP_PLATFORM
+  queue = xQueueCreate(TOUCH_QUEUE_LENGTH, sizeof(TouchEvent));
+  if (!queue) return false;
+  if (xTaskCreate(taskEntry, "touch", TOUCH_TASK_STACK, this, TOUCH_TASK_PRIORITY, &task) != pdPASS) {
+    task = nullptr;
+    return false;
+  }
+
+  // The GT911 pulses INT once per report while touched; rising edges catch
+  // every pulse whichever polarity the controller is configured for
+  use_interrupt = TOUCH_GT911_INT >= 0;
+  if (use_interrupt) {
+    pinMode(TOUCH_GT911_INT, INPUT);
+    attachInterruptArg(TOUCH_GT911_INT, onInterrupt, this, RISING);
+  } else {
+    Serial.println("Touch INT not wired - polling");
+  }
+  xTaskNotifyGive(task);   // First pass picks up a finger that is already down
+#endif
+  return true;
+}
+
+bool TouchService::poll(TouchEvent* event, uint32_t timeout_ms) {
+#ifdef ESP_PLATFORM
+  if (!queue) return false;
+  return xQueueReceive(queue, event, pdMS_TO_TICKS(timeout_ms)) == pdTRUE;
+#else
+  // No task on the host: service the controller inline
+  (void)timeout_ms;
+  serviceOnce(false);
+  if (!ring_count) return false;
+  *event = ring[ring_head];
+  ring_head = (ring_head + 1) % TOUCH_QUEUE_LENGTH;
+  ring_count--;
+  return true;
+#endif
+}
+
+void TouchService::markHandled(const TouchEvent& event) {
+  uint32_t latency = micros() - event.input_us;
+  stats.latency_samples++;
+  stats.latency_last_us = latency;
+  stats.latency_total_us += latency;
+  if (latency > stats.latency_max_us) stats.latency_max_us = latency;
+}
+
+void TouchService::printStats() const {
+  Serial.printf("Touch: %s, %lu INT, %lu reads (%lu reports), %lu events, %lu dropped\n",
+                use_interrupt ? "interrupt" : "polling",
+                (unsigned long)stats.interrupts, (unsigned long)stats.reads, (unsigned long)stats.reports,
+                (unsigned long)stats.events, (unsigned long)stats.dropped);
+  if (stats.latency_samples) {
+    Serial.printf("Touch latency: last %lu us, avg %lu us, max %lu us (%lu samples)\n",
+                  (unsigned long)stats.latency_last_us,
+                  (unsigned long)(stats.latency_total_us / stats.latency_samples),
+                  (unsigned long)stats.latency_max_us, (unsigned long)stats.latency_samples);
+  }
+}
+
+// Read one report if the controller has a new one. Checking the status
+// byte first means stray edges and timeouts can't look like a release.
+bool TouchService::readReport(uint32_t now_ms, uint32_t input_us) {
+  stats.reads++;
+  Wire.beginTransmission(touch_i2c_addr);
+  Wire.write(GT911_REG_STATUS >> 8);
+  Wire.write(GT911_REG_STATUS & 0xFF);
+  if (Wire.endTransmission() != 0) return false;
+  if (Wire.requestFrom(touch_i2c_addr, (uint8_t)1) != 1) return false;
+  if (!(Wire.read() & 0x80)) return false;
+
+  ts.read();   // Points, then clears the status for the next report
+  stats.reports++;
+  last_report_ms = now_ms;
+
+  Point points[TOUCH_MAX_POINTS];
+  uint8_t count = ts.isTouched ? min((int)ts.touches, TOUCH_MAX_POINTS) : 0;
+  for (uint8_t i = 0; i < count; i++) {
+    points[i].id = ts.points[i].id;
+    points[i].x = map(ts.points[i].x, TOUCH_MAP_X1, TOUCH_MAP_X2, 0, 799);
+    points[i].y = map(ts.points[i].y, TOUCH_MAP_Y1, TOUCH_MAP_Y2, 0, 479);
+  }
+  processReport(points, count, now_ms, input_us);
+  return true;
+}
+
+// One pass of the task; returns how long to sleep (UINT32_MAX = until INT)
+uint32_t TouchService::serviceOnce(bool notified) {
+  uint32_t now = millis();
+  bool overdue = active_count && now - last_report_ms >= TOUCH_RELEASE_TIMEOUT_MS;
+
+  if (notified || !use_interrupt || overdue) {
+    readReport(now, notified ? irq_us : micros());
+  }
+
+  // Reports arrive every few ms while a finger is down, so silence means
+  // the release report was lost
+  if (active_count && now - last_report_ms >= TOUCH_RELEASE_TIMEOUT_MS) {
+    processReport(nullptr, 0, now, micros());
+  }
+
+  uint32_t next = checkTimers(now);
+  if (!use_interrupt) return TOUCH_POLL_MS;
+  if (!active_count) return UINT32_MAX;
+  uint32_t release_in = TOUCH_RELEASE_TIMEOUT_MS - min(now - last_report_ms, (uint32_t)TOUCH_RELEASE_TIMEOUT_MS - 1);
+  return min(next, release_in);
+}
+
+// Gesture engine
+void TouchService::processReport(const Point* points, uint8_t count, uint32_t now_ms, uint32_t input_us) {
+  // Contacts missing from the report have lifted
+  for (uint8_t i = 0; i < TOUCH_MAX_POINTS; i++) {
+    Contact& c = contacts[i];
+    if (!c.active) continue;
+    bool present = false;
+    for (uint8_t p = 0; p < count && !present; p++) {
+      present = points[p].id == c.id;
+    }
+    if (!present) {
+      c.input_us = input_us;
+      release(c, now_ms, count);
+    }
+  }
+
+  for (uint8_t p = 0; p < count; p++) {
+    Contact* c = nullptr;
+    for (uint8_t i = 0; i < TOUCH_MAX_POINTS && !c; i++) {
+      if (contacts[i].active && contacts[i].id == points[p].id) c = &contacts[i];
+    }
+    if (!c) {
+      // New contact
+      for (uint8_t i = 0; i < TOUCH_MAX_POINTS && !c; i++) {
+        if (!contacts[i].active) c = &contacts[i];
+      }
+      if (!c) continue;
+      memset(c, 0, sizeof(*c));
+      c->active = true;
+      c->id = points[p].id;
+      c->start_x = c->x = c->sent_x = points[p].x;
+      c->start_y = c->y = c->sent_y = points[p].y;
+      c->down_ms = now_ms;
+      c->input_us = input_us;
+      continue;
+    }
+
+    c->x = points[p].x;
+    c->y = points[p].y;
+    if (abs(c->x - c->start_x) > TOUCH_SLOP || abs(c->y - c->start_y) > TOUCH_SLOP) {
+      c->moved = true;
+    }
+    // MOVEs back off when the UI falls behind so UP and gestures still fit;
+    // the next one carries the latest position anyway
+    if (c->confirmed && (abs(c->x - c->sent_x) >= TOUCH_MOVE_STEP || abs(c->y - c->sent_y) >= TOUCH_MOVE_STEP) &&
+        queueSpace() > TOUCH_QUEUE_RESERVE) {
+      c->input_us = input_us;
+      c->sent_x = c->x;
+      c->sent_y = c->y;
+      post(TOUCH_MOVE, *c, now_ms, count);
+    }
+  }
+
+  active_count = 0;
+  for (uint8_t i = 0; i < TOUCH_MAX_POINTS; i++) {
+    if (contacts[i].active) active_count++;
+  }
+  checkTimers(now_ms);
+}
+
+// Debounce confirmation and long presses; ms until the next timer is due
+uint32_t TouchService::checkTimers(uint32_t now_ms) {
+  uint32_t next = UINT32_MAX;
+  for (uint8_t i = 0; i < TOUCH_MAX_POINTS; i++) {
+    Contact& c = contacts[i];
+    if (!c.active) continue;
+    uint32_t held = now_ms - c.down_ms;
+
+    if (!c.confirmed) {
+      if (held < TOUCH_DEBOUNCE_MS) {
+        next = min(next, TOUCH_DEBOUNCE_MS - held);
+        continue;
+      }
+      c.confirmed = true;
+      post(TOUCH_DOWN, c, now_ms, active_count);
+    }
+    if (!c.moved && !c.long_fired) {
+      if (held >= TOUCH_LONG_PRESS_MS) {
+        c.long_fired = true;
+        post(TOUCH_LONG_PRESS, c, now_ms, active_count);
+      } else {
+        next = min(next, TOUCH_LONG_PRESS_MS - held);
+      }
+    }
+  }
+  return next;
+}
+
+void TouchService::release(Contact& c, uint32_t now_ms, uint8_t touches) {
+  uint32_t held = now_ms - c.down_ms;
+  if (!c.confirmed && held >= TOUCH_DEBOUNCE_MS) {
+    c.confirmed = true;   // Only one report made it before the release
+    post(TOUCH_DOWN, c, now_ms, touches + 1);
+  }
+  c.active = false;
+  if (!c.confirmed) return;   // Bounce
+
+  post(TOUCH_UP, c, now_ms, touches);
+  if (c.long_fired) return;
+
+  int16_t dx = c.x - c.start_x;
+  int16_t dy = c.y - c.start_y;
+  if (held <= TOUCH_SWIPE_MAX_MS && max(abs(dx), abs(dy)) >= TOUCH_SWIPE_MIN) {
+    if (abs(dx) >= abs(dy)) post(dx > 0 ? TOUCH_SWIPE_RIGHT : TOUCH_SWIPE_LEFT, c, now_ms, touches);
+    else                    post(dy > 0 ? TOUCH_SWIPE_DOWN : TOUCH_SWIPE_UP, c, now_ms, touches);
+  } else if (!c.moved && held <= TOUCH_TAP_MAX_MS) {
+    post(TOUCH_TAP, c, now_ms, touches);
+  }
+}
+
+uint8_t TouchService::queueSpace() const {
+#ifdef ESP_PLATFORM
+  return uxQueueSpacesAvailable(queue);
+#else
+  return TOUCH_QUEUE_LENGTH - ring_count;
+#endif
+}
+
+void TouchService::post(TouchEventType type, const Contact& c, uint32_t now_ms, uint8_t touches) {
+  TouchEvent event;
+  event.type = type;
+  event.id = c.id;
+  event.touches = touches;
+  bool at_start = type == TOUCH_DOWN || type >= TOUCH_TAP;   // Gestures report where they began
+  event.x = at_start ? c.start_x : c.x;
+  event.y = at_start ? c.start_y : c.y;
+  event.dx = c.x - c.start_x;
+  event.dy = c.y - c.start_y;
+  event.duration_ms = now_ms - c.down_ms;
+  event.input_us = c.input_us;
+
+#ifdef ESP_PLATFORM
+  bool queued = xQueueSend(queue, &event, 0) == pdTRUE;
+#else
+  bool queued = ring_count < TOUCH_QUEUE_LENGTH;
+  if (queued) {
+    ring[(ring_head + ring_count) % TOUCH_QUEUE_LENGTH] = event;
+    ring_count++;
+  }
+#endif
+  if (queued) stats.events++;
+  else        stats.dropped++;
+}
+
+#ifdef ESP_PLATFORM
+void TouchService::taskEntry(void* arg) {
+  TouchService* self = (TouchService*)arg;
+  uint32_t wait_ms = UINT32_MAX;
+  for (;;) {
+    TickType_t ticks = (wait_ms == UINT32_MAX) ? portMAX_DELAY : pdMS_TO_TICKS(wait_ms);
+    bool notified = ulTaskNotifyTake(pdTRUE, ticks ? ticks : 1) > 0;
+    wait_ms = self->serviceOnce(notified);
+  }
+}
+
+void IRAM_ATTR TouchService::onInterrupt(void* arg) {
+  TouchService* self = (TouchService*)arg;
+  self->irq_us = micros();
+  self->stats.interrupts++;
+
+  BaseType_t woken = pdFALSE;
+  vTaskNotifyGiveFromISR(self->task, &woken);
+  if (woken) portYIELD_FROM_ISR();
+}
+#endif
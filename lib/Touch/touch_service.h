@@ -0,0 +1,142 @@
+// touch_service.h - Interrupt-driven GT911 touch input with gesture recognition
+#include <Arduino.h>
+#include "simple_touch.h"
+
+#ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#endif
+
+#ifndef TOUCH_SERVICE_H
+#define TOUCH_SERVICE_H
+
+// Touch service configuration
+#define TOUCH_MAX_POINTS          5
+#define TOUCH_QUEUE_LENGTH        16
+#define TOUCH_QUEUE_RESERVE       4       // Slots MOVE events leave free
+#define TOUCH_DEBOUNCE_MS         20      // Shorter contacts are ignored
+#define TOUCH_TAP_MAX_MS          350     // Longer presses are not taps
+#define TOUCH_LONG_PRESS_MS       600     // Held this long without moving
+#define TOUCH_SLOP                12      // Pixels a tap or long press may drift
+#define TOUCH_MOVE_STEP           4       // Pixels between MOVE events
+#define TOUCH_SWIPE_MIN           80      // Pixels along the dominant axis
+#define TOUCH_SWIPE_MAX_MS        600
+#define TOUCH_RELEASE_TIMEOUT_MS  100     // No report for this long while down: read once
+#define TOUCH_POLL_MS             20      // Without an INT pin
+#define TOUCH_TASK_STACK          4096
+#define TOUCH_TASK_PRIORITY       5
+
+enum TouchEventType : uint8_t {
+  TOUCH_DOWN,              // Contact confirmed after the debounce time
+  TOUCH_MOVE,
+  TOUCH_UP,
+  TOUCH_TAP,
+  TOUCH_LONG_PRESS,        // Fires once while still held
+  TOUCH_SWIPE_LEFT,
+  TOUCH_SWIPE_RIGHT,
+  TOUCH_SWIPE_UP,
+  TOUCH_SWIPE_DOWN
+};
+
+struct TouchEvent {
+  TouchEventType type;
+  uint8_t id;              // GT911 track id, stable while the finger is down
+  uint8_t touches;         // Contacts down when the event was made
+  int16_t x, y;            // Screen position (gestures: where the contact started)
+  int16_t dx, dy;          // Offset from the down position
+  uint32_t duration_ms;    // Since the contact went down
+  uint32_t input_us;       // micros() of the INT edge behind the report
+};
+
+struct TouchStats {
+  uint32_t interrupts;     // INT edges
+  uint32_t reads;          // I2C report reads (including "no new data")
+  uint32_t reports;        // Reads that carried a new report
+  uint32_t events;
+  uint32_t dropped;        // Queue was full
+  uint32_t latency_samples; // markHandled() calls
+  uint32_t latency_last_us; // INT edge to handled
+  uint32_t latency_max_us;
+  uint64_t latency_total_us;
+};
+
+// GT911 reader running in its own FreeRTOS task
+// The task sleeps until the INT pin fires, so an untouched panel costs no
+// I2C traffic and no CPU. Each report is turned into DOWN/MOVE/UP events
+// per contact plus TAP, LONG_PRESS and SWIPE gestures, stamped with the
+// time of the INT edge and posted to a queue for the UI to poll().
+class TouchService {
+private:
+  struct Contact {
+    bool active;
+    bool confirmed;      // Past the debounce time, DOWN was posted
+    bool moved;          // Left the slop radius: no tap / long press
+    bool long_fired;
+    uint8_t id;
+    int16_t start_x, start_y;
+    int16_t x, y;
+    int16_t sent_x, sent_y;   // Position of the last DOWN/MOVE
+    uint32_t down_ms;
+    uint32_t input_us;
+  };
+  Contact contacts[TOUCH_MAX_POINTS];
+  uint8_t active_count;
+
+#ifdef ESP_PLATFORM
+  TaskHandle_t task;
+  QueueHandle_t queue;
+#else
+  TouchEvent ring[TOUCH_QUEUE_LENGTH];
+  uint8_t ring_head, ring_count;
+#endif
+  bool use_interrupt;
+  volatile uint32_t irq_us;       // Time of the latest INT edge
+  uint32_t last_report_ms;
+
+  TouchStats stats;
+
+public:
+  TouchService();
+  ~TouchService();
+
+  TouchService(const TouchService&) = delete;
+  TouchService& operator=(const TouchService&) = delete;
+
+  // Probe the controller and start the task; polls if INT can't be used
+  bool begin();
+  bool usesInterrupt() const { return use_interrupt; }
+
+  // Next event, waiting up to timeout_ms (0 = don't wait)
+  bool poll(TouchEvent* event, uint32_t timeout_ms = 0);
+
+  // Call once the UI has responded to an event (e.g. after the frame is
+  // pushed) to record input-to-response latency
+  void markHandled(const TouchEvent& event);
+
+  uint8_t getTouchCount() const { return active_count; }
+  const TouchStats& getStats() const { return stats; }
+  void resetStats() { memset(&stats, 0, sizeof(stats)); }
+  void printStats() const;
+
+private:
+  // Gesture engine: one report (points in screen coordinates) at now_ms
+  struct Point {
+    uint8_t id;
+    int16_t x, y;
+  };
+  void processReport(const Point* points, uint8_t count, uint32_t now_ms, uint32_t input_us);
+  uint32_t checkTimers(uint32_t now_ms);   // Long presses; returns ms until the next one
+  void release(Contact& c, uint32_t now_ms, uint8_t touches);
+  void post(TouchEventType type, const Contact& c, uint32_t now_ms, uint8_t touches);
+  uint8_t queueSpace() const;
+
+  bool readReport(uint32_t now_ms, uint32_t input_us);
+  uint32_t serviceOnce(bool notified);
+#ifdef ESP_PLATFORM
+  static void taskEntry(void* arg);
+  static void IRAM_ATTR onInterrupt(void* arg);
+#endif
+};
+
+#endif // TOUCH_SERVICE_H
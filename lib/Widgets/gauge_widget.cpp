@@ -0,0 +1,226 @@
+#include "gauge_widget.h"
+#include "fixed_trig.h"
+#include "esp_heap_caps.h"
+
+// Helper macros
+#ifndef max
+#define max(a,b) ((a)>(b)?(a):(b))
+#endif
+#ifndef min
+#define min(a,b) ((a)<(b)?(a):(b))
+#endif
+
+GaugeWidget::GaugeWidget() :
+    gfx(nullptr),
+    box_x(0),
+    box_y(0),
+    size(0),
+    center_x(0),
+    center_y(0),
+    radius(0),
+    band_width(0),
+    min_value(0),
+    max_value(1),
+    label(nullptr),
+    needle_color(COLOR_WHITE),
+    bg_color(COLOR_BLACK),
+    major_ticks(4),
+    antialiased(false),
+    zone_count(0),
+    face(nullptr),
+    face_valid(false),
+    needle_angle(-1),
+    needle_x1(0),
+    needle_y1(0),
+    needle_x2(-1),
+    needle_y2(-1) {
+}
+
+GaugeWidget::~GaugeWidget() {
+    heap_caps_free(face);
+}
+
+bool GaugeWidget::begin(Graphics* g, int16_t x, int16_t y, int16_t gauge_size, float min_val, float max_val,
+                        const char* name, uint16_t needle, uint16_t bg) {
+    if (!g || gauge_size < 32 || max_val <= min_val) return false;
+    if (x < 0 || y < 0 || x + gauge_size > LCD_H_RES || y + gauge_size > LCD_V_RES) return false;
+
+    gfx = g;
+    box_x = x;
+    box_y = y;
+    size = gauge_size;
+    center_x = x + size / 2;
+    center_y = y + size / 2;
+    radius = size / 2 - 5;
+    band_width = max(6, size / 14);
+    min_value = min_val;
+    max_value = max_val;
+    label = name;
+    needle_color = needle;
+    bg_color = bg;
+
+    heap_caps_free(face);
+    face = (uint16_t*)heap_caps_malloc(size * size * sizeof(uint16_t), MALLOC_CAP_SPIRAM);
+    face_valid = false;
+    needle_angle = -1;
+    return face != nullptr;
+}
+
+bool GaugeWidget::addZone(float from, float to, uint16_t color) {
+    if (zone_count >= GAUGE_MAX_ZONES) return false;
+
+    zones[zone_count++] = {from, to, color};
+    face_valid = false;
+    return true;
+}
+
+bool GaugeWidget::renderFace() {
+    if (!face) return false;
+
+    int16_t r_inner = radius - band_width;
+
+    // Background and scale ring
+    gfx->fillRect(box_x, box_y, size, size, bg_color);
+    gfx->fillArc(center_x, center_y, radius, r_inner, GAUGE_START_ANGLE, GAUGE_START_ANGLE + GAUGE_SWEEP, COLOR_DARKGRAY);
+    for (uint8_t i = 0; i < zone_count; i++) {
+        int16_t a1 = (valueToAngle(zones[i].from) + 5) / 10;
+        int16_t a2 = (valueToAngle(zones[i].to) + 5) / 10;
+        gfx->fillArc(center_x, center_y, radius, r_inner, a1, a2, zones[i].color);
+    }
+
+    // Major and minor ticks inside the ring, values next to the major ones
+    gfx->useBuiltinFont(1);
+    gfx->setTextColor(COLOR_LIGHTGRAY);
+    int16_t tick_outer = r_inner - 2;
+    int16_t major_len = band_width;
+    int16_t label_radius = tick_outer - major_len - 10;
+    float step = (max_value - min_value) / major_ticks;
+    bool whole_steps = (step == (int32_t)step) && (min_value == (int32_t)min_value);
+
+    for (uint8_t i = 0; i <= major_ticks * 2; i++) {
+        int32_t angle = GAUGE_START_ANGLE * 10 + (int32_t)i * GAUGE_SWEEP * 10 / (major_ticks * 2);
+        int16_t deg = (angle + 5) / 10;
+        bool major = !(i & 1);
+
+        if (major) {
+            gfx->fillArc(center_x, center_y, tick_outer, tick_outer - major_len, deg - 1, deg + 1, COLOR_WHITE);
+
+            char text[12];
+            float value = min_value + step * (i / 2);
+            if (whole_steps) snprintf(text, sizeof(text), "%d", (int)value);
+            else             snprintf(text, sizeof(text), "%.1f", value);
+
+            int16_t tx = center_x + ((label_radius * icos10(angle)) >> TRIG_SHIFT);
+            int16_t ty = center_y + ((label_radius * isin10(angle)) >> TRIG_SHIFT);
+            gfx->printAt(tx - strlen(text) * 3, ty - 5, text);
+        } else {
+            gfx->fillArc(center_x, center_y, tick_outer, tick_outer - major_len / 2, deg, deg + 1, COLOR_GRAY);
+        }
+    }
+
+    // Name in the open bottom of the scale
+    if (label) {
+        gfx->setTextColor(COLOR_WHITE);
+        gfx->printAt(center_x - strlen(label) * 3, center_y + radius * 2 / 3, label);
+    }
+
+    // Capture the face
+    const uint16_t* fb = gfx->getFrameBuffer();
+    for (int16_t row = 0; row < size; row++) {
+        memcpy(face + row * size, fb + (box_y + row) * LCD_H_RES + box_x, size * sizeof(uint16_t));
+    }
+    face_valid = true;
+
+    if (needle_angle >= 0) {
+        drawNeedle(needle_angle);
+    }
+    return true;
+}
+
+void GaugeWidget::draw() {
+    if (!face) return;
+    if (!face_valid) {
+        renderFace();
+        return;
+    }
+
+    gfx->drawRGB565(box_x, box_y, size, size, face);
+    if (needle_angle >= 0) {
+        drawNeedle(needle_angle);
+    }
+}
+
+void GaugeWidget::setValue(float value) {
+    if (!face_valid) return;
+
+    int32_t angle = valueToAngle(value);
+    if (angle == needle_angle) return;
+
+    // Put the face back under the old needle, then draw the new one
+    if (needle_angle >= 0) {
+        restoreFace(needle_x1, needle_y1, needle_x2, needle_y2);
+    }
+    drawNeedle(angle);
+}
+
+// Private implementation functions
+int32_t GaugeWidget::valueToAngle(float value) const {
+    float fraction = (value - min_value) / (max_value - min_value);
+    fraction = constrain(fraction, 0.0f, 1.0f);
+    return GAUGE_START_ANGLE * 10 + (int32_t)(fraction * GAUGE_SWEEP * 10 + 0.5f);
+}
+
+void GaugeWidget::drawNeedle(int32_t angle) {
+    int32_t c = icos10(angle);
+    int32_t s = isin10(angle);
+    int16_t length = radius - band_width - 6;
+    int16_t tail = size / 15;
+    int16_t hub = max(3, size / 30);
+
+    int16_t tip_x = center_x + ((length * c) >> TRIG_SHIFT);
+    int16_t tip_y = center_y + ((length * s) >> TRIG_SHIFT);
+    int16_t tail_x = center_x - ((tail * c) >> TRIG_SHIFT);
+    int16_t tail_y = center_y - ((tail * s) >> TRIG_SHIFT);
+
+    int16_t margin;
+    if (antialiased) {
+        // Ends in 1/256 pixel so the needle glides instead of stepping
+        int32_t shift = TRIG_SHIFT - 8;
+        gfx->drawLineAAFixed(center_x * 256 - ((tail * c) >> shift),
+                             center_y * 256 - ((tail * s) >> shift),
+                             center_x * 256 + ((length * c) >> shift),
+                             center_y * 256 + ((length * s) >> shift),
+                             needle_color, 3);
+        margin = 3;
+    } else {
+        // Three pixels wide: offset copies along the minor axis
+        bool steep = abs(tip_y - tail_y) > abs(tip_x - tail_x);
+        for (int8_t offset = -1; offset <= 1; offset++) {
+            int16_t ox = steep ? offset : 0;
+            int16_t oy = steep ? 0 : offset;
+            gfx->drawLine(tail_x + ox, tail_y + oy, tip_x + ox, tip_y + oy, needle_color);
+        }
+        margin = 1;
+    }
+    gfx->fillCircle(center_x, center_y, hub, needle_color);
+    gfx->fillCircle(center_x, center_y, hub / 2, bg_color);
+
+    needle_angle = angle;
+    needle_x1 = min(min(tip_x, tail_x) - margin, center_x - hub);
+    needle_y1 = min(min(tip_y, tail_y) - margin, center_y - hub);
+    needle_x2 = max(max(tip_x, tail_x) + margin, center_x + hub);
+    needle_y2 = max(max(tip_y, tail_y) + margin, center_y + hub);
+}
+
+void GaugeWidget::restoreFace(int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+    x1 = max(x1, box_x);
+    y1 = max(y1, box_y);
+    x2 = min(x2, (int16_t)(box_x + size - 1));
+    y2 = min(y2, (int16_t)(box_y + size - 1));
+    if (x1 > x2 || y1 > y2) return;
+
+    int16_t w = x2 - x1 + 1;
+    for (int16_t row = y1; row <= y2; row++) {
+        gfx->drawRGB565(x1, row, w, 1, face + (row - box_y) * size + (x1 - box_x));
+    }
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include <Arduino.h>
+#include "graphics.h"
+
+// Gauge configuration
+#define GAUGE_START_ANGLE   135    // Degrees, 0 = 3 o'clock, clockwise (bottom-left)
+#define GAUGE_SWEEP         270    // Open at the bottom
+#define GAUGE_MAX_ZONES     4
+
+// Coloured part of the scale (e.g. a red zone)
+struct GaugeZone {
+    float from;
+    float to;
+    uint16_t color;
+};
+
+// Sweep gauge with a cached face
+// The static face (track, zones, ticks, labels) is rendered once and kept
+// in a PSRAM sprite. Moving the needle restores only the face pixels under
+// the old needle's bounding box and draws the new one, so updates cost a
+// few thousand pixel copies regardless of how detailed the face is.
+class GaugeWidget {
+private:
+    Graphics* gfx;
+    int16_t box_x, box_y;
+    int16_t size;
+    int16_t center_x, center_y;
+    int16_t radius;
+    int16_t band_width;        // Width of the scale ring
+    float min_value, max_value;
+    const char* label;
+    uint16_t needle_color;
+    uint16_t bg_color;
+    uint8_t major_ticks;
+    bool antialiased;          // Needle drawn with drawLineAAFixed()
+
+    GaugeZone zones[GAUGE_MAX_ZONES];
+    uint8_t zone_count;
+
+    uint16_t* face;            // size x size sprite (PSRAM)
+    bool face_valid;
+
+    // Needle currently on screen
+    int32_t needle_angle;      // Tenths of a degree, -1 when none is drawn
+    int16_t needle_x1, needle_y1, needle_x2, needle_y2;
+
+public:
+    GaugeWidget();
+    ~GaugeWidget();
+
+    // Configure and allocate the face sprite (the gauge must lie fully on screen)
+    bool begin(Graphics* g, int16_t x, int16_t y, int16_t gauge_size, float min_val, float max_val,
+               const char* name, uint16_t needle = COLOR_WHITE, uint16_t bg = COLOR_BLACK);
+    bool isReady() const { return face != nullptr; }
+
+    // Face options (take effect at the next renderFace())
+    bool addZone(float from, float to, uint16_t color);
+    void setMajorTicks(uint8_t count) { major_ticks = count ? count : 1; face_valid = false; }
+
+    // Re-render the face on the next draw (e.g. after the colour correction changed)
+    void invalidateFace() { face_valid = false; }
+
+    // Anti-aliased needle with sub-pixel tip positions (slower per move)
+    void setAntialiased(bool enable) { antialiased = enable; }
+
+    // Draw the face at the gauge position and capture it into the sprite.
+    // Draws immediately, so call it outside beginFrame()/endFrame().
+    bool renderFace();
+
+    // Blit the cached face (and the needle) after the area was drawn over
+    void draw();
+
+    // Move the needle
+    void setValue(float value);
+
+    // Geometry
+    int16_t getX() const { return box_x; }
+    int16_t getY() const { return box_y; }
+    int16_t getSize() const { return size; }
+
+private:
+    int32_t valueToAngle(float value) const;
+    void drawNeedle(int32_t angle);
+    void restoreFace(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+};
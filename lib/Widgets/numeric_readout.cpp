@@ -0,0 +1,264 @@
+#include "numeric_readout.h"
+#include "color_blend.h"
+#include "esp_heap_caps.h"
+
+// Helper macros
+#ifndef max
+#define max(a,b) ((a)>(b)?(a):(b))
+#endif
+#ifndef min
+#define min(a,b) ((a)<(b)?(a):(b))
+#endif
+
+static const char readout_charset[] = READOUT_CHARSET;
+#define READOUT_CHARSET_SIZE (sizeof(readout_charset) - 1)
+
+// Widest advance and vertical extent of the charset glyphs in a proportional font
+template <typename Font>
+static void measureCharset(const Font* font, int16_t* advance, int16_t* top, int16_t* bottom) {
+    *advance = 0;
+    *top = 0;
+    *bottom = 0;
+    for (uint8_t i = 0; i < READOUT_CHARSET_SIZE; i++) {
+        uint8_t c = (uint8_t)readout_charset[i];
+        if (c < font->first || c > font->last) continue;
+
+        const auto* glyph = &font->glyph[c - font->first];
+        *advance = max(*advance, (int16_t)glyph->xAdvance);
+        if (glyph->height == 0) continue;
+        *top = min(*top, (int16_t)glyph->yOffset);
+        *bottom = max(*bottom, (int16_t)(glyph->yOffset + glyph->height));
+    }
+}
+
+NumericReadout::NumericReadout() :
+    gfx(nullptr),
+    box_x(0),
+    box_y(0),
+    cell_w(0),
+    cell_h(0),
+    cell_count(0),
+    align(READOUT_ALIGN_RIGHT),
+    fg_color(COLOR_WHITE),
+    bg_color(COLOR_BLACK),
+    gfx_font(nullptr),
+    aa_font(nullptr),
+    builtin_scale(1),
+    origin_y(0),
+    cells(nullptr),
+    cells_generation(0),
+    shown_valid(false),
+    updates(0),
+    cells_drawn(0) {
+    shown[0] = '\0';
+}
+
+NumericReadout::~NumericReadout() {
+    heap_caps_free(cells);
+}
+
+bool NumericReadout::begin(Graphics* g, int16_t x, int16_t y, uint8_t count, uint16_t fg, uint16_t bg,
+                           ReadoutAlign alignment) {
+    if (!g || !g->getFontManager() || count == 0) return false;
+
+    gfx = g;
+    cell_count = min(count, (uint8_t)READOUT_MAX_CELLS);
+    align = alignment;
+    fg_color = fg;
+    bg_color = bg;
+
+    // Capture the current font and size the cells to fit every charset glyph
+    FontManager* fm = gfx->getFontManager();
+    gfx_font = fm->getCurrentGFXFont();
+    aa_font = fm->getCurrentAAFont();
+    builtin_scale = fm->getBuiltinScale();
+
+    int16_t advance, top, bottom;
+    if (aa_font) {
+        measureCharset(aa_font, &advance, &top, &bottom);
+    } else if (gfx_font) {
+        measureCharset(gfx_font, &advance, &top, &bottom);
+    } else {
+        // Built-in cursor is the top-left of a 6x10 cell
+        advance = 6 * builtin_scale;
+        top = 0;
+        bottom = 10 * builtin_scale;
+    }
+
+    cell_w = advance;
+    cell_h = bottom - top;
+    origin_y = -top;
+    box_x = x;
+    box_y = y + top;
+    if (cell_w <= 0 || cell_h <= 0) return false;
+
+    heap_caps_free(cells);
+    cells = (uint16_t*)heap_caps_malloc(READOUT_CHARSET_SIZE * cell_w * cell_h * sizeof(uint16_t),
+                                        MALLOC_CAP_SPIRAM);
+    if (!cells) return false;
+
+    renderCells();
+    return true;
+}
+
+void NumericReadout::setPosition(int16_t x, int16_t y) {
+    box_x = x;
+    box_y = y - origin_y;
+    shown_valid = false;
+}
+
+void NumericReadout::setColors(uint16_t fg, uint16_t bg) {
+    if (fg == fg_color && bg == bg_color) return;
+
+    fg_color = fg;
+    bg_color = bg;
+    if (cells) renderCells();
+}
+
+void NumericReadout::setText(const char* text) {
+    if (!cells || !text) return;
+    if (gfx->getCorrectionGeneration() != cells_generation) renderCells();
+
+    char next[READOUT_MAX_CELLS + 1];
+    layoutText(text, next);
+
+    // Copy only the cells whose character changed
+    uint32_t cell_pixels = cell_w * cell_h;
+    for (uint8_t i = 0; i < cell_count; i++) {
+        if (shown_valid && next[i] == shown[i]) continue;
+
+        const uint16_t* cell = cells + cellIndex(next[i]) * cell_pixels;
+        gfx->drawRGB565(box_x + i * cell_w, box_y, cell_w, cell_h, cell);
+        cells_drawn++;
+    }
+
+    memcpy(shown, next, sizeof(shown));
+    shown_valid = true;
+    updates++;
+}
+
+void NumericReadout::setValue(int value) {
+    char text[16];
+    snprintf(text, sizeof(text), "%d", value);
+    setText(text);
+}
+
+void NumericReadout::setValue(float value, uint8_t decimals) {
+    char text[24];
+    // Drop decimals (rounded) before the value would overflow
+    int len = snprintf(text, sizeof(text), "%.*f", decimals, value);
+    while (len > cell_count && decimals > 0) {
+        decimals--;
+        len = snprintf(text, sizeof(text), "%.*f", decimals, value);
+    }
+    setText(text);
+}
+
+// Private implementation functions
+// Cells are blitted raw, so they hold the colours as drawn (corrected)
+void NumericReadout::renderCells() {
+    uint16_t fg = gfx->getDrawColor(fg_color);
+    uint16_t bg = gfx->getDrawColor(bg_color);
+    cells_generation = gfx->getCorrectionGeneration();
+
+    uint32_t cell_pixels = cell_w * cell_h;
+    for (uint8_t i = 0; i < READOUT_CHARSET_SIZE; i++) {
+        renderCell(cells + i * cell_pixels, readout_charset[i], fg, bg);
+    }
+    shown_valid = false;
+}
+
+void NumericReadout::renderCell(uint16_t* cell, char c, uint16_t fg, uint16_t bg) {
+    uint32_t cell_pixels = cell_w * cell_h;
+    for (uint32_t i = 0; i < cell_pixels; i++) {
+        cell[i] = bg;
+    }
+    if (c == ' ') return;
+
+    uint8_t code = (uint8_t)c;
+
+    if (aa_font) {
+        if (code < aa_font->first || code > aa_font->last) return;
+
+        // 4-bpp coverage, blended against the cell background
+        const AAGlyph* glyph = &aa_font->glyph[code - aa_font->first];
+        const uint8_t* bitmap = aa_font->bitmap + glyph->bitmapOffset;
+        uint16_t row_bytes = (glyph->width + 1) / 2;
+        int16_t gx = (cell_w - glyph->xAdvance) / 2 + glyph->xOffset;
+        int16_t gy = origin_y + glyph->yOffset;
+
+        for (int16_t yy = 0; yy < glyph->height; yy++) {
+            int16_t py = gy + yy;
+            if (py < 0 || py >= cell_h) continue;
+            for (int16_t xx = 0; xx < glyph->width; xx++) {
+                int16_t px = gx + xx;
+                if (px < 0 || px >= cell_w) continue;
+                uint8_t cov = (bitmap[yy * row_bytes + (xx >> 1)] >> ((xx & 1) ? 0 : 4)) & 0x0F;
+                if (cov) cell[py * cell_w + px] = blendRGB565_4bit(fg, bg, cov);
+            }
+        }
+    } else if (gfx_font) {
+        if (code < gfx_font->first || code > gfx_font->last) return;
+
+        // 1-bpp rows packed MSB first, continuous across rows
+        const GFXglyph* glyph = &gfx_font->glyph[code - gfx_font->first];
+        const uint8_t* bitmap = gfx_font->bitmap + glyph->bitmapOffset;
+        int16_t gx = (cell_w - glyph->xAdvance) / 2 + glyph->xOffset;
+        int16_t gy = origin_y + glyph->yOffset;
+        uint8_t bits = 0;
+        uint16_t bit = 0;
+
+        for (int16_t yy = 0; yy < glyph->height; yy++) {
+            for (int16_t xx = 0; xx < glyph->width; xx++) {
+                if (!(bit++ & 7)) bits = *bitmap++;
+                bool set = bits & 0x80;
+                bits <<= 1;
+
+                int16_t px = gx + xx;
+                int16_t py = gy + yy;
+                if (set && px >= 0 && px < cell_w && py >= 0 && py < cell_h) {
+                    cell[py * cell_w + px] = fg;
+                }
+            }
+        }
+    } else {
+        if (code < 32 || code > 126) return;
+
+        // 5x8 column font, one row of padding above (matches drawCharBuiltin)
+        const uint8_t* columns = builtin_font_5x8[code - 32];
+        uint8_t s = builtin_scale;
+
+        for (uint8_t col = 0; col < 5; col++) {
+            for (uint8_t row = 0; row < 8; row++) {
+                if (!(columns[col] & (1 << row))) continue;
+                for (uint8_t sy = 0; sy < s; sy++) {
+                    int16_t py = origin_y + s + row * s + sy;
+                    if (py >= cell_h) continue;
+                    for (uint8_t sx = 0; sx < s; sx++) {
+                        cell[py * cell_w + col * s + sx] = fg;
+                    }
+                }
+            }
+        }
+    }
+}
+
+int8_t NumericReadout::cellIndex(char c) const {
+    const char* p = (c != '\0') ? strchr(readout_charset, c) : nullptr;
+    return p ? (int8_t)(p - readout_charset) : 0;
+}
+
+// Text that doesn't fit shows as dashes rather than a cut-off (wrong) number
+void NumericReadout::layoutText(const char* text, char* out) const {
+    size_t len = strlen(text);
+    if (len > cell_count) {
+        memset(out, '-', cell_count);
+        out[cell_count] = '\0';
+        return;
+    }
+    size_t pad = cell_count - len;
+
+    memset(out, ' ', cell_count);
+    memcpy(out + (align == READOUT_ALIGN_RIGHT ? pad : 0), text, len);
+    out[cell_count] = '\0';
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include <Arduino.h>
+#include "graphics.h"
+
+// Readout configuration
+#define READOUT_MAX_CELLS   12
+#define READOUT_CHARSET     " 0123456789.-+"   // Anything else is drawn as a blank cell
+
+enum ReadoutAlign {
+    READOUT_ALIGN_LEFT,
+    READOUT_ALIGN_RIGHT
+};
+
+// Fixed-width numeric readout
+// Every character of the charset is rendered once into an RGB565 cell for
+// the readout's font and colours. Updates compare the new string against
+// the one on screen and copy only the cells that changed, so the value can
+// refresh at a high rate without redrawing the rest of the screen. Cells
+// hold corrected colours and are re-rendered when the correction changes.
+class NumericReadout {
+private:
+    Graphics* gfx;
+    int16_t box_x, box_y;         // Top-left of the first cell on screen
+    int16_t cell_w, cell_h;
+    uint8_t cell_count;
+    ReadoutAlign align;
+    uint16_t fg_color, bg_color;
+
+    // Font captured at begin()
+    const GFXfont* gfx_font;
+    const AAFont* aa_font;
+    uint8_t builtin_scale;
+    int16_t origin_y;             // Cursor y inside a cell
+
+    uint16_t* cells;              // One cell image per charset character (PSRAM)
+    uint32_t cells_generation;    // Colour correction the cells were rendered with
+    char shown[READOUT_MAX_CELLS + 1];
+    bool shown_valid;
+
+    // Statistics
+    uint32_t updates;
+    uint32_t cells_drawn;
+
+public:
+    NumericReadout();
+    ~NumericReadout();
+
+    // Uses the font currently selected on gfx; x/y is the printAt() cursor position
+    bool begin(Graphics* g, int16_t x, int16_t y, uint8_t cells, uint16_t fg, uint16_t bg,
+               ReadoutAlign alignment = READOUT_ALIGN_RIGHT);
+    bool isReady() const { return cells != nullptr; }
+
+    // Move the readout (x/y as for begin(); the next update redraws everything)
+    void setPosition(int16_t x, int16_t y);
+
+    // Re-render the cells (the next update redraws everything)
+    void setColors(uint16_t fg, uint16_t bg);
+
+    // Update the displayed value. Text longer than the cell count is shown
+    // as all dashes; setValue(float) first drops decimals to make it fit.
+    void setText(const char* text);
+    void setValue(int value);
+    void setValue(float value, uint8_t decimals = 1);
+
+    // Forget what is on screen (call after the area was drawn over)
+    void invalidate() { shown_valid = false; }
+
+    // Geometry
+    int16_t getX() const { return box_x; }
+    int16_t getY() const { return box_y; }
+    int16_t getWidth() const { return cell_w * cell_count; }
+    int16_t getHeight() const { return cell_h; }
+
+    // Statistics
+    uint32_t getUpdates() const { return updates; }
+    uint32_t getCellsDrawn() const { return cells_drawn; }
+
+private:
+    void renderCells();
+    void renderCell(uint16_t* cell, char c, uint16_t fg, uint16_t bg);
+    int8_t cellIndex(char c) const;
+    void layoutText(const char* text, char* out) const;
+};
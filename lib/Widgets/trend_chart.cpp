@@ -0,0 +1,229 @@
+#include "trend_chart.h"
+#include "esp_heap_caps.h"
+
+// Helper macros
+#ifndef max
+#define max(a,b) ((a)>(b)?(a):(b))
+#endif
+#ifndef min
+#define min(a,b) ((a)<(b)?(a):(b))
+#endif
+
+TrendSeries::TrendSeries() :
+    samples(nullptr),
+    capacity(0),
+    head(0),
+    count(0) {
+}
+
+TrendSeries::~TrendSeries() {
+    heap_caps_free(samples);
+}
+
+bool TrendSeries::begin(uint16_t sample_capacity) {
+    if (!sample_capacity) return false;
+    heap_caps_free(samples);
+    samples = (TrendSample*)heap_caps_malloc(sample_capacity * sizeof(TrendSample), MALLOC_CAP_SPIRAM);
+    capacity = samples ? sample_capacity : 0;
+    head = count = 0;
+    return samples != nullptr;
+}
+
+void TrendSeries::add(uint32_t time_ms, float value) {
+    if (!samples) return;
+    samples[head].time_ms = time_ms;
+    samples[head].value = value;
+    head = (head + 1) % capacity;
+    if (count < capacity) count++;
+}
+
+uint16_t TrendSeries::lowerBound(uint32_t time_ms) const {
+    uint16_t lo = 0, hi = count;
+    while (lo < hi) {
+        uint16_t mid = (lo + hi) / 2;
+        if (get(mid).time_ms < time_ms) lo = mid + 1;
+        else                            hi = mid;
+    }
+    return lo;
+}
+
+TrendChart::TrendChart() :
+    gfx(nullptr),
+    series(nullptr),
+    box_x(0),
+    box_y(0),
+    box_w(0),
+    box_h(0),
+    plot_x(0),
+    plot_y(0),
+    plot_w(0),
+    plot_h(0),
+    min_value(0),
+    max_value(1),
+    column_ms(1),
+    label(nullptr),
+    line_color(COLOR_GREEN),
+    bg_color(COLOR_BLACK),
+    marker_count(0),
+    head_bucket(0),
+    plot_valid(false),
+    columns_drawn(0),
+    scrolls(0) {
+}
+
+bool TrendChart::begin(Graphics* g, int16_t x, int16_t y, int16_t w, int16_t h, const TrendSeries* source,
+                       float min_val, float max_val, uint32_t window, const char* name,
+                       uint16_t color, uint16_t bg) {
+    if (!g || !source || w < 16 || h < TREND_TITLE_H + 8 || max_val <= min_val) return false;
+    if (x < 0 || y < 0 || x + w > LCD_H_RES || y + h > LCD_V_RES) return false;
+
+    gfx = g;
+    series = source;
+    box_x = x;
+    box_y = y;
+    box_w = w;
+    box_h = h;
+    plot_x = x + 1;
+    plot_y = y + TREND_TITLE_H;
+    plot_w = w - 2;
+    plot_h = h - TREND_TITLE_H - 1;
+    min_value = min_val;
+    max_value = max_val;
+    column_ms = max(window / plot_w, (uint32_t)1);
+    label = name;
+    line_color = color;
+    bg_color = bg;
+    plot_valid = false;
+    return true;
+}
+
+bool TrendChart::addMarker(float value, uint16_t color) {
+    if (marker_count >= TREND_MAX_MARKERS) return false;
+    markers[marker_count++] = {value, color};
+    plot_valid = false;
+    return true;
+}
+
+void TrendChart::draw(uint32_t now_ms) {
+    if (!series) return;
+
+    // Frame and title row: name on the left, scale on the right
+    gfx->fillRect(box_x, box_y, box_w, TREND_TITLE_H, bg_color);
+    gfx->drawRect(box_x, box_y + TREND_TITLE_H - 1, box_w, box_h - TREND_TITLE_H + 1, COLOR_GRAY);
+    gfx->useBuiltinFont(1);
+    if (label) {
+        gfx->setTextColor(line_color);
+        gfx->printAt(box_x + 2, box_y + 2, label);
+    }
+    char scale[24];
+    snprintf(scale, sizeof(scale), "%g..%g", min_value, max_value);
+    gfx->setTextColor(COLOR_GRAY);
+    gfx->printAt(box_x + box_w - 2 - strlen(scale) * 6, box_y + 2, scale);
+
+    head_bucket = now_ms / column_ms;
+    drawPlot();
+    plot_valid = true;
+}
+
+void TrendChart::update(uint32_t now_ms) {
+    if (!series) return;
+    if (!plot_valid) {
+        draw(now_ms);
+        return;
+    }
+
+    uint32_t bucket = now_ms / column_ms;
+    uint32_t shift = bucket - head_bucket;
+    if (shift >= (uint32_t)plot_w) {
+        head_bucket = bucket;
+        drawPlot();
+        return;
+    }
+
+    // The old rightmost bucket may have had samples since it was drawn
+    uint32_t first = head_bucket;
+    if (shift) {
+        scroll(shift);
+        head_bucket = bucket;
+    }
+    drawColumns(first, head_bucket);
+}
+
+void TrendChart::drawPlot() {
+    // Shortly after boot the left of the plot is before time zero
+    uint32_t first = head_bucket >= (uint32_t)(plot_w - 1) ? head_bucket - (plot_w - 1) : 0;
+    gfx->fillRect(plot_x, plot_y, plot_w, plot_h, bg_color);
+    drawColumns(first, head_bucket);
+}
+
+// One pass over the samples in the buckets' time range
+void TrendChart::drawColumns(uint32_t first_bucket, uint32_t last_bucket) {
+    uint32_t start = first_bucket * column_ms;
+    uint16_t count = series->getCount();
+    uint16_t i = series->lowerBound(start);
+
+    // Last sample before the range, to join the line up and hold through quiet buckets
+    bool has_prev = i > 0;
+    TrendSample prev = has_prev ? series->get(i - 1) : TrendSample{0, 0.0f};
+
+    for (uint32_t b = first_bucket; b != last_bucket + 1; b++) {
+        uint32_t bucket_start = b * column_ms;
+        uint32_t bucket_end = bucket_start + column_ms;
+        bool any = false;
+        float lo = 0, hi = 0;
+        TrendSample last = prev;
+        while (i < count && series->get(i).time_ms < bucket_end) {
+            last = series->get(i++);
+            if (!any || last.value < lo) lo = last.value;
+            if (!any || last.value > hi) hi = last.value;
+            any = true;
+        }
+
+        bool joined = has_prev && bucket_start - prev.time_ms <= TREND_GAP_MS;
+        if (joined) {
+            lo = any ? min(lo, prev.value) : prev.value;
+            hi = any ? max(hi, prev.value) : prev.value;
+        }
+        drawColumn(b, any || joined, lo, hi);
+
+        if (any) {
+            prev = last;
+            has_prev = true;
+        }
+    }
+}
+
+void TrendChart::drawColumn(uint32_t bucket, bool has_span, float lo, float hi) {
+    uint32_t age = head_bucket - bucket;
+    if (age >= (uint32_t)plot_w) return;
+    int16_t x = plot_x + plot_w - 1 - (int16_t)age;
+
+    gfx->drawFastVLine(x, plot_y, plot_h, bg_color);
+    for (uint8_t m = 0; m < marker_count; m++) {
+        if (bucket & 1) gfx->drawPixel(x, valueToY(markers[m].value), markers[m].color);   // Dotted, scrolls along
+    }
+    if (has_span) {
+        int16_t y_top = valueToY(hi);
+        int16_t y_bottom = valueToY(lo);
+        gfx->drawFastVLine(x, y_top, y_bottom - y_top + 1, line_color);
+    }
+    columns_drawn++;
+}
+
+// Move the plot left in the frame buffer; the vacated columns are drawn next
+void TrendChart::scroll(int16_t columns) {
+    uint16_t* fb = gfx->getFrameBuffer();
+    int16_t keep = plot_w - columns;
+    for (int16_t row = 0; row < plot_h; row++) {
+        uint16_t* line = fb + (plot_y + row) * LCD_H_RES + plot_x;
+        memmove(line, line + columns, keep * sizeof(uint16_t));
+    }
+    gfx->markUntracked(plot_x, plot_y, keep, plot_h);
+    scrolls++;
+}
+
+int16_t TrendChart::valueToY(float value) const {
+    float fraction = (value - min_value) / (max_value - min_value);
+    fraction = constrain(fraction, 0.0f, 1.0f);
+    return plot_y + plot_h - 1 - (int16_t)(fraction * (plot_h - 1) + 0.5f);
+}
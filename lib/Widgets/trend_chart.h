@@ -0,0 +1,115 @@
+#pragma once
+#include <Arduino.h>
+#include "graphics.h"
+
+// Trend chart configuration
+#define TREND_MAX_MARKERS   2
+#define TREND_GAP_MS        10000   // Longer without samples shows as a gap
+#define TREND_TITLE_H       12      // Title row above the plot
+
+struct TrendSample {
+    uint32_t time_ms;
+    float value;
+};
+
+// Recent samples of one channel, oldest overwritten first
+// Samples must arrive in time order (they are searched by time).
+class TrendSeries {
+private:
+    TrendSample* samples;      // Ring (PSRAM)
+    uint16_t capacity;
+    uint16_t head;             // Next slot written
+    uint16_t count;
+
+public:
+    TrendSeries();
+    ~TrendSeries();
+
+    TrendSeries(const TrendSeries&) = delete;
+    TrendSeries& operator=(const TrendSeries&) = delete;
+
+    bool begin(uint16_t sample_capacity);
+    void clear() { head = count = 0; }
+    void add(uint32_t time_ms, float value);
+
+    // 0 is the oldest sample held
+    uint16_t getCount() const { return count; }
+    const TrendSample& get(uint16_t i) const {
+        return samples[(head + capacity - count + i) % capacity];
+    }
+
+    // Index of the first sample at or after time_ms (getCount() if none)
+    uint16_t lowerBound(uint32_t time_ms) const;
+};
+
+// Horizontal reference line (e.g. a warning threshold)
+struct TrendMarker {
+    float value;
+    uint16_t color;
+};
+
+// Strip chart of a TrendSeries
+// Each pixel column is a time bucket drawn as a vertical span from the
+// bucket's minimum to its maximum, so spikes survive any amount of
+// decimation. When time moves on by whole columns, update() shifts the
+// plot left in the frame buffer and draws only the new columns plus the
+// still-open rightmost one; the series is only searched for those buckets.
+class TrendChart {
+private:
+    Graphics* gfx;
+    const TrendSeries* series;
+    int16_t box_x, box_y, box_w, box_h;
+    int16_t plot_x, plot_y, plot_w, plot_h;
+    float min_value, max_value;
+    uint32_t column_ms;        // Time per pixel column
+    const char* label;
+    uint16_t line_color;
+    uint16_t bg_color;
+
+    TrendMarker markers[TREND_MAX_MARKERS];
+    uint8_t marker_count;
+
+    uint32_t head_bucket;      // Bucket in the rightmost column
+    bool plot_valid;
+
+    // Statistics
+    uint32_t columns_drawn;
+    uint32_t scrolls;
+
+public:
+    TrendChart();
+
+    // window_ms is the time across the plot; the chart must lie fully on screen
+    bool begin(Graphics* g, int16_t x, int16_t y, int16_t w, int16_t h, const TrendSeries* source,
+               float min_val, float max_val, uint32_t window, const char* name,
+               uint16_t color = COLOR_GREEN, uint16_t bg = COLOR_BLACK);
+    bool isReady() const { return series != nullptr; }
+
+    bool addMarker(float value, uint16_t color);
+
+    // Frame, title and the whole plot (after the area was drawn over)
+    void draw(uint32_t now_ms);
+
+    // Scroll to now_ms and draw the new columns
+    void update(uint32_t now_ms);
+
+    // The next update() redraws everything
+    void invalidate() { plot_valid = false; }
+
+    // Geometry
+    int16_t getX() const { return box_x; }
+    int16_t getY() const { return box_y; }
+    int16_t getWidth() const { return box_w; }
+    int16_t getHeight() const { return box_h; }
+
+    // Statistics
+    uint32_t getColumnsDrawn() const { return columns_drawn; }
+    uint32_t getScrolls() const { return scrolls; }
+
+private:
+    void drawPlot();
+    void drawColumns(uint32_t first_bucket, uint32_t last_bucket);
+    void drawColumn(uint32_t bucket, bool has_span, float lo, float hi);
+    void scroll(int16_t columns);
+    int16_t valueToY(float value) const;
+};
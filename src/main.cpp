@@ -1,17 +1,35 @@
 // ====== MAIN.CPP - Integrated OBD + Display System ======
 
 #include <Arduino.h>
-#include "simple_touch.h"
+#include "touch_service.h"
+#include "hit_test.h"
 #include "display_controller.h"
 #include "graphics.h"
 #include "font_manager.h"
 #include "ford_obd.h"
-#include "image.h"
+#include "asset_bundle.h"
+#include "asset_ids.h"
+#include "numeric_readout.h"
+#include "gauge_widget.h"
+#include "trend_chart.h"
+#include "compositor.h"
+#include "color_profile.h"
+#include "perf_monitor.h"
+#include "trace.h"
+#include "telemetry_logger.h"
+#include "channel_stats.h"
+#include "derived_channels.h"
+#ifdef GFX_BENCHMARK
+#include "gfx_benchmark.h"
+#endif
 
 // System components
 DisplayController display;
 Graphics gfx;
 FontManager fontManager;
+AssetBundle assets;
+ColorProfileManager displayProfile;
+TouchService touchService;
 
 // Dashboard state
 struct DashboardData
@@ -41,14 +59,114 @@ enum DisplayMode
 
 DisplayMode currentMode = MODE_DASHBOARD;
 
+// Sweep gauges (face cached, only the needle moves)
+GaugeWidget oilGauge;
+GaugeWidget coolantGauge;
+GaugeWidget batteryGauge;
+
+// Static layout is redrawn only when this is set or the mode changes
+bool layoutDirty = true;
+
+// Set while a day/night transition changes colours; the layout and the
+// cached gauge faces follow at COLOR_REFRESH_MS and once more at the end
+bool colorsPending = false;
+#define COLOR_REFRESH_MS 250      // About 8 full redraws per 2 s transition
+
+// Night hours follow the wall clock once something has set it (SNTP or
+// settimeofday); until then the toggle on the settings screen decides
+#define CLOCK_VALID_AFTER 1704067200   // 2024-01-01: earlier means never set
+#define CLOCK_CHECK_MS    10000
+bool nightManual = false;         // The toggle overrides the clock until reboot
+
+// Buttons on the current screen, registered as the layout is drawn
+HitTestIndex hitTargets;
+#define DRIVING_SPEED 5   // km/h; touch targets grow above this
+
+// Live values (only changed digit cells are redrawn)
+NumericReadout oilGaugeReadout;
+NumericReadout coolantGaugeReadout;
+NumericReadout batteryGaugeReadout;
+NumericReadout coolantReadout;
+NumericReadout speedReadout;
+NumericReadout boostReadout;
+NumericReadout detailReadouts[5];
+NumericReadout lastUpdateReadout;
+
+// Trend charts on the detailed view; the histories fill in every mode
+#define TREND_WINDOW_MS (5 * 60 * 1000UL)
+#define TREND_HISTORY 1024   // Samples per channel (PSRAM)
+TrendSeries oilHistory;
+TrendSeries boostHistory;
+TrendChart oilChart;
+TrendChart boostChart;
+
+// Warning overlays (blended over the dashboard, restored when hidden)
+#define OIL_WARNING_TEMP 110
+Compositor compositor;
+Surface oilWarningSurface;
+int8_t oilWarningLayer = -1;
+
+// Instrumentation: long-press anywhere toggles the HUD. Serial console:
+// 'p' prints a report, 'h' toggles the HUD, 't' starts/stops a trace and
+// 'd' dumps it as Chrome trace-event JSON.
+PerfMonitor perf;
+int8_t perfLayout = -1;
+int8_t perfValues = -1;
+int8_t perfPush = -1;
+int8_t perfOBD = -1;
+int8_t perfRTT = -1;
+int8_t perfPIDs[TOTAL_PIDS];
+
+// Every decoded sample goes to the flash telemetry ring, by PID number.
+// Serial console: 'l' dumps it for tools/tlog2csv.py, 'E' erases it.
+TelemetryLogger telemetry;
+uint16_t telemetryChannels[TOTAL_PIDS];
+
+// Running statistics of the same samples (session and 5-minute window),
+// printed with 'p' and shown on the detailed view
+StatsEngine channelStats;
+#define OIL_CHANNEL 0x5C
+NumericReadout statReadouts[5];
+
+// Channels computed from the PIDs, logged and tracked like them
+#define SPEED_CHANNEL      0x0D
+#define MAP_CHANNEL        0x0B
+#define MAF_CHANNEL        0x10
+#define BARO_CHANNEL       0x33
+#define BOOST_CHANNEL      (DERIVED_CHANNEL_BASE + 0)
+#define FUEL_FLOW_CHANNEL  (DERIVED_CHANNEL_BASE + 1)
+#define ECONOMY_CHANNEL    (DERIVED_CHANNEL_BASE + 2)
+#define POWER_CHANNEL      (DERIVED_CHANNEL_BASE + 3)
+#define STANDARD_BARO      101.3f   // kPa, until the ECU reports baro
+#define STOICH_AFR         14.7f    // Closed loop petrol
+#define FUEL_DENSITY       745.0f   // g/L
+#define FUEL_ENERGY        43.0f    // kJ/g (lower heating value)
+#define BRAKE_EFFICIENCY   0.30f    // Fuel energy reaching the crank
+#define ECONOMY_MIN_SPEED  5.0f     // km/h; L/100 km is meaningless below
+DerivedChannels derived;
+
 // Function prototypes
 void updateDisplay();
 void drawDashboard();
 void drawDetailedView();
 void drawSettingsView();
-void handleTouch(int x, int y);
+void updateDashboardValues();
+void updateDetailedValues();
+void setupWidgets();
+void setupPerf();
+void setupTelemetry();
+void setupDerived();
+void updateBoost(float boost);
+void invalidateReadouts();
+void switchMode(int8_t id, void* arg);
+void toggleNightMode(int8_t id, void* arg);
+void drawNightToggle();
 void updateOBDData();
-void drawGauge(int x, int y, int size, const char *label, float value, const char *units, float minVal, float maxVal, uint16_t color);
+void drawDashboardWidgets();
+void drawDetailedWidgets();
+void renderOilWarning();
+void refreshCorrectedColors();
+void updateProfileClock();
 
 void setup()
 {
@@ -70,19 +188,59 @@ void setup()
         return;
     }
 
-    // Initialize touch
-    touch_init();
+    // Colours are corrected as they are drawn through one 64K-entry table;
+    // the day/night profiles blend over a couple of seconds
+    if (!gfx.getColorCorrection().enableDirectLUT())
+    {
+        Serial.println("⚠️ Colour LUT unavailable - night profile without saturation");
+    }
+    gfx.setColorCorrectionMode(CORRECTION_AT_DRAW);
+    displayProfile.begin(&gfx.getColorCorrection());
+
+    // Images and fonts from the flash asset bundle (tools/build_assets.py)
+    if (assets.begin(ASSET_PARTITION_LABEL, ASSET_BUNDLE_CHECKSUM))
+    {
+        gfx.setAssetBundle(&assets);
+    }
+    else
+    {
+        Serial.println("⚠️ Asset bundle unavailable - logo not shown");
+    }
+
+    // Render dashboard frames through the tile renderer (only changed tiles reach PSRAM)
+    if (!gfx.enableTiledRendering(true))
+    {
+        Serial.println("⚠️ Tiled rendering unavailable - drawing directly");
+    }
+
+#ifdef GFX_BENCHMARK
+    runGfxBenchmarks(gfx);
+#endif
+
+    setupWidgets();
+    setupPerf();
+    setupTelemetry();
+    setupDerived();
+
+    // Initialize touch (reads run in their own task, woken by INT)
+    if (!touchService.begin())
+    {
+        Serial.println("⚠️ Touch unavailable");
+    }
 
     // Show startup screen
     gfx.fillScreen(COLOR_BLACK);
-    gfx.useFreeSans18pt7b();
+    if (!gfx.useFontAsset(ASSET_FONT_TITLE))
+    {
+        gfx.useFreeSans18pt7b();
+    }
     gfx.setTextColor(COLOR_CYAN);
     gfx.printAt(75, 35, "Ford Fiesta ST Dashboard");
     gfx.setTextColor(COLOR_WHITE);
     gfx.useFreeSans9pt();
 
     gfx.printAt(75, 125, "powered by");
-    gfx.drawImage(75, 142, logo_image);
+    gfx.drawAsset(75, 142, ASSET_LOGO);
     display.updateDisplay();
     delay(3000);
     
@@ -101,26 +259,105 @@ void setup()
 
 void loop()
 {
+    perf.loopStart();
+
     // Update OBD system
-    fordOBD.update();
+    {
+        PERF_SCOPE(perf, perfOBD);
+        TRACE_SCOPE("obd update");
+        fordOBD.update();
+    }
 
     // Update our dashboard data
     updateOBDData();
 
-    // Handle touch input
-    if (touch_touched())
+    // Day/night transition: readouts re-render their cells as each LUT step
+    // lands; the rest is redrawn at a throttled rate and after the last step
+    updateProfileClock();
+    if (displayProfile.update(millis()))
+    {
+        colorsPending = true;
+    }
+    static unsigned long lastColorRefresh = 0;
+    if (colorsPending &&
+        (!displayProfile.isTransitioning() || millis() - lastColorRefresh >= COLOR_REFRESH_MS))
+    {
+        colorsPending = false;
+        lastColorRefresh = millis();
+        refreshCorrectedColors();
+    }
+
+    // Handle touch input: buttons act on taps, once per press. Larger
+    // touch areas while driving; misses don't redraw anything.
+    hitTargets.setExtraMargin(dashData.speed > DRIVING_SPEED ? HIT_DRIVING_MARGIN : 0);
+    TouchEvent touch;
+    while (touchService.poll(&touch))
     {
-        handleTouch(touch_last_x, touch_last_y);
+        if (touch.type == TOUCH_TAP && hitTargets.dispatch(touch.x, touch.y))
+        {
+            updateDisplay();
+            touchService.markHandled(touch);
+        }
+        else if (touch.type == TOUCH_LONG_PRESS)
+        {
+            perf.toggleHud();
+        }
     }
 
-    // Update display every 500ms
+    // Serial console
+    if (Serial.available())
+    {
+        char cmd = Serial.read();
+        if (cmd == 'p')
+        {
+            perf.printReport();
+            touchService.printStats();
+            telemetry.printStats();
+            channelStats.printStats();
+            derived.printStats();
+        }
+        else if (cmd == 'h')
+        {
+            perf.toggleHud();
+        }
+        else if (cmd == 't')
+        {
+            if (tracer.isEnabled())
+            {
+                tracer.stop();
+                Serial.printf("Trace stopped: %lu events\n", (unsigned long)tracer.getEventCount());
+            }
+            else
+            {
+                tracer.clear();
+                tracer.start();
+                Serial.println("Trace started");
+            }
+        }
+        else if (cmd == 'd')
+        {
+            tracer.dump(Serial);
+        }
+        else if (cmd == 'l')
+        {
+            telemetry.dump(Serial);
+        }
+        else if (cmd == 'E')
+        {
+            Serial.println(telemetry.erase() ? "Telemetry log erased" : "Telemetry erase failed");
+        }
+    }
+
+    // Update display every 100ms (static layout is only redrawn on change)
     static unsigned long lastDisplayUpdate = 0;
-    if (millis() - lastDisplayUpdate > 500)
+    if (millis() - lastDisplayUpdate > 100)
     {
         updateDisplay();
         lastDisplayUpdate = millis();
     }
 
+    perf.update(millis());
+    perf.loopEnd();
     delay(10);
 }
 
@@ -140,19 +377,313 @@ void updateOBDData()
 
 void updateDisplay()
 {
-    switch (currentMode)
+    static DisplayMode drawnMode = MODE_DASHBOARD;
+    static bool drawnDataValid = false;
+
+    // Static layout: only when the mode or connection state changed
+    if (layoutDirty || currentMode != drawnMode || dashData.dataValid != drawnDataValid)
     {
-    case MODE_DASHBOARD:
-        drawDashboard();
-        break;
-    case MODE_DETAILED:
-        drawDetailedView();
-        break;
-    case MODE_SETTINGS:
-        drawSettingsView();
-        break;
+        PERF_SCOPE(perf, perfLayout);
+        TRACE_SCOPE("layout");
+        compositor.hide(oilWarningLayer);
+        perf.hideHud();
+        hitTargets.clear();
+        gfx.beginFrame();
+        switch (currentMode)
+        {
+        case MODE_DASHBOARD:
+            drawDashboard();
+            break;
+        case MODE_DETAILED:
+            drawDetailedView();
+            break;
+        case MODE_SETTINGS:
+            drawSettingsView();
+            break;
+        }
+        gfx.endFrame();
+
+        // Cached widgets draw immediately, on top of the finished layout
+        if (currentMode == MODE_DASHBOARD)
+        {
+            drawDashboardWidgets();
+        }
+        else if (currentMode == MODE_DETAILED)
+        {
+            drawDetailedWidgets();
+        }
+
+        invalidateReadouts();
+        drawnMode = currentMode;
+        drawnDataValid = dashData.dataValid;
+        layoutDirty = false;
     }
-    display.updateDisplay();
+
+    // Live values
+    {
+        PERF_SCOPE(perf, perfValues);
+        TRACE_SCOPE("values");
+        switch (currentMode)
+        {
+        case MODE_DASHBOARD:
+            updateDashboardValues();
+            break;
+        case MODE_DETAILED:
+            updateDetailedValues();
+            break;
+        default:
+            break;
+        }
+    }
+
+    {
+        PERF_SCOPE(perf, perfPush);
+        TRACE_SCOPE("push");
+        display.updateDisplay();
+    }
+    perf.frame();
+}
+
+void setupWidgets()
+{
+    // Gauges (faces are rendered on first draw)
+    oilGauge.begin(&gfx, 50, 80, 150, 40, 120, "ENGINE OIL", COLOR_ORANGE);
+    oilGauge.addZone(110, 120, COLOR_RED);
+    coolantGauge.begin(&gfx, 250, 80, 150, 40, 120, "COOLANT", COLOR_BLUE);
+    coolantGauge.addZone(105, 120, COLOR_RED);
+    batteryGauge.begin(&gfx, 450, 80, 150, 10, 16, "BATTERY", COLOR_GREEN);
+    batteryGauge.setMajorTicks(6);
+    batteryGauge.addZone(10, 11.8, COLOR_RED);
+    batteryGauge.addZone(14.8, 16, COLOR_RED);
+    oilGauge.setAntialiased(true);
+    coolantGauge.setAntialiased(true);
+    batteryGauge.setAntialiased(true);
+
+    // Gauge values, centred below the gauges
+    gfx.useFreeSans18pt7b();
+    oilGaugeReadout.begin(&gfx, 50, 265, 5, COLOR_ORANGE, COLOR_BLACK);
+    coolantGaugeReadout.begin(&gfx, 250, 265, 5, COLOR_BLUE, COLOR_BLACK);
+    batteryGaugeReadout.begin(&gfx, 450, 265, 5, COLOR_GREEN, COLOR_BLACK);
+    int16_t gaugeOffset = (150 - oilGaugeReadout.getWidth()) / 2;
+    oilGaugeReadout.setPosition(50 + gaugeOffset, 265);
+    coolantGaugeReadout.setPosition(250 + gaugeOffset, 265);
+    batteryGaugeReadout.setPosition(450 + gaugeOffset, 265);
+
+    // Bottom bar
+    coolantReadout.begin(&gfx, 190, 350, 5, COLOR_CYAN, COLOR_DARKGRAY);
+    speedReadout.begin(&gfx, 480, 350, 3, COLOR_GREEN, COLOR_DARKGRAY);
+    boostReadout.begin(&gfx, 190, 400, 6, COLOR_MAGENTA, COLOR_DARKGRAY);
+
+    // Detailed view
+    gfx.useBuiltinFont(1);
+    for (int i = 0; i < 5; i++)
+    {
+        detailReadouts[i].begin(&gfx, 300, 80 + i * 30, 7, COLOR_WHITE, COLOR_BLACK);
+    }
+    lastUpdateReadout.begin(&gfx, 150, 250, 8, COLOR_GRAY, COLOR_BLACK);
+    for (int i = 0; i < 5; i++)
+    {
+        statReadouts[i].begin(&gfx, 540, 80 + i * 30, 7, COLOR_WHITE, COLOR_BLACK);
+    }
+
+    oilHistory.begin(TREND_HISTORY);
+    boostHistory.begin(TREND_HISTORY);
+    oilChart.begin(&gfx, 20, 320, 375, 145, &oilHistory, 40, 130, TREND_WINDOW_MS, "ENGINE OIL C", COLOR_ORANGE);
+    oilChart.addMarker(OIL_WARNING_TEMP, COLOR_RED);
+    boostChart.begin(&gfx, 405, 320, 375, 145, &boostHistory, -100, 150, TREND_WINDOW_MS, "BOOST kPa", COLOR_MAGENTA);
+    boostChart.addMarker(0, COLOR_GRAY);
+
+    // Oil warning, drawn once into its own surface
+    compositor.begin(&gfx);
+    if (oilWarningSurface.begin(170, 60))
+    {
+        renderOilWarning();
+
+        CompositeOptions warning;
+        warning.alpha = 224;
+        oilWarningLayer = compositor.addLayer(&oilWarningSurface, 615, 100, warning);
+    }
+}
+
+void setupPerf()
+{
+    // The HUD is a compositor layer like the oil warning (beside it, not over it)
+    if (!perf.begin(&gfx, &compositor))
+    {
+        Serial.println("⚠️ Perf HUD unavailable");
+    }
+    perfLayout = perf.addZone("layout");
+    perfValues = perf.addZone("values");
+    perfPush = perf.addZone("push");
+    perfOBD = perf.addZone("obd");
+    perfRTT = perf.addZone("ble rtt");
+
+    // Trace rings, recorded on demand ('t')
+    if (!tracer.begin())
+    {
+        Serial.println("⚠️ Trace buffers unavailable");
+    }
+
+    // OBD samples/s per enabled PID
+    for (int i = 0; i < (int)TOTAL_PIDS; i++)
+    {
+        perfPIDs[i] = userPIDs[i].enabled ? perf.addCounter(userPIDs[i].name) : -1;
+    }
+}
+
+void setupTelemetry()
+{
+    // Channels are the mode 01 PID numbers ("010D" -> 0x0D), so logs stay
+    // readable when PIDs are enabled or reordered
+    for (int i = 0; i < (int)TOTAL_PIDS; i++)
+    {
+        telemetryChannels[i] = (uint16_t)strtol(String(userPIDs[i].cmd).substring(2, 4).c_str(), nullptr, 16);
+        telemetry.setChannelName(telemetryChannels[i], userPIDs[i].name);
+        channelStats.addChannel(telemetryChannels[i], userPIDs[i].name);
+    }
+    ChannelStats* oilStats = channelStats.find(OIL_CHANNEL);
+    if (oilStats)
+    {
+        oilStats->addEdge(OIL_WARNING_TEMP);
+    }
+
+    if (telemetry.begin())
+    {
+        Serial.printf("Telemetry session %u (%lu KB ring)\n", telemetry.getSession(),
+                      (unsigned long)(telemetry.getCapacity() / 1024));
+    }
+    else
+    {
+        Serial.println("⚠️ Telemetry log unavailable");
+    }
+}
+
+// ===== DERIVED CHANNELS =====
+
+// MAP - baro, kPa
+bool deriveBoost(const float* in, float* out)
+{
+    *out = in[0] - in[1];
+    return true;
+}
+
+// MAF -> L/h at stoichiometric
+bool deriveFuelFlow(const float* in, float* out)
+{
+    *out = in[0] / STOICH_AFR / FUEL_DENSITY * 3600.0f;
+    return true;
+}
+
+// L/h and km/h -> L/100 km, only while moving
+bool deriveEconomy(const float* in, float* out)
+{
+    if (in[1] < ECONOMY_MIN_SPEED)
+    {
+        return false;
+    }
+    *out = in[0] * 100.0f / in[1];
+    return true;
+}
+
+// MAF -> kW from the fuel burnt (a rough estimate, no load or RPM model)
+bool derivePower(const float* in, float* out)
+{
+    *out = in[0] / STOICH_AFR * FUEL_ENERGY * BRAKE_EFFICIENCY;
+    return true;
+}
+
+// Results go where PID samples go; boost also drives the display
+void recordDerivedSample(uint16_t channel, uint32_t time_ms, float value, void* arg)
+{
+    telemetry.log(channel, value, time_ms);
+    channelStats.add(channel, time_ms, value);
+    if (channel == BOOST_CHANNEL)
+    {
+        updateBoost(value);
+    }
+}
+
+void setupDerived()
+{
+    static const uint16_t boostInputs[] = {MAP_CHANNEL, BARO_CHANNEL};
+    static const uint16_t fuelFlowInputs[] = {MAF_CHANNEL};
+    static const uint16_t economyInputs[] = {FUEL_FLOW_CHANNEL, SPEED_CHANNEL};
+    static const uint16_t powerInputs[] = {MAF_CHANNEL};
+
+    derived.setSink(recordDerivedSample);
+    derived.setDefault(BARO_CHANNEL, STANDARD_BARO);
+    derived.addNode(BOOST_CHANNEL, "Boost", deriveBoost, boostInputs, 2, 1000);
+    derived.addNode(FUEL_FLOW_CHANNEL, "Fuel Flow", deriveFuelFlow, fuelFlowInputs, 1, 0);
+    derived.addNode(ECONOMY_CHANNEL, "Economy", deriveEconomy, economyInputs, 2, 1500);
+    derived.addNode(POWER_CHANNEL, "Power", derivePower, powerInputs, 1, 0);
+
+    for (uint8_t i = 0; i < derived.getNodeCount(); i++)
+    {
+        telemetry.setChannelName(derived.getNodeChannel(i), derived.getNodeName(i));
+        channelStats.addChannel(derived.getNodeChannel(i), derived.getNodeName(i));
+    }
+}
+
+void renderOilWarning()
+{
+    gfx.setTarget(&oilWarningSurface);
+    gfx.fillScreen(COLOR_RED);
+    gfx.drawRect(0, 0, 170, 60, COLOR_WHITE);
+    gfx.useFreeSans9pt();
+    gfx.setTextColor(COLOR_WHITE);
+    gfx.printAt(15, 25, "OIL TEMP HIGH");
+    gfx.printAt(15, 48, "Ease off");
+    gfx.resetTarget();
+}
+
+// Everything on screen or cached was drawn with the previous correction
+void refreshCorrectedColors()
+{
+    oilGauge.invalidateFace();
+    coolantGauge.invalidateFace();
+    batteryGauge.invalidateFace();
+    if (oilWarningSurface.isReady())
+    {
+        renderOilWarning();
+    }
+    layoutDirty = true;
+}
+
+// Feed the local time to the profile manager once the clock is valid
+void updateProfileClock()
+{
+    static unsigned long lastCheck = 0;
+    if (nightManual || millis() - lastCheck < CLOCK_CHECK_MS)
+    {
+        return;
+    }
+    lastCheck = millis();
+
+    time_t now = time(nullptr);
+    if (now < CLOCK_VALID_AFTER)
+    {
+        return;
+    }
+    struct tm local;
+    localtime_r(&now, &local);
+    displayProfile.setSource(PROFILE_TIME);
+    displayProfile.setTimeOfDay(local.tm_hour, local.tm_min);
+}
+
+void invalidateReadouts()
+{
+    oilGaugeReadout.invalidate();
+    coolantGaugeReadout.invalidate();
+    batteryGaugeReadout.invalidate();
+    coolantReadout.invalidate();
+    speedReadout.invalidate();
+    boostReadout.invalidate();
+    for (int i = 0; i < 5; i++)
+    {
+        detailReadouts[i].invalidate();
+        statReadouts[i].invalidate();
+    }
+    lastUpdateReadout.invalidate();
 }
 
 void drawDashboard()
@@ -179,11 +710,7 @@ void drawDashboard()
         gfx.printAt(600, 20, "OBD DISCONNECTED");
     }
 
-    // Main gauges - 2x2 grid
-    drawGauge(50, 100, 150, "ENGINE OIL", dashData.engineOilTemp, "°C", 40, 120, COLOR_ORANGE);
-    drawGauge(250, 100, 150, "Coolant", dashData.coolantTemp, "°C", 0, 20, COLOR_BLUE);
-    drawGauge(450, 100, 150, "Battery", dashData.moduleVoltage, "V", 0, 100, COLOR_GREEN);
-    // drawGauge(650, 100, 150, "LOAD", dashData.engineLoad, "%", 0, 100, COLOR_YELLOW);
+    // Main gauges are widgets drawn after the layout (see drawDashboardWidgets)
 
     // Bottom info bar
     gfx.fillRect(0, 300, 800, 180, COLOR_DARKGRAY);
@@ -192,74 +719,65 @@ void drawDashboard()
     gfx.useFreeSans18pt7b();
     gfx.setTextColor(COLOR_WHITE);
     gfx.printAt(50, 350, "Coolant:");
-    gfx.setTextColor(COLOR_CYAN);
-    char coolantStr[20];
-    sprintf(coolantStr, "%d", dashData.coolantTemp);
-    gfx.printAt(150, 350, coolantStr);
 
-    gfx.setTextColor(COLOR_WHITE);
     gfx.printAt(350, 350, "SPEED:");
     gfx.setTextColor(COLOR_GREEN);
-    char speedStr[20];
-    sprintf(speedStr, "%d km/h", dashData.speed);
-    gfx.printAt(480, 350, speedStr);
+    gfx.printAt(speedReadout.getX() + speedReadout.getWidth() + 10, 350, "km/h");
 
     // Boost pressure (EcoBoost specific)
     gfx.setTextColor(COLOR_WHITE);
     gfx.printAt(50, 400, "BOOST:");
     gfx.setTextColor(COLOR_MAGENTA);
-    char boostStr[20];
-    sprintf(boostStr, "%.1f kPa", dashData.boost);
-    gfx.printAt(180, 400, boostStr);
+    gfx.printAt(boostReadout.getX() + boostReadout.getWidth() + 10, 400, "kPa");
 
     // Touch buttons
     gfx.fillRect(650, 330, 120, 40, COLOR_BLUE);
     gfx.useFreeSans9pt();
     gfx.setTextColor(COLOR_WHITE);
     gfx.printAt(685, 350, "DETAILS");
+    hitTargets.add(650, 330, 120, 40, switchMode, (void*)MODE_DETAILED);
 
     gfx.fillRect(650, 380, 120, 40, COLOR_GRAY);
     gfx.printAt(685, 400, "SETTINGS");
+    hitTargets.add(650, 380, 120, 40, switchMode, (void*)MODE_SETTINGS);
 }
 
-void drawGauge(int x, int y, int size, const char *label, float value, const char *units, float minVal, float maxVal, uint16_t color)
+void updateDashboardValues()
 {
-    // Gauge background
-    // gfx.drawCircle(x + size/2, y + size/2, size/2, COLOR_WHITE);
-    // gfx.drawCircle(x + size/2, y + size/2, size/2 - 2, COLOR_DARKGRAY);
-
-    // Label
-    gfx.useBuiltinFont(2);
-    gfx.setTextColor(COLOR_WHITE);
-    int labelWidth = strlen(label) * 6;
-    gfx.printAt(x + (size - labelWidth) / 2, y + 10, label);
-
-    // Value
-    gfx.useFreeSans18pt7b();
-    gfx.setTextColor(color);
-    char valueStr[20];
-    // sprintf(valueStr, "%.1f%s", value, units);
-    sprintf(valueStr, "%.1f", value);
-    int valueWidth = strlen(valueStr) * 10;
-    gfx.printAt(x + (size - valueWidth) / 2, y + size / 2 + 10, valueStr);
-    // gfx.printAt(100, 200, valueStr);
-
-    // Gauge needle (simplified)
-    if (maxVal > minVal)
+    oilGauge.setValue(dashData.engineOilTemp);
+    coolantGauge.setValue(dashData.coolantTemp);
+    batteryGauge.setValue(dashData.moduleVoltage);
+    oilGaugeReadout.setValue(dashData.engineOilTemp);
+    coolantGaugeReadout.setValue(dashData.coolantTemp);
+    batteryGaugeReadout.setValue(dashData.moduleVoltage);
+
+    coolantReadout.setValue(dashData.coolantTemp);
+    speedReadout.setValue(dashData.speed);
+    boostReadout.setValue(dashData.boost);
+
+    bool oilHot = dashData.engineOilTemp >= OIL_WARNING_TEMP;
+    if (oilHot != compositor.isVisible(oilWarningLayer))
     {
-        float angle = ((value - minVal) / (maxVal - minVal)) * 270.0 - 135.0; // -135° to +135°
-        float rad = angle * PI / 180.0;
-        int needleLen = size / 2 - 20;
-        int centerX = x + size / 2;
-        int centerY = y + size / 2;
-        int needleX = centerX + needleLen * cos(rad);
-        int needleY = centerY + needleLen * sin(rad);
-
-        // gfx.drawLine(centerX, centerY, needleX, needleY, color);
-        // gfx.fillCircle(centerX, centerY, 3, color);
+        if (oilHot)
+            compositor.show(oilWarningLayer);
+        else
+            compositor.hide(oilWarningLayer);
     }
 }
 
+void drawDashboardWidgets()
+{
+    oilGauge.draw();
+    coolantGauge.draw();
+    batteryGauge.draw();
+}
+
+void drawDetailedWidgets()
+{
+    oilChart.draw(millis());
+    boostChart.draw(millis());
+}
+
 void drawDetailedView()
 {
     gfx.fillScreen(COLOR_BLACK);
@@ -274,6 +792,7 @@ void drawDetailedView()
     gfx.fillRect(700, 10, 80, 30, COLOR_BLUE);
     gfx.setTextColor(COLOR_WHITE);
     gfx.printAt(720, 25, "BACK");
+    hitTargets.add(700, 10, 80, 30, switchMode, (void*)MODE_DASHBOARD);
 
     // Detailed data list
     int yPos = 80;
@@ -281,51 +800,83 @@ void drawDetailedView()
 
     // Engine Oil Temperature - highlighted
     gfx.setTextColor(COLOR_ORANGE);
+    // Values are readouts (see updateDetailedValues), units follow them
+    int unitsX = detailReadouts[0].getX() + detailReadouts[0].getWidth() + 6;
+
     gfx.printAt(20, yPos, "🌡️ ENGINE OIL TEMPERATURE:");
     gfx.setTextColor(COLOR_WHITE);
-    char oilTempStr[30];
-    sprintf(oilTempStr, "%.1f °C", dashData.engineOilTemp);
-    gfx.printAt(300, yPos, oilTempStr);
+    gfx.printAt(unitsX, yPos, "°C");
     yPos += 30;
 
     gfx.setTextColor(COLOR_BLUE);
     gfx.printAt(20, yPos, "🌡️ COOLANT TEMPERATURE:");
     gfx.setTextColor(COLOR_WHITE);
-    char coolantStr[30];
-    sprintf(coolantStr, "%.1f °C", dashData.coolantTemp);
-    gfx.printAt(300, yPos, coolantStr);
+    gfx.printAt(unitsX, yPos, "°C");
     yPos += 30;
 
     gfx.setTextColor(COLOR_CYAN);
     gfx.printAt(20, yPos, "🌬️ INTAKE AIR TEMP:");
     gfx.setTextColor(COLOR_WHITE);
-    char intakeStr[30];
-    sprintf(intakeStr, "%.1f °C", dashData.intakeAirTemp);
-    gfx.printAt(300, yPos, intakeStr);
+    gfx.printAt(unitsX, yPos, "°C");
     yPos += 30;
 
     gfx.setTextColor(COLOR_GREEN);
     gfx.printAt(20, yPos, "🎯 THROTTLE POSITION:");
     gfx.setTextColor(COLOR_WHITE);
-    char throttleStr[30];
-    sprintf(throttleStr, "%.1f %%", dashData.throttlePos);
-    gfx.printAt(300, yPos, throttleStr);
+    gfx.printAt(unitsX, yPos, "%");
     yPos += 30;
 
     gfx.setTextColor(COLOR_YELLOW);
     gfx.printAt(20, yPos, "⚡ ENGINE LOAD:");
     gfx.setTextColor(COLOR_WHITE);
-    char loadStr[30];
-    sprintf(loadStr, "%.1f %%", dashData.engineLoad);
-    gfx.printAt(300, yPos, loadStr);
+    gfx.printAt(unitsX, yPos, "%");
     yPos += 30;
 
     // Last update time
     gfx.setTextColor(COLOR_GRAY);
-    gfx.printAt(20, 400, "Last Update:");
-    char timeStr[50];
-    sprintf(timeStr, "%lu ms ago", millis() - dashData.lastUpdate);
-    gfx.printAt(150, 400, timeStr);
+    gfx.printAt(20, 250, "Last Update:");
+    gfx.printAt(lastUpdateReadout.getX() + lastUpdateReadout.getWidth() + 6, 250, "ms ago");
+
+    // Statistics beside the live values (clear of the perf HUD)
+    const char* statLabels[5] = {"OIL MAX:", "OIL AVG 5 MIN:", "OIL TREND:", "OIL ABOVE 110:", "BOOST MAX:"};
+    const char* statUnits[5] = {"°C", "°C", "°C/min", "min", "kPa"};
+    int statUnitsX = statReadouts[0].getX() + statReadouts[0].getWidth() + 6;
+    for (int i = 0; i < 5; i++)
+    {
+        gfx.setTextColor(COLOR_GRAY);
+        gfx.printAt(420, 80 + i * 30, statLabels[i]);
+        gfx.setTextColor(COLOR_WHITE);
+        gfx.printAt(statUnitsX, 80 + i * 30, statUnits[i]);
+    }
+
+    // Trend charts are widgets drawn after the layout (see drawDetailedWidgets)
+}
+
+void updateDetailedValues()
+{
+    detailReadouts[0].setValue(dashData.engineOilTemp);
+    detailReadouts[1].setValue(dashData.coolantTemp);
+    detailReadouts[2].setValue(dashData.intakeAirTemp);
+    detailReadouts[3].setValue(dashData.throttlePos);
+    detailReadouts[4].setValue(dashData.engineLoad);
+    lastUpdateReadout.setValue((int)(millis() - dashData.lastUpdate));
+
+    const ChannelStats* oilStats = channelStats.find(OIL_CHANNEL);
+    if (oilStats && oilStats->hasData())
+    {
+        statReadouts[0].setValue(oilStats->getSession().max);
+        statReadouts[1].setValue(oilStats->getWindow(millis()).mean);
+        statReadouts[2].setValue(oilStats->getRate() * 60.0f);
+        statReadouts[3].setValue(oilStats->getTimeAbove(OIL_WARNING_TEMP) / 60000.0f);
+    }
+    const ChannelStats* boostStats = channelStats.find(BOOST_CHANNEL);
+    if (boostStats && boostStats->hasData())
+    {
+        statReadouts[4].setValue(boostStats->getSession().max, 0);
+    }
+
+    oilChart.update(millis());
+    boostChart.update(millis());
 }
 
 void drawSettingsView()
@@ -334,56 +885,45 @@ void drawSettingsView()
 
     gfx.useFreeSans9pt();
     gfx.setTextColor(COLOR_WHITE);
-    gfx.printAt(300, 200, "Settings View");
-    gfx.printAt(250, 250, "(Not implemented yet)");
+    gfx.printAt(300, 150, "Settings View");
+
+    // Night mode toggle
+    drawNightToggle();
+    hitTargets.add(300, 200, 200, 40, toggleNightMode);
 
     // Back button
     gfx.fillRect(350, 300, 100, 40, COLOR_BLUE);
     gfx.setTextColor(COLOR_WHITE);
     gfx.printAt(385, 320, "BACK");
+    hitTargets.add(350, 300, 100, 40, switchMode, (void*)MODE_DASHBOARD);
 }
 
-void handleTouch(int x, int y)
+void drawNightToggle()
 {
-    Serial.printf("Touch at: %d, %d\n", x, y);
-
-    switch (currentMode)
-    {
-    case MODE_DASHBOARD:
-        // Details button
-        if (x >= 650 && x <= 770 && y >= 330 && y <= 370)
-        {
-            currentMode = MODE_DETAILED;
-            Serial.println("Switching to detailed view");
-        }
-        // Settings button
-        else if (x >= 650 && x <= 770 && y >= 380 && y <= 420)
-        {
-            currentMode = MODE_SETTINGS;
-            Serial.println("Switching to settings view");
-        }
-        break;
+    gfx.fillRect(300, 200, 200, 40, displayProfile.isNight() ? COLOR_ORANGE : COLOR_GRAY);
+    gfx.useFreeSans9pt();
+    gfx.setTextColor(COLOR_WHITE);
+    gfx.printAt(335, 225, displayProfile.isNight() ? "NIGHT MODE: ON" : "NIGHT MODE: OFF");
+}
 
-    case MODE_DETAILED:
-        // Back button
-        if (x >= 700 && x <= 780 && y >= 10 && y <= 40)
-        {
-            currentMode = MODE_DASHBOARD;
-            Serial.println("Back to dashboard");
-        }
-        break;
+// ===== TOUCH TARGET CALLBACKS =====
 
-    case MODE_SETTINGS:
-        // Back button
-        if (x >= 350 && x <= 450 && y >= 300 && y <= 340)
-        {
-            currentMode = MODE_DASHBOARD;
-            Serial.println("Back to dashboard");
-        }
-        break;
-    }
+// Screen buttons; the new layout is drawn (and its targets registered) by
+// the next updateDisplay()
+void switchMode(int8_t id, void* arg)
+{
+    currentMode = (DisplayMode)(intptr_t)arg;
+    Serial.printf("Switching to mode %d\n", (int)currentMode);
+}
 
-    updateDisplay();
+// Only the toggle itself is redrawn; the profile transition refreshes the rest
+void toggleNightMode(int8_t id, void* arg)
+{
+    nightManual = true;
+    displayProfile.setSource(PROFILE_MANUAL);
+    displayProfile.setNight(!displayProfile.isNight());
+    drawNightToggle();
+    Serial.printf("Night mode %s\n", displayProfile.isNight() ? "on" : "off");
 }
 
 // ===== CALLBACK FUNCTIONS FOR OBD DATA =====
@@ -394,6 +934,7 @@ void updateEngineOilTemp(float temp)
     dashData.engineOilTemp = temp;
     dashData.lastUpdate = millis();
     dashData.dataValid = true;
+    oilHistory.add(dashData.lastUpdate, temp);
 
     // debug
     Serial.println("📱 Display update called: Oil temp = " + String(temp));
@@ -453,4 +994,31 @@ void updateBoost(float boost)
     dashData.boost = boost;
     dashData.lastUpdate = millis();
     dashData.dataValid = true;
-}
\ No newline at end of file
+    boostHistory.add(dashData.lastUpdate, boost);
+}
+
+// ===== INSTRUMENTATION HOOKS FROM ford_obd.cpp =====
+
+void recordOBDSample(int pidIndex)
+{
+    if (pidIndex >= 0 && pidIndex < (int)TOTAL_PIDS)
+    {
+        perf.count(perfPIDs[pidIndex]);
+    }
+}
+
+void recordOBDRoundTrip(unsigned long us)
+{
+    perf.recordMicros(perfRTT, us);
+}
+
+void recordTelemetrySample(int pidIndex, float value)
+{
+    if (pidIndex >= 0 && pidIndex < (int)TOTAL_PIDS)
+    {
+        uint32_t now = millis();
+        telemetry.log(telemetryChannels[pidIndex], value, now);
+        channelStats.add(telemetryChannels[pidIndex], now, value);
+        derived.add(telemetryChannels[pidIndex], now, value);
+    }
+}
@@ -0,0 +1,11 @@
+#pragma once
+// Host stand-in for the Arduino core (native test env only): the C headers
+// the library code expects Arduino.h to bring in, and PROGMEM. Sources that
+// need the real core (Serial, millis, FreeRTOS) can't be tested natively.
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define PROGMEM
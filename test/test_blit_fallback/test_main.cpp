@@ -0,0 +1,111 @@
+#include <unity.h>
+#include "blit_engine.cpp"
+
+// Without ESP_PLATFORM every copy takes the memcpy path: the pixels must
+// land, and the callback must run before copyRect() returns
+
+#define SRC_W 40
+#define SRC_H 30
+#define DST_W 64
+#define DST_H 48
+
+static uint16_t src[SRC_W * SRC_H];
+static uint16_t dst[DST_W * DST_H];
+static int callbacks;
+static void* callback_arg;
+
+static void onDone(void* arg) {
+    callbacks++;
+    callback_arg = arg;
+}
+
+void setUp(void) {
+    for (int i = 0; i < SRC_W * SRC_H; i++) src[i] = (uint16_t)(i * 2654435761u >> 16);
+    memset(dst, 0, sizeof(dst));
+    callbacks = 0;
+    callback_arg = nullptr;
+}
+
+void tearDown(void) {}
+
+static void test_no_dma_on_host(void) {
+    BlitEngine blit;
+    TEST_ASSERT_FALSE(blit.begin());
+    TEST_ASSERT_FALSE(blit.isDMAReady());
+}
+
+static void test_contiguous_copy(void) {
+    BlitEngine blit;
+    blit.begin();
+    TEST_ASSERT_FALSE(blit.copyRect(dst, SRC_W, src, SRC_W, SRC_W, SRC_H, onDone, &blit));
+    TEST_ASSERT_EQUAL_INT(1, callbacks);
+    TEST_ASSERT_EQUAL_PTR(&blit, callback_arg);
+    TEST_ASSERT_EQUAL_HEX16_ARRAY(src, dst, SRC_W * SRC_H);
+    TEST_ASSERT_EQUAL_UINT16(0, dst[SRC_W * SRC_H]);
+}
+
+// A sub-rectangle between buffers of different strides; the pixels around
+// the destination rectangle stay untouched
+static void test_strided_copy(void) {
+    const int16_t x = 5, y = 7, w = 23, h = 11;
+    const int16_t sx = 3, sy = 2;
+    BlitEngine blit;
+    blit.copyRect(dst + y * DST_W + x, DST_W, src + sy * SRC_W + sx, SRC_W, w, h, onDone);
+    TEST_ASSERT_EQUAL_INT(1, callbacks);
+    for (int16_t row = 0; row < DST_H; row++) {
+        for (int16_t col = 0; col < DST_W; col++) {
+            bool inside = row >= y && row < y + h && col >= x && col < x + w;
+            uint16_t expected = inside ? src[(row - y + sy) * SRC_W + col - x + sx] : 0;
+            TEST_ASSERT_EQUAL_HEX16(expected, dst[row * DST_W + col]);
+        }
+    }
+}
+
+// Large and aligned enough for the GDMA on the device; still the CPU here
+static void test_large_copy_uses_cpu(void) {
+    static uint16_t big_src[128 * 64];
+    static uint16_t big_dst[128 * 64];
+    for (int i = 0; i < 128 * 64; i++) big_src[i] = (uint16_t)i;
+    BlitEngine blit;
+    blit.begin();
+    TEST_ASSERT_FALSE(blit.copyRect(big_dst, 128, big_src, 128, 128, 64, onDone));
+    TEST_ASSERT_EQUAL_INT(1, callbacks);
+    TEST_ASSERT_EQUAL_HEX16_ARRAY(big_src, big_dst, 128 * 64);
+
+    const BlitStats& stats = blit.getStats();
+    TEST_ASSERT_EQUAL_UINT32(0, stats.dma_copies);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.cpu_copies);
+    TEST_ASSERT_EQUAL_UINT32(128 * 64 * 2, stats.cpu_bytes);
+    blit.resetStats();
+    TEST_ASSERT_EQUAL_UINT32(0, blit.getStats().cpu_copies);
+}
+
+// Empty or invalid rectangles copy nothing but still complete
+static void test_empty_rect_completes(void) {
+    BlitEngine blit;
+    blit.copyRect(dst, DST_W, src, SRC_W, 0, 10, onDone);
+    blit.copyRect(dst, DST_W, src, SRC_W, 10, -1, onDone);
+    blit.copyRect(nullptr, DST_W, src, SRC_W, 10, 10, onDone);
+    TEST_ASSERT_EQUAL_INT(3, callbacks);
+    TEST_ASSERT_EQUAL_UINT16(0, dst[0]);
+    TEST_ASSERT_EQUAL_UINT32(0, blit.getStats().cpu_copies);
+}
+
+static void test_wait_when_idle(void) {
+    BlitEngine blit;
+    blit.copyRect(dst, DST_W, src, SRC_W, SRC_W, SRC_H);
+    TEST_ASSERT_FALSE(blit.isBusy());
+    blit.wait();
+    TEST_ASSERT_FALSE(blit.isBusy());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_no_dma_on_host);
+    RUN_TEST(test_contiguous_copy);
+    RUN_TEST(test_strided_copy);
+    RUN_TEST(test_large_copy_uses_cpu);
+    RUN_TEST(test_empty_rect_completes);
+    RUN_TEST(test_wait_when_idle);
+    return UNITY_END();
+}
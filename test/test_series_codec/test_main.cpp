@@ -0,0 +1,207 @@
+#include <unity.h>
+#include "series_codec.cpp"    // floatBits() comes with it
+
+// Round trips through SeriesEncoder/SeriesDecoder; values are compared as
+// bits, so NaN payloads and the sign of zero have to survive unchanged
+
+#define BLOCK_SIZE 128
+
+static float bitsFloat(uint32_t bits) {
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+struct Sample {
+    uint32_t ms;
+    uint32_t bits;
+};
+
+// Encodes samples until the block is full; returns how many fitted
+static uint16_t encode(uint8_t* block, const Sample* samples, uint16_t count) {
+    SeriesEncoder encoder;
+    encoder.begin(block, BLOCK_SIZE);
+    for (uint16_t i = 0; i < count; i++) {
+        if (!encoder.append(samples[i].ms, bitsFloat(samples[i].bits))) break;
+    }
+    TEST_ASSERT_LESS_OR_EQUAL(BLOCK_SIZE, encoder.getBytes());
+    return encoder.getCount();
+}
+
+static void checkDecode(const uint8_t* block, uint16_t size, const Sample* samples, uint16_t count) {
+    SeriesDecoder decoder;
+    decoder.begin(block, size, count);
+    for (uint16_t i = 0; i < count; i++) {
+        uint32_t ms;
+        float value;
+        TEST_ASSERT_TRUE_MESSAGE(decoder.next(&ms, &value), "block ended early");
+        TEST_ASSERT_EQUAL_UINT32(samples[i].ms, ms);
+        TEST_ASSERT_EQUAL_HEX32(samples[i].bits, floatBits(value));
+    }
+    uint32_t ms;
+    float value;
+    TEST_ASSERT_FALSE(decoder.next(&ms, &value));
+}
+
+static void roundTrip(const Sample* samples, uint16_t count) {
+    uint8_t block[BLOCK_SIZE];
+    TEST_ASSERT_EQUAL_UINT16(count, encode(block, samples, count));
+    checkDecode(block, BLOCK_SIZE, samples, count);
+}
+
+static void test_steady_samples(void) {
+    Sample samples[40];
+    for (uint16_t i = 0; i < 40; i++) samples[i] = { 5000u + i * 100u, floatBits(90.0f) };
+    roundTrip(samples, 40);
+
+    // The first interval costs a 110 code, then two bits per sample
+    uint8_t block[BLOCK_SIZE];
+    SeriesEncoder encoder;
+    encoder.begin(block, BLOCK_SIZE);
+    for (uint16_t i = 0; i < 40; i++) encoder.append(samples[i].ms, 90.0f);
+    TEST_ASSERT_EQUAL_UINT16(SERIES_HEADER_SIZE + (12 + 1 + 38 * 2 + 7) / 8, encoder.getBytes());
+}
+
+// Every delta-of-delta range, including both edges of each
+static void test_timestamp_codes(void) {
+    const int32_t dods[] = { 0, -64, 63, 64, -65, -256, 255, 256, -257, -2048, 2047, 2048, -2049,
+                             1000000, -1000000 };
+    Sample samples[20];
+    uint32_t ms = 100000;
+    int32_t delta = 5000;
+    samples[0] = { ms, floatBits(1.0f) };
+    uint16_t count = 1;
+    for (int32_t dod : dods) {
+        delta += dod;
+        ms += delta;
+        samples[count++] = { ms, floatBits(1.0f) };
+    }
+    roundTrip(samples, count);
+}
+
+// Timestamps wrap like millis() does; deltas use the full 32 bits
+static void test_time_wrap_and_jumps(void) {
+    const Sample samples[] = {
+        { 0xFFFFFF00u, floatBits(2.0f) },
+        { 0xFFFFFFF0u, floatBits(2.0f) },
+        { 0x00000010u, floatBits(2.0f) },
+        { 0x80000010u, floatBits(2.0f) },
+        { 0x00000020u, floatBits(2.0f) },
+        { 0x00000020u, floatBits(2.0f) },
+        { 0x7FFFFFFFu, floatBits(2.0f) },
+    };
+    roundTrip(samples, sizeof(samples) / sizeof(samples[0]));
+}
+
+static void test_special_floats(void) {
+    const Sample samples[] = {
+        { 0, 0x00000000u },            // +0
+        { 10, 0x80000000u },           // -0
+        { 20, 0x00000000u },
+        { 30, 0x7F800000u },           // +inf
+        { 40, 0xFF800000u },           // -inf
+        { 50, 0x7FC00000u },           // Quiet NaN
+        { 60, 0x7FC00001u },           // NaN payloads
+        { 70, 0xFFFFFFFFu },
+        { 80, 0x7F800001u },           // Signalling NaN
+        { 90, 0x00000001u },           // Smallest denormal
+        { 100, 0x007FFFFFu },          // Largest denormal
+        { 110, 0x00800000u },          // Smallest normal
+        { 120, 0x7F7FFFFFu },          // Largest finite
+        { 130, 0x7F7FFFFFu },
+        { 140, 0x3F800000u },
+    };
+    roundTrip(samples, sizeof(samples) / sizeof(samples[0]));
+}
+
+// Changes that reuse the stored leading/trailing window and ones that don't
+static void test_xor_windows(void) {
+    const float values[] = { 12.5f, 12.75f, 13.0f, 12.75f, 12.5f, 13.25f, 100.0f, 99.5f, 0.001f, -0.001f,
+                             3.14159f, 3.14160f, 3.14159f };
+    const uint16_t count = sizeof(values) / sizeof(values[0]);
+    Sample samples[count];
+    for (uint16_t i = 0; i < count; i++) samples[i] = { 1000u + i * 50, floatBits(values[i]) };
+    roundTrip(samples, count);
+}
+
+// A full block keeps everything appended before the rejected sample
+static void test_block_full(void) {
+    Sample samples[200];
+    uint32_t seed = 12345;
+    uint32_t ms = 0;
+    for (uint16_t i = 0; i < 200; i++) {
+        seed = seed * 1103515245u + 12345u;
+        ms += 80 + (seed >> 24) % 40;
+        samples[i] = { ms, seed };
+    }
+    uint8_t block[BLOCK_SIZE];
+    uint16_t count = encode(block, samples, 200);
+    TEST_ASSERT_GREATER_THAN_UINT16(1, count);
+    TEST_ASSERT_LESS_THAN_UINT16(200, count);
+    checkDecode(block, BLOCK_SIZE, samples, count);
+}
+
+// Block written by tools/tlog_codec.py encode_block() (header, 1111 and 110
+// timestamp codes, -0, inf and window reuse); both sides must stay in sync
+static const uint8_t python_block[] = {
+    0xE8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x48, 0x41, 0xC6, 0x43, 0x68, 0x30, 0x5D, 0x62, 0xF7, 0x66,
+    0x66, 0xE0, 0x5E, 0x0A, 0xF7, 0x6A, 0x3C, 0x00, 0x00, 0x23, 0xF2, 0xFF, 0x8F, 0x0F, 0xFF, 0xF7,
+    0x04, 0xC3, 0xE8, 0xA0, 0x62, 0x4D, 0xFF, 0xC0, 0x00, 0x00, 0xC9, 0x7A, 0xC3, 0x12, 0x6F, 0xF1,
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x80, 0x00, 0x00,
+};
+
+static const Sample python_samples[] = {
+    { 1000, 0x41480000u },
+    { 1100, 0x41480000u },
+    { 1200, 0x414C0000u },
+    { 1305, 0x41500000u },
+    { 1400, 0x41500000u },
+    { 1700, 0x80000000u },
+    { 1700, 0x80000000u },
+    { 4000, 0x7F800000u },
+    { 268439456, 0x3A83126Fu },
+    { 4100, 0x40400000u },
+    { 4200, 0x40500000u },
+};
+
+static void test_python_block(void) {
+    const uint16_t count = sizeof(python_samples) / sizeof(python_samples[0]);
+    checkDecode(python_block, sizeof(python_block), python_samples, count);
+
+    // And the encoder writes the same bytes
+    uint8_t block[BLOCK_SIZE];
+    SeriesEncoder encoder;
+    encoder.begin(block, BLOCK_SIZE);
+    for (uint16_t i = 0; i < count; i++) {
+        TEST_ASSERT_TRUE(encoder.append(python_samples[i].ms, bitsFloat(python_samples[i].bits)));
+    }
+    TEST_ASSERT_EQUAL_UINT16(sizeof(python_block), encoder.getBytes());
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(python_block, block, sizeof(python_block));
+}
+
+static void test_truncated_block(void) {
+    const uint16_t count = sizeof(python_samples) / sizeof(python_samples[0]);
+    SeriesDecoder decoder;
+    decoder.begin(python_block, 20, count);
+    uint32_t ms;
+    float value;
+    uint16_t decoded = 0;
+    while (decoder.next(&ms, &value)) decoded++;
+    TEST_ASSERT_LESS_THAN_UINT16(count, decoded);
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_steady_samples);
+    RUN_TEST(test_timestamp_codes);
+    RUN_TEST(test_time_wrap_and_jumps);
+    RUN_TEST(test_special_floats);
+    RUN_TEST(test_xor_windows);
+    RUN_TEST(test_block_full);
+    RUN_TEST(test_python_block);
+    RUN_TEST(test_truncated_block);
+    return UNITY_END();
+}
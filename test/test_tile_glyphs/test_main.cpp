@@ -0,0 +1,94 @@
+#include <unity.h>
+#include "glyph_cache.cpp"
+#include "tile_renderer.cpp"
+
+// Cached built-in glyphs rendered through the tiles must match the direct
+// draw, also when a scaled glyph straddles a tile edge
+
+#define SCREEN_W (TILE_SIZE * 3)
+#define SCREEN_H (TILE_SIZE * 3)
+#define FG 0xFFE0
+
+static uint16_t frame[SCREEN_W * SCREEN_H];
+static uint16_t expected[SCREEN_W * SCREEN_H];
+static GlyphCache cache;
+
+// Graphics::drawCharBuiltin() without the cache: one blank row of padding on top
+static void drawDirect(uint16_t* buf, int16_t x, int16_t y, char c, uint8_t scale) {
+    const uint8_t* columns = builtin_font_5x8[c - 32];
+    for (uint8_t row = 0; row < 8; row++) {
+        for (uint8_t col = 0; col < 5; col++) {
+            if (!(columns[col] & (1 << row))) continue;
+            for (uint8_t sy = 0; sy < scale; sy++) {
+                for (uint8_t sx = 0; sx < scale; sx++) {
+                    int16_t px = x + col * scale + sx;
+                    int16_t py = y + scale + row * scale + sy;
+                    if (px >= 0 && px < SCREEN_W && py >= 0 && py < SCREEN_H) buf[py * SCREEN_W + px] = FG;
+                }
+            }
+        }
+    }
+}
+
+static void drawTiled(int16_t x, int16_t y, char c, uint8_t scale) {
+    TileRenderer tiles;
+    TEST_ASSERT_TRUE(tiles.begin(frame, SCREEN_W, SCREEN_H));
+    const CachedGlyph* glyph = cache.getBuiltin(c, scale);
+    TEST_ASSERT_NOT_NULL(glyph);
+    tiles.beginFrame();
+    tiles.addGlyphSpans(x, y, glyph, FG);
+    tiles.endFrame();
+}
+
+void setUp(void) {
+    memset(frame, 0, sizeof(frame));
+    memset(expected, 0, sizeof(expected));
+    cache.begin();
+    cache.clear();
+}
+
+void tearDown(void) {}
+
+static void test_builtin_spans_row_ordered(void) {
+    for (uint8_t scale = 1; scale <= 4; scale++) {
+        for (char c = 32; c <= 126; c++) {
+            const CachedGlyph* glyph = cache.getBuiltin(c, scale);
+            TEST_ASSERT_NOT_NULL(glyph);
+            for (uint16_t i = 1; i < glyph->span_count; i++) {
+                TEST_ASSERT_TRUE(glyph->spans[i].y >= glyph->spans[i - 1].y);
+            }
+        }
+    }
+}
+
+// Glyph crossing the horizontal edge between tile rows 0 and 1
+static void test_scaled_glyph_across_tile_rows(void) {
+    const char text[] = "#%&@BMW8";
+    for (uint8_t scale = 2; scale <= 3; scale++) {
+        for (const char* c = text; *c; c++) {
+            for (int16_t y = TILE_SIZE - 8 * scale; y < TILE_SIZE; y += 3) {
+                setUp();
+                drawDirect(expected, 10, y, *c, scale);
+                drawTiled(10, y, *c, scale);
+                TEST_ASSERT_EQUAL_HEX16_ARRAY(expected, frame, SCREEN_W * SCREEN_H);
+            }
+        }
+    }
+}
+
+// And across a tile corner
+static void test_scaled_glyph_across_tile_corner(void) {
+    int16_t x = TILE_SIZE - 5;
+    int16_t y = TILE_SIZE - 9;
+    drawDirect(expected, x, y, '#', 2);
+    drawTiled(x, y, '#', 2);
+    TEST_ASSERT_EQUAL_HEX16_ARRAY(expected, frame, SCREEN_W * SCREEN_H);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_builtin_spans_row_ordered);
+    RUN_TEST(test_scaled_glyph_across_tile_rows);
+    RUN_TEST(test_scaled_glyph_across_tile_corner);
+    return UNITY_END();
+}
@@ -0,0 +1,259 @@
+#!/usr/bin/env python3
+"""
+Asset bundle builder - packs images, fonts and palettes for the "assets" partition
+
+Reads a JSON manifest, writes the bundle image (see lib/Assets/asset_bundle.h
+for the layout) and the matching lib/Assets/asset_ids.h. Asset ids follow
+the manifest order; the bundle checksum is compiled into asset_ids.h so the
+firmware refuses a bundle that does not match it.
+
+Manifest entries (paths relative to the manifest):
+  {"id": "LOGO", "type": "image", "file": "logo.png", "format": "qoi"}
+      format: raw, rle, qoi, p1, p4 or p8 (indexed, palette from the image)
+      optional "transparent": "#RRGGBB" colour key
+  {"id": "FONT_TITLE", "type": "font", "file": "../lib/GFX/FreeSans18pt7b.h"}
+      Adafruit GFX or tools/fontconvert_aa.py header (detected automatically)
+  {"id": "WARNING_COLORS", "type": "palette", "colors": ["#FF0000", "#800000"]}
+  {"id": "CALIBRATION", "type": "blob", "file": "table.bin"}
+
+Build and flash:
+  python tools/build_assets.py
+  esptool.py --chip esp32s3 write_flash 0x310000 .pio/assets.bin
+"""
+
+import argparse
+import json
+import os
+import re
+import struct
+import sys
+import zlib
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import qoi565  # noqa: E402
+
+BUNDLE_MAGIC = 0x41584647
+BUNDLE_VERSION = 1
+HEADER_SIZE = 16
+ENTRY_SIZE = 32
+ALIGN = 4
+
+ASSET_IMAGE, ASSET_AA_FONT, ASSET_GFX_FONT, ASSET_PALETTE, ASSET_BLOB = 1, 2, 3, 4, 5
+
+# ImageFormat values from lib/GFX/image_manager.h
+IMAGE_FORMATS = {"raw": 0, "rle": 1, "p1": 2, "p4": 3, "qoi": 4, "p8": 5}
+INDEX_BITS = {"p1": 1, "p4": 4, "p8": 8}
+
+
+def rgb565(r, g, b):
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def parse_color(text):
+    text = text.lstrip("#")
+    return rgb565(int(text[0:2], 16), int(text[2:4], 16), int(text[4:6], 16))
+
+
+def encode_rle(pixels):
+    """Same stream as ImageManager::compressRGB565RLE: [run][hi][lo], runs up to 255."""
+    out = bytearray()
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while i + run < len(pixels) and pixels[i + run] == pixels[i] and run < 255:
+            run += 1
+        out += bytes([run, pixels[i] >> 8, pixels[i] & 0xFF])
+        i += run
+    return bytes(out)
+
+
+def encode_indexed(pixels, width, height, bits):
+    palette = []
+    for px in pixels:
+        if px not in palette:
+            palette.append(px)
+            if len(palette) > (1 << bits):
+                sys.exit("image has more than %d colours for a %d-bit format" % (1 << bits, bits))
+    index = {c: i for i, c in enumerate(palette)}
+    out = bytearray()
+    for y in range(height):
+        acc, nbits = 0, 0
+        for x in range(width):
+            acc = (acc << bits) | index[pixels[y * width + x]]
+            nbits += bits
+            if nbits == 8:
+                out.append(acc)
+                acc, nbits = 0, 0
+        if nbits:
+            out.append(acc << (8 - nbits))      # Rows are byte-aligned
+    return bytes(out), palette
+
+
+def build_image(asset, base_dir):
+    width, height, pixels = qoi565.load_png(os.path.join(base_dir, asset["file"]))
+    fmt = asset.get("format", "qoi")
+    if fmt not in IMAGE_FORMATS:
+        sys.exit("%s: unknown image format %s" % (asset["id"], fmt))
+
+    palette = []
+    if fmt == "raw":
+        data = struct.pack("<%dH" % len(pixels), *pixels)
+    elif fmt == "rle":
+        data = encode_rle(pixels)
+    elif fmt == "qoi":
+        data = qoi565.encode(pixels)
+    else:
+        data, palette = encode_indexed(pixels, width, height, INDEX_BITS[fmt])
+
+    entry = dict(type=ASSET_IMAGE, format=IMAGE_FORMATS[fmt], width=width, height=height,
+                 data=data, palette=palette, transparent_index=-1, transparent_color=0, has_transparency=0)
+    if "transparent" in asset:
+        key = parse_color(asset["transparent"])
+        if palette:
+            entry["transparent_index"] = palette.index(key) if key in palette else -1
+        else:
+            entry["transparent_color"] = key
+            entry["has_transparency"] = 1
+    entry["note"] = "image %dx%d %s" % (width, height, fmt)
+    return entry
+
+
+def parse_c_array(text, name):
+    m = re.search(r"\b%s\s*\[\s*\]\s*PROGMEM\s*=\s*\{(.*?)\};" % re.escape(name), text, re.S)
+    if not m:
+        sys.exit("array %s not found" % name)
+    return re.sub(r"//[^\n]*", "", m.group(1))
+
+
+def build_font(asset, base_dir):
+    text = open(os.path.join(base_dir, asset["file"])).read()
+    aa = "AAGlyph" in text
+    m = re.search(r"const\s+(?:AAFont|GFXfont)\s+(\w+)\s+PROGMEM\s*=\s*\{(.*?)\};", text, re.S)
+    if not m:
+        sys.exit("%s: no font struct in %s" % (asset["id"], asset["file"]))
+    name = m.group(1)
+    first, last, y_advance = [int(v, 0) for v in re.findall(r"0x[0-9A-Fa-f]+|\b\d+\b", m.group(2))[-3:]]
+
+    bitmap = bytes(int(v, 0) for v in re.findall(r"0x[0-9A-Fa-f]+|\b\d+\b", parse_c_array(text, name + "Bitmaps")))
+    glyph_rows = re.findall(r"\{([^{}]*)\}", parse_c_array(text, name + "Glyphs"))
+    glyphs = bytearray()
+    for row in glyph_rows:
+        offset, w, h, advance, dx, dy = [int(v, 0) for v in row.split(",")]
+        if aa:
+            glyphs += struct.pack("<IBBBbbxxx", offset, w, h, advance, dx, dy)     # AAGlyph, 12 bytes
+        else:
+            glyphs += struct.pack("<HBBBbbx", offset, w, h, advance, dx, dy)       # GFXglyph, 8 bytes
+
+    # AssetFontHeader, glyph table, bitmaps
+    glyph_offset = 12
+    bitmap_offset = glyph_offset + len(glyphs)
+    data = struct.pack("<BBBxII", first, last, y_advance, glyph_offset, bitmap_offset) + bytes(glyphs) + bitmap
+    return dict(type=ASSET_AA_FONT if aa else ASSET_GFX_FONT, data=data,
+                note="%s font %s" % ("AA" if aa else "GFX", name))
+
+
+def build_entry(asset, base_dir):
+    kind = asset.get("type")
+    if kind == "image":
+        entry = build_image(asset, base_dir)
+    elif kind == "font":
+        entry = build_font(asset, base_dir)
+    elif kind == "palette":
+        colors = [parse_color(c) for c in asset["colors"]]
+        entry = dict(type=ASSET_PALETTE, data=struct.pack("<%dH" % len(colors), *colors),
+                     note="palette, %d colours" % len(colors))
+    elif kind == "blob":
+        entry = dict(type=ASSET_BLOB, data=open(os.path.join(base_dir, asset["file"]), "rb").read(), note="blob")
+    else:
+        sys.exit("%s: unknown asset type %s" % (asset.get("id"), kind))
+    entry["id"] = asset["id"]
+    return entry
+
+
+def align(n):
+    return (n + ALIGN - 1) & ~(ALIGN - 1)
+
+
+def pack_bundle(entries):
+    body = bytearray()
+    table = bytearray()
+    data_start = HEADER_SIZE + ENTRY_SIZE * len(entries)
+
+    def place(blob):
+        while (data_start + len(body)) % ALIGN:
+            body.append(0)
+        offset = data_start + len(body)
+        body.extend(blob)
+        return offset
+
+    for i, e in enumerate(entries):
+        offset = place(e["data"])
+        palette_offset = 0
+        if e.get("palette"):
+            palette_offset = place(struct.pack("<%dH" % len(e["palette"]), *e["palette"]))
+        table += struct.pack("<HBBHHIIIHhHB5x", i, e["type"], e.get("format", 0), e.get("width", 0),
+                             e.get("height", 0), offset, len(e["data"]), palette_offset,
+                             len(e.get("palette", [])), e.get("transparent_index", -1),
+                             e.get("transparent_color", 0), e.get("has_transparency", 0))
+
+    payload = bytes(table) + bytes(body)
+    payload += bytes(align(len(payload)) - len(payload))
+    checksum = zlib.crc32(payload) & 0xFFFFFFFF
+    header = struct.pack("<IHHII", BUNDLE_MAGIC, BUNDLE_VERSION, len(entries), HEADER_SIZE + len(payload), checksum)
+    return header + payload, checksum
+
+
+def write_ids(path, manifest_path, entries, checksum):
+    width = max(len(e["id"]) for e in entries) + len("ASSET_") if entries else 0
+    with open(path, "w") as out:
+        out.write("#pragma once\n\n")
+        out.write("// Generated by tools/build_assets.py from %s - do not edit\n\n" % manifest_path.replace(os.sep, "/"))
+        out.write("#define ASSET_BUNDLE_CHECKSUM 0x%08X\n" % checksum)
+        out.write("#define ASSET_COUNT %d\n\n" % len(entries))
+        for i, e in enumerate(entries):
+            out.write("#define %-*s %3d    // %s, %d bytes\n" % (width, "ASSET_" + e["id"], i, e["note"], len(e["data"])))
+
+
+def find_partition(csv_path, label):
+    """(offset, size) of a partition in an ESP-IDF partition table, or None."""
+    if not os.path.exists(csv_path):
+        return None
+    for line in open(csv_path):
+        fields = [f.strip() for f in line.split("#")[0].split(",")]
+        if len(fields) >= 5 and fields[0] == label:
+            return int(fields[3], 0), int(fields[4], 0)
+    return None
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--manifest", default="assets/assets.json")
+    parser.add_argument("--out", default=".pio/assets.bin", help="bundle image to flash")
+    parser.add_argument("--ids", default="lib/Assets/asset_ids.h", help="generated id header")
+    parser.add_argument("--partitions", default="partitions.csv")
+    parser.add_argument("--label", default="assets", help="partition name")
+    args = parser.parse_args()
+
+    manifest = json.load(open(args.manifest))
+    base_dir = os.path.dirname(os.path.abspath(args.manifest))
+    entries = [build_entry(asset, base_dir) for asset in manifest["assets"]]
+    bundle, checksum = pack_bundle(entries)
+
+    partition = find_partition(args.partitions, args.label)
+    if partition and len(bundle) > partition[1]:
+        sys.exit("bundle is %d bytes, partition '%s' holds %d" % (len(bundle), args.label, partition[1]))
+
+    os.makedirs(os.path.dirname(os.path.abspath(args.out)), exist_ok=True)
+    with open(args.out, "wb") as out:
+        out.write(bundle)
+    write_ids(args.ids, args.manifest, entries, checksum)
+
+    for i, e in enumerate(entries):
+        sys.stderr.write("  %3d %-20s %8d  %s\n" % (i, e["id"], len(e["data"]), e["note"]))
+    sys.stderr.write("%s: %d assets, %d bytes, checksum %08X\n" % (args.out, len(entries), len(bundle), checksum))
+    if partition:
+        sys.stderr.write("flash with: esptool.py --chip esp32s3 write_flash 0x%X %s\n" % (partition[0], args.out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+"""
+Anti-aliased font converter - produces 4-bpp AAFont headers for lib/GFX
+
+The output mirrors the Adafruit GFX font headers (FreeSans9pt7b.h etc.):
+a bitmap array, a glyph table and a font struct, all PROGMEM. Each glyph is
+stored as 4-bit coverage (0 = empty, 15 = solid), two pixels per byte with
+the left pixel in the high nibble, rows padded to a whole byte.
+
+Two sources are supported:
+  TrueType via Pillow:
+    python tools/fontconvert_aa.py --ttf FreeSans.ttf --size 16 --name FreeSans12pt7bAA > FreeSans12pt7bAA.h
+  Supersampling an existing 1-bpp GFX header (no extra dependencies):
+    python tools/fontconvert_aa.py --gfx lib/GFX/FreeSans18pt7b.h --downsample 2 --name FreeSans9pt7bAA > lib/GFX/FreeSans9pt7bAA.h
+"""
+
+import argparse
+import re
+import sys
+
+FIRST_CHAR = 0x20
+LAST_CHAR = 0x7E
+
+
+def quantize(coverage):
+    """Map coverage 0.0..1.0 to a 4-bit level."""
+    return max(0, min(15, int(round(coverage * 15))))
+
+
+def crop(levels, width, height):
+    """Crop a coverage grid to its non-zero bounding box. Returns (x0, y0, w, h, rows)."""
+    xs = [x for y in range(height) for x in range(width) if levels[y][x]]
+    ys = [y for y in range(height) for x in range(width) if levels[y][x]]
+    if not xs:
+        return 0, 0, 0, 0, []
+    x0, x1, y0, y1 = min(xs), max(xs), min(ys), max(ys)
+    rows = [levels[y][x0:x1 + 1] for y in range(y0, y1 + 1)]
+    return x0, y0, x1 - x0 + 1, y1 - y0 + 1, rows
+
+
+def pack_rows(rows, width):
+    """Pack 4-bit rows, two pixels per byte, high nibble first, byte-padded rows."""
+    out = []
+    for row in rows:
+        padded = list(row) + [0] * (width & 1)
+        for i in range(0, len(padded), 2):
+            out.append((padded[i] << 4) | padded[i + 1])
+    return out
+
+
+def glyphs_from_ttf(path, size):
+    from PIL import Image, ImageDraw, ImageFont
+
+    font = ImageFont.truetype(path, size)
+    ascent, descent = font.getmetrics()
+    glyphs = []
+    for code in range(FIRST_CHAR, LAST_CHAR + 1):
+        ch = chr(code)
+        advance = int(round(font.getlength(ch)))
+        canvas_w = advance + size * 2
+        canvas_h = ascent + descent + 2
+        image = Image.new("L", (canvas_w, canvas_h), 0)
+        ImageDraw.Draw(image).text((size, 0), ch, font=font, fill=255)
+        pixels = image.load()
+        levels = [[quantize(pixels[x, y] / 255.0) for x in range(canvas_w)] for y in range(canvas_h)]
+        x0, y0, w, h, rows = crop(levels, canvas_w, canvas_h)
+        # Offsets relative to the cursor on the baseline, like GFXglyph
+        glyphs.append((w, h, advance, x0 - size if w else 0, y0 - ascent if h else 0, rows))
+    return glyphs, ascent + descent
+
+
+def parse_gfx_header(path):
+    text = open(path).read()
+    bitmap_block = re.search(r"Bitmaps\[\]\s*PROGMEM\s*=\s*\{(.*?)\};", text, re.S).group(1)
+    bitmap = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]{2}", bitmap_block)]
+    glyph_block = re.search(r"Glyphs\[\]\s*PROGMEM\s*=\s*\{(.*)\};", text, re.S).group(1)
+    glyphs = [tuple(int(v) for v in g) for g in
+              re.findall(r"\{\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+)\s*\}", glyph_block)]
+    font = re.search(r"GFXfont\s+\w+\s*PROGMEM\s*=\s*\{[^,]+,[^,]+,\s*(0x[0-9A-Fa-f]+|\d+),\s*(0x[0-9A-Fa-f]+|\d+),\s*(\d+)\s*\}", text)
+    first, last, y_advance = int(font.group(1), 0), int(font.group(2), 0), int(font.group(3))
+    return bitmap, glyphs, first, last, y_advance
+
+
+def glyphs_from_gfx(path, factor):
+    bitmap, gfx_glyphs, first, last, y_advance = parse_gfx_header(path)
+    glyphs = []
+    for code in range(FIRST_CHAR, LAST_CHAR + 1):
+        if code < first or code > last:
+            glyphs.append((0, 0, 0, 0, 0, []))
+            continue
+        offset, w, h, x_adv, x_off, y_off = gfx_glyphs[code - first]
+
+        # Accumulate hi-res bits into low-res cells aligned to the cursor origin
+        cells = {}
+        bit = offset * 8
+        for yy in range(h):
+            for xx in range(w):
+                if bitmap[bit >> 3] & (0x80 >> (bit & 7)):
+                    key = ((y_off + yy) // factor, (x_off + xx) // factor)
+                    cells[key] = cells.get(key, 0) + 1
+                bit += 1
+
+        advance = int(round(x_adv / float(factor)))
+        if not cells:
+            glyphs.append((0, 0, advance, 0, 0, []))
+            continue
+        ys = [k[0] for k in cells]
+        xs = [k[1] for k in cells]
+        y0, x0 = min(ys), min(xs)
+        gw, gh = max(xs) - x0 + 1, max(ys) - y0 + 1
+        area = float(factor * factor)
+        rows = [[quantize(cells.get((y0 + y, x0 + x), 0) / area) for x in range(gw)] for y in range(gh)]
+        glyphs.append((gw, gh, advance, x0, y0, rows))
+    return glyphs, int(round(y_advance / float(factor)))
+
+
+def emit_header(name, glyphs, y_advance, out):
+    bitmap = []
+    table = []
+    for code, (w, h, advance, x_off, y_off, rows) in zip(range(FIRST_CHAR, LAST_CHAR + 1), glyphs):
+        table.append((len(bitmap), w, h, advance, x_off, y_off, code))
+        bitmap.extend(pack_rows(rows, w))
+
+    out.write("#pragma once\n\n")
+    out.write("// 4-bpp anti-aliased font generated by tools/fontconvert_aa.py\n\n")
+    out.write("const uint8_t %sBitmaps[] PROGMEM = {\n" % name)
+    for i in range(0, len(bitmap), 12):
+        chunk = ", ".join("0x%02X" % b for b in bitmap[i:i + 12])
+        out.write("    %s%s\n" % (chunk, "," if i + 12 < len(bitmap) else ""))
+    out.write("};\n\n")
+
+    out.write("const AAGlyph %sGlyphs[] PROGMEM = {\n" % name)
+    for i, (offset, w, h, advance, x_off, y_off, code) in enumerate(table):
+        entry = "{%d, %d, %d, %d, %d, %d}" % (offset, w, h, advance, x_off, y_off)
+        sep = "," if i + 1 < len(table) else "};"
+        label = chr(code)
+        out.write("    %-26s // 0x%02X '%s'\n" % (entry + sep, code, label))
+    out.write("\n")
+
+    out.write("const AAFont %s PROGMEM = {(uint8_t *)%sBitmaps,\n" % (name, name))
+    out.write("%s(AAGlyph *)%sGlyphs, 0x%02X,\n" % (" " * (24 + len(name)), name, FIRST_CHAR))
+    out.write("%s0x%02X, %d};\n\n" % (" " * (24 + len(name)), LAST_CHAR, y_advance))
+    out.write("// Approx. %d bytes\n" % (len(bitmap) + len(table) * 12 + 10))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate 4-bpp AAFont headers")
+    parser.add_argument("--name", required=True, help="C identifier of the font, e.g. FreeSans9pt7bAA")
+    parser.add_argument("--ttf", help="TrueType/OpenType source font")
+    parser.add_argument("--size", type=int, help="Pixel size for --ttf")
+    parser.add_argument("--gfx", help="Existing 1-bpp Adafruit GFX header to supersample")
+    parser.add_argument("--downsample", type=int, default=2, help="Supersampling factor for --gfx")
+    args = parser.parse_args()
+
+    if args.ttf:
+        if not args.size:
+            parser.error("--size is required with --ttf")
+        glyphs, y_advance = glyphs_from_ttf(args.ttf, args.size)
+    elif args.gfx:
+        glyphs, y_advance = glyphs_from_gfx(args.gfx, args.downsample)
+    else:
+        parser.error("one of --ttf or --gfx is required")
+
+    emit_header(args.name, glyphs, y_advance, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,208 @@
+#!/usr/bin/env python3
+"""
+QOI-style lossless RGB565 encoder - produces IMAGE_RGB565_QOI headers for lib/GFX
+
+The stream is a sequence of byte-aligned ops over the pixels in row order
+(runs may cross rows). The decoder keeps the previous pixel (starts at
+0x0000) and a 64-entry table of recently seen colours, indexed by
+(r * 3 + g * 5 + b * 7) & 63 on the 5/6/5-bit channels:
+
+  00iiiiii            INDEX  pixel = table[i]
+  01rrggbb            DIFF   dr, dg, db in -2..1 (stored +2), channels wrap
+  10gggggg rrrrbbbb   LUMA   dg in -32..31 (stored +32); dr and db relative
+                             to floor(dg / 2) in -8..7 (stored +8)
+  11rrrrrr            RUN    previous pixel 1..62 times (stored - 1, < 0x3E)
+  0xFE hi lo          RAW    pixel = (hi << 8) | lo
+  0xFF n              LONG   previous pixel 63 + n times
+
+Every pixel produced by INDEX, DIFF, LUMA or RAW is written to the table.
+This must stay in sync with lib/GFX/qoi565.cpp.
+
+Images normally go into the flash asset bundle (tools/build_assets.py uses
+this encoder for "format": "qoi"); this script produces a compiled-in header.
+
+Sources:
+  PNG (or anything Pillow reads):
+    python tools/qoi565.py --png splash.png --name splash_image > lib/GFX/splash_image.h
+  An existing raw RGB565 array header:
+    python tools/qoi565.py --header old_image.h --array logo_img --width 650 --name logo_image > lib/GFX/logo_image.h
+"""
+
+import argparse
+import re
+import sys
+
+OP_INDEX = 0x00
+OP_DIFF = 0x40
+OP_LUMA = 0x80
+OP_RUN = 0xC0
+OP_RAW = 0xFE
+OP_LONG_RUN = 0xFF
+MAX_RUN = 62
+MAX_LONG_RUN = 63 + 255
+
+
+def channels(c):
+    return (c >> 11) & 31, (c >> 5) & 63, c & 31
+
+
+def color_hash(c):
+    r, g, b = channels(c)
+    return (r * 3 + g * 5 + b * 7) & 63
+
+
+def wrap(d, bits):
+    """Signed difference modulo 2^bits."""
+    half = 1 << (bits - 1)
+    return ((d + half) & ((1 << bits) - 1)) - half
+
+
+def emit_run(out, run):
+    while run > 0:
+        if run > MAX_RUN:
+            n = min(run, MAX_LONG_RUN)
+            out += bytes([OP_LONG_RUN, n - 63])
+        else:
+            n = run
+            out.append(OP_RUN | (n - 1))
+        run -= n
+
+
+def encode(pixels):
+    out = bytearray()
+    table = [0] * 64
+    prev = 0
+    run = 0
+
+    for px in pixels:
+        if px == prev:
+            run += 1
+            continue
+        emit_run(out, run)
+        run = 0
+
+        h = color_hash(px)
+        if table[h] == px:
+            out.append(OP_INDEX | h)
+        else:
+            table[h] = px
+            r, g, b = channels(px)
+            pr, pg, pb = channels(prev)
+            dr, dg, db = wrap(r - pr, 5), wrap(g - pg, 6), wrap(b - pb, 5)
+            half = ((dg + 64) >> 1) - 32
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                out.append(OP_DIFF | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2))
+            elif -32 <= dg <= 31 and -8 <= dr - half <= 7 and -8 <= db - half <= 7:
+                out += bytes([OP_LUMA | (dg + 32), ((dr - half + 8) << 4) | (db - half + 8)])
+            else:
+                out += bytes([OP_RAW, px >> 8, px & 0xFF])
+        prev = px
+
+    emit_run(out, run)
+    return bytes(out)
+
+
+def decode(data, count):
+    pixels = []
+    table = [0] * 64
+    prev = 0
+    i = 0
+    while len(pixels) < count:
+        op = data[i]
+        i += 1
+        if op == OP_RAW:
+            px = (data[i] << 8) | data[i + 1]
+            i += 2
+        elif op == OP_LONG_RUN:
+            pixels += [prev] * (data[i] + 63)
+            i += 1
+            continue
+        elif (op & 0xC0) == OP_RUN:
+            pixels += [prev] * ((op & 0x3F) + 1)
+            continue
+        elif (op & 0xC0) == OP_INDEX:
+            px = table[op & 0x3F]
+        elif (op & 0xC0) == OP_DIFF:
+            r, g, b = channels(prev)
+            r = (r + ((op >> 4) & 3) - 2) & 31
+            g = (g + ((op >> 2) & 3) - 2) & 63
+            b = (b + (op & 3) - 2) & 31
+            px = (r << 11) | (g << 5) | b
+        else:
+            dg = (op & 0x3F) - 32
+            half = ((dg + 64) >> 1) - 32
+            rb = data[i]
+            i += 1
+            r, g, b = channels(prev)
+            r = (r + half + (rb >> 4) - 8) & 31
+            g = (g + dg) & 63
+            b = (b + half + (rb & 15) - 8) & 31
+            px = (r << 11) | (g << 5) | b
+        table[color_hash(px)] = px
+        pixels.append(px)
+        prev = px
+    return pixels[:count]
+
+
+def load_png(path):
+    from PIL import Image
+
+    img = Image.open(path).convert("RGB")
+    w, h = img.size
+    pixels = [((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3) for r, g, b in img.getdata()]
+    return w, h, pixels
+
+
+def load_header(path, array, width):
+    text = open(path).read()
+    m = re.search(r"\b%s\s*\[\s*\d*\s*\][^=]*=\s*\{(.*?)\};" % re.escape(array), text, re.S)
+    if not m:
+        sys.exit("array %s not found in %s" % (array, path))
+    body = re.sub(r"//[^\n]*", "", m.group(1))
+    pixels = [int(v, 0) for v in re.findall(r"0x[0-9A-Fa-f]+|\d+", body)]
+    if len(pixels) % width:
+        sys.exit("%d pixels is not a multiple of width %d" % (len(pixels), width))
+    return width, len(pixels) // width, pixels
+
+
+def write_header(out, name, width, height, data, raw_bytes):
+    out.write("#pragma once\n")
+    out.write('#include "image_manager.h"\n\n')
+    out.write("// %dx%d RGB565, QOI-style stream (tools/qoi565.py)\n" % (width, height))
+    out.write("// %d bytes, %.1f%% of the %d byte raw image\n\n" % (len(data), 100.0 * len(data) / raw_bytes, raw_bytes))
+    out.write("const uint8_t %s_data[%d] PROGMEM = {\n" % (name, len(data)))
+    for i in range(0, len(data), 16):
+        out.write("    " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",\n")
+    out.write("};\n\n")
+    out.write("const Image %s(%d, %d, IMAGE_RGB565_QOI, %s_data, (uint32_t)sizeof(%s_data));\n" % (name, width, height, name, name))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("--png", help="image file to convert (needs Pillow)")
+    source.add_argument("--header", help="C header holding a raw RGB565 array")
+    parser.add_argument("--array", help="array name inside --header")
+    parser.add_argument("--width", type=int, help="image width for --header")
+    parser.add_argument("--name", required=True, help="Image object name")
+    args = parser.parse_args()
+
+    if args.png:
+        width, height, pixels = load_png(args.png)
+    else:
+        if not args.array or not args.width:
+            parser.error("--header needs --array and --width")
+        width, height, pixels = load_header(args.header, args.array, args.width)
+
+    data = encode(pixels)
+    if decode(data, len(pixels)) != pixels:
+        sys.exit("round trip failed")
+
+    raw_bytes = len(pixels) * 2
+    sys.stderr.write("%s: %dx%d, %d -> %d bytes (%.1f%%)\n" %
+                     (args.name, width, height, raw_bytes, len(data), 100.0 * len(data) / raw_bytes))
+    write_header(sys.stdout, args.name, width, height, data, raw_bytes)
+
+
+if __name__ == "__main__":
+    main()
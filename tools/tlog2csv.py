@@ -0,0 +1,141 @@
+#!/usr/bin/env python3
+"""
+Telemetry log converter - decodes the "telemetry" partition to CSV or Parquet
+
+Reads either a raw partition image or a serial dump (the 'l' console command,
+see lib/Telemetry/telemetry_logger.h for the layout). Sectors are ordered by
+their sequence number, so a ring that has wrapped comes out oldest first;
+rows are sorted by time within each session. Times are millis() since
+boot; sessions number the boots.
+
+Get a log:
+  esptool.py --chip esp32s3 read_flash 0x510000 0x200000 tlog.bin
+or capture the serial output of 'l' from "TLOG ..." to "TLOG END" into a file.
+
+Convert:
+  python tools/tlog2csv.py tlog.bin -o drive.csv
+  python tools/tlog2csv.py dump.txt -o drive.parquet      (needs pyarrow)
+  python tools/tlog2csv.py tlog.bin --channel "Engine Oil" --session 12
+"""
+
+import argparse
+import csv
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from tlog_codec import SECTOR_SIZE, decode_sectors  # noqa: E402
+
+# Mode 01 PIDs from lib/BT_LE_OBD/ford_obd.h and the derived channels from
+# src/main.cpp, for images without a channel table
+DEFAULT_CHANNELS = {
+    0x04: "Engine Load",
+    0x05: "Coolant",
+    0x06: "Fuel Trim ST",
+    0x07: "Fuel Trim LT",
+    0x0A: "Fuel Pressure",
+    0x0B: "MAP",
+    0x0C: "RPM",
+    0x0D: "Speed",
+    0x0E: "Timing Advance",
+    0x0F: "Intake Air",
+    0x10: "MAF Rate",
+    0x11: "Throttle",
+    0x33: "Baro",
+    0x42: "ModuleVoltage",
+    0x5C: "Engine Oil",
+    0x100: "Boost",
+    0x101: "Fuel Flow",
+    0x102: "Economy",
+    0x103: "Power",
+}
+
+
+def read_input(path):
+    """Returns (sectors, channel names) from an image or a serial dump."""
+    with open(path, "rb") as f:
+        data = f.read()
+
+    start = data.find(b"TLOG ")
+    if start < 0:
+        sectors = [data[i:i + SECTOR_SIZE] for i in range(0, len(data) - SECTOR_SIZE + 1, SECTOR_SIZE)]
+        return sectors, {}
+
+    sectors = []
+    names = {}
+    for line in data[start:].decode("ascii", "replace").splitlines():
+        parts = line.strip().split(" ", 2)
+        if parts[0] == "C" and len(parts) == 3:
+            names[int(parts[1])] = parts[2]
+        elif parts[0] == "S" and len(parts) == 2:
+            sector = bytes.fromhex(parts[1])
+            if len(sector) == SECTOR_SIZE:
+                sectors.append(sector)
+            else:
+                print("warning: truncated sector line skipped", file=sys.stderr)
+        elif line.startswith("TLOG END"):
+            break
+    return sectors, names
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="partition image or serial dump")
+    parser.add_argument("-o", "--output", help="output .csv or .parquet (default: CSV on stdout)")
+    parser.add_argument("--channel", action="append", help="only this channel (name or PID, repeatable)")
+    parser.add_argument("--session", type=int, action="append", help="only this session (repeatable)")
+    args = parser.parse_args()
+
+    sectors, names = read_input(args.input)
+    channel_names = dict(DEFAULT_CHANNELS)
+    channel_names.update(names)
+
+    wanted = None
+    if args.channel:
+        wanted = set()
+        for c in args.channel:
+            ids = [k for k, v in channel_names.items() if v.lower() == c.lower()]
+            wanted.update(ids if ids else [int(c, 0)])
+
+    rows = []
+    for session, time_ms, channel, value in decode_sectors(sectors):
+        if wanted is not None and channel not in wanted:
+            continue
+        if args.session and session not in args.session:
+            continue
+        rows.append((session, time_ms, channel, channel_names.get(channel, "ch%d" % channel), value))
+
+    # Blocks are per channel, so merge the channels back into time order
+    rows.sort(key=lambda r: (r[0], r[1]))
+
+    if args.output and args.output.endswith(".parquet"):
+        try:
+            import pyarrow as pa
+            import pyarrow.parquet as pq
+        except ImportError:
+            sys.exit("Parquet output needs pyarrow (pip install pyarrow)")
+        columns = list(zip(*rows)) if rows else [[], [], [], [], []]
+        table = pa.table({
+            "session": pa.array(columns[0], pa.uint16()),
+            "time_ms": pa.array(columns[1], pa.uint32()),
+            "channel": pa.array(columns[2], pa.uint16()),
+            "name": pa.array(columns[3], pa.string()).dictionary_encode(),
+            "value": pa.array(columns[4], pa.float32()),
+        })
+        pq.write_table(table, args.output)
+    else:
+        out = open(args.output, "w", newline="") if args.output else sys.stdout
+        writer = csv.writer(out)
+        writer.writerow(["session", "time_ms", "channel", "name", "value"])
+        for session, time_ms, channel, name, value in rows:
+            writer.writerow([session, time_ms, channel, name, "%.6g" % value])
+        if args.output:
+            out.close()
+
+    sessions = sorted(set(r[0] for r in rows))
+    print("%d samples from %d sectors, sessions %s" % (len(rows), len(sectors),
+          ", ".join(str(s) for s in sessions) or "none"), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,266 @@
+#!/usr/bin/env python3
+"""
+Telemetry log format - sector, block index and compressed series decoding
+
+Mirrors lib/Telemetry/telemetry_logger.h and series_codec.h (keep in sync).
+Each block holds one channel: the first sample in full, then per sample a
+delta-of-delta timestamp code and a Gorilla XOR value code, MSB first.
+tools/tlog2csv.py uses this module to read logs.
+
+Run on its own, it encodes simulated drive data, checks the round trip and
+prints the compression against the 12-byte raw record:
+  python tools/tlog_codec.py --minutes 60
+"""
+
+import argparse
+import math
+import random
+import struct
+import sys
+
+MAGIC = 0x474C5454
+VERSION = 2
+SECTOR_SIZE = 4096
+INDEX_SIZE = 512
+BLOCK_SIZE = 128
+BLOCKS_PER_SECTOR = (SECTOR_SIZE - INDEX_SIZE) // BLOCK_SIZE
+SERIES_HEADER_SIZE = 8
+RAW_RECORD_SIZE = 12
+HEADER = struct.Struct("<IIHBBI")
+ENTRY = struct.Struct("<HHIIHH")
+UNWRITTEN = 0xFFFF
+
+# (prefix, prefix bits, payload bits) for each delta-of-delta range
+TIMESTAMP_CODES = [(0b10, 2, 7), (0b110, 3, 9), (0b1110, 4, 12), (0b1111, 4, 32)]
+
+
+def float_bits(v):
+    return struct.unpack("<I", struct.pack("<f", v))[0]
+
+
+def bits_float(b):
+    return struct.unpack("<f", struct.pack("<I", b))[0]
+
+
+def entry_check(channel, count, first_ms, last_ms, nbytes):
+    x = first_ms ^ last_ms ^ ((count << 16) | channel) ^ nbytes ^ 0xA55A
+    return (x ^ (x >> 16)) & 0xFFFF
+
+
+class BitWriter:
+    def __init__(self):
+        self.value = 0
+        self.count = 0
+
+    def write(self, bits, n):
+        self.value = (self.value << n) | (bits & ((1 << n) - 1))
+        self.count += n
+
+    def to_bytes(self):
+        pad = -self.count % 8
+        return (self.value << pad).to_bytes((self.count + pad) // 8, "big") if self.count else b""
+
+
+class BitReader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def read(self, n):
+        if self.pos + n > len(self.data) * 8:
+            raise ValueError("block truncated")
+        result = 0
+        for _ in range(n):
+            result = (result << 1) | ((self.data[self.pos >> 3] >> (7 - (self.pos & 7))) & 1)
+            self.pos += 1
+        return result
+
+
+def timestamp_cost(dod):
+    if dod == 0:
+        return 1
+    for prefix, prefix_bits, payload in TIMESTAMP_CODES[:-1]:
+        if -(1 << (payload - 1)) <= dod < (1 << (payload - 1)):
+            return prefix_bits + payload
+    return 4 + 32
+
+
+def encode_block(samples, size=BLOCK_SIZE):
+    """Encodes as many (time_ms, value) samples as fit; returns (bytes, count)."""
+    if not samples:
+        return b"", 0
+    t0, v0 = samples[0]
+    head = struct.pack("<II", t0 & 0xFFFFFFFF, float_bits(v0))
+    w = BitWriter()
+    last_ms, last_delta, last_value = t0, 0, float_bits(v0)
+    leading, trailing = None, 0
+    count = 1
+    for t, v in samples[1:]:
+        v = float_bits(v)
+        delta = (t - last_ms) & 0xFFFFFFFF
+        delta = delta - (1 << 32) if delta >= 1 << 31 else delta
+        dod = ((delta - last_delta + (1 << 31)) & 0xFFFFFFFF) - (1 << 31)
+        x = v ^ last_value
+        cost = timestamp_cost(dod)
+        if x == 0:
+            cost += 1
+        else:
+            lz = 32 - x.bit_length()
+            tz = (x & -x).bit_length() - 1
+            reuse = leading is not None and lz >= leading and tz >= trailing
+            cost += 2 + (32 - leading - trailing) if reuse else 2 + 10 + (32 - lz - tz)
+        if SERIES_HEADER_SIZE * 8 + w.count + cost > size * 8:
+            break
+
+        if dod == 0:
+            w.write(0, 1)
+        else:
+            for prefix, prefix_bits, payload in TIMESTAMP_CODES:
+                if payload == 32 or -(1 << (payload - 1)) <= dod < (1 << (payload - 1)):
+                    w.write(prefix, prefix_bits)
+                    w.write(dod, payload)
+                    break
+        if x == 0:
+            w.write(0, 1)
+        elif reuse:
+            w.write(0b10, 2)
+            w.write(x >> trailing, 32 - leading - trailing)
+        else:
+            w.write(0b11, 2)
+            w.write(lz, 5)
+            w.write(32 - lz - tz - 1, 5)
+            w.write(x >> tz, 32 - lz - tz)
+            leading, trailing = lz, tz
+
+        last_ms, last_delta, last_value = t, delta, v
+        count += 1
+    return head + w.to_bytes(), count
+
+
+def decode_block(data, count):
+    """Yields (time_ms, value) for the first count samples of a block."""
+    if count == 0:
+        return
+    t, v = struct.unpack_from("<II", data)
+    yield t, bits_float(v)
+    r = BitReader(data[SERIES_HEADER_SIZE:])
+    delta, leading, trailing = 0, 0, 0
+    for _ in range(count - 1):
+        ones = 0
+        while ones < 4 and r.read(1):
+            ones += 1
+        dod = 0
+        if ones:
+            n = TIMESTAMP_CODES[ones - 1][2]
+            dod = r.read(n)
+            if dod >= 1 << (n - 1):
+                dod -= 1 << n
+        delta = (delta + dod) & 0xFFFFFFFF
+        t = (t + delta) & 0xFFFFFFFF
+        if r.read(1):
+            if r.read(1):
+                leading = r.read(5)
+                trailing = 32 - leading - (r.read(5) + 1)
+                if trailing < 0:
+                    raise ValueError("bad value window")
+            v ^= r.read(32 - leading - trailing) << trailing
+        yield t, bits_float(v)
+
+
+def decode_sectors(sectors):
+    """Yields (session, time_ms, channel, value) from a list of sector images.
+
+    Sectors are taken in sequence order; within a session each channel's
+    samples come out in time order.
+    """
+    valid = []
+    for sector in sectors:
+        magic, sequence, session, version, block_units, _ = HEADER.unpack_from(sector)
+        if magic == MAGIC and version == VERSION and block_units * 16 == BLOCK_SIZE:
+            valid.append((sequence, session, sector))
+    valid.sort()
+
+    bad = 0
+    for _, session, sector in valid:
+        for b in range(BLOCKS_PER_SECTOR):
+            channel, count, first_ms, last_ms, nbytes, check = ENTRY.unpack_from(sector, HEADER.size + b * ENTRY.size)
+            if channel == UNWRITTEN:
+                continue
+            if not count or nbytes > BLOCK_SIZE or check != entry_check(channel, count, first_ms, last_ms, nbytes):
+                bad += 1
+                continue
+            offset = INDEX_SIZE + b * BLOCK_SIZE
+            try:
+                for t, v in decode_block(sector[offset:offset + nbytes], count):
+                    yield session, t, channel, v
+            except ValueError:
+                bad += 1
+    if bad:
+        print("warning: %d damaged blocks skipped" % bad, file=sys.stderr)
+
+
+def simulate_drive(minutes, seed=1):
+    """Samples per channel at the dashboard's PID rates, with BLE timing jitter."""
+    rng = random.Random(seed)
+    end = int(minutes * 60000)
+    channels = {}
+
+    def sampled(pid, period_ms, fn):
+        t, out = rng.randrange(period_ms), []
+        while t < end:
+            out.append((t, fn(t)))
+            t += period_ms + rng.randrange(-15, 40)
+        channels[pid] = out
+
+    def speed(t):
+        phase = t / 60000.0
+        return float(max(0, int(60 + 45 * math.sin(phase) + 20 * math.sin(phase * 7.3) + rng.uniform(-2, 2))))
+
+    sampled(0x0D, 250, speed)
+    sampled(0x11, 500, lambda t: round(max(0.0, min(255.0, 60 + 50 * math.sin(t / 9000.0) + rng.uniform(-8, 8)))) * 100.0 / 255.0)
+    sampled(0x04, 1000, lambda t: round(max(0.0, min(255.0, 90 + 60 * math.sin(t / 13000.0) + rng.uniform(-10, 10)))) * 100.0 / 255.0)
+    sampled(0x05, 3000, lambda t: float(int(min(92, 20 + t / 12000.0))))
+    sampled(0x5C, 3000, lambda t: float(int(min(104, 20 + t / 15000.0 + rng.uniform(0, 1)))))
+    sampled(0x0F, 3000, lambda t: float(int(28 + 4 * math.sin(t / 200000.0) + rng.uniform(0, 1))))
+    sampled(0x42, 500, lambda t: int(14200 + rng.uniform(-150, 150)) / 1000.0)
+    return channels
+
+
+def benchmark(minutes):
+    channels = simulate_drive(minutes)
+    total_samples = total_bytes = 0
+    print("channel  samples    raw bytes  blocks  stored bytes  bytes/sample  ratio")
+    for pid, samples in sorted(channels.items()):
+        # float32 on the device
+        samples = [(t, bits_float(float_bits(v))) for t, v in samples]
+        blocks, i = 0, 0
+        while i < len(samples):
+            data, count = encode_block(samples[i:])
+            if list(decode_block(data, count)) != samples[i:i + count]:
+                sys.exit("round trip failed for channel 0x%02X" % pid)
+            i += count
+            blocks += 1
+        raw = len(samples) * RAW_RECORD_SIZE
+        stored = blocks * (BLOCK_SIZE + ENTRY.size)
+        total_samples += len(samples)
+        total_bytes += stored
+        print("  0x%02X  %7d  %11d  %6d  %12d  %12.2f  %5.1fx" % (pid, len(samples), raw, blocks, stored,
+                                                                  stored / len(samples), raw / stored))
+
+    raw = total_samples * RAW_RECORD_SIZE
+    print("  all   %7d  %11d          %12d  %12.2f  %5.1fx" % (total_samples, raw, total_bytes,
+                                                               total_bytes / total_samples, raw / total_bytes))
+    partition = 0x200000 * (SECTOR_SIZE - INDEX_SIZE + BLOCKS_PER_SECTOR * ENTRY.size) // SECTOR_SIZE
+    print("2 MB partition holds about %.1f hours (raw records: %.1f hours)" %
+          (minutes / 60.0 * partition / total_bytes, minutes / 60.0 * 0x200000 / raw))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--minutes", type=float, default=60, help="simulated drive length")
+    args = parser.parse_args()
+    benchmark(args.minutes)
+
+
+if __name__ == "__main__":
+    main()